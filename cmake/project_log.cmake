@@ -1,4 +1,4 @@
-list_file_include_guard(VERSION 1.1.0)
+list_file_include_guard(VERSION 1.2.0)
 
 set_property(GLOBAL PROPERTY PROJECT_LOG_INITIALIZED true)
 
@@ -20,8 +20,19 @@ set_property(GLOBAL PROPERTY PROJECT_LOG_INITIALIZED true)
 # | `VERBOSE`          | Additional details for interested users.
 # | `DEBUG`            | Implementation details for project developers.
 # | `TRACE`            | Temporary fine-grained messages about internal details.
+#
+# Messages below the active log level (--log-level or CMAKE_MESSAGE_LOG_LEVEL) return before any formatting.
+# The active level is resolved once per CMAKE_MESSAGE_LOG_LEVEL value and cached in a global property.
 # ~~~
 function(project_log level)
+  get_property(_log_suppressed_levels GLOBAL PROPERTY "PROJECT_LOG_SUPPRESSED_LEVELS_${CMAKE_MESSAGE_LOG_LEVEL}")
+  if(NOT _log_suppressed_levels)
+    _project_log_resolve_suppressed_levels(_log_suppressed_levels)
+  endif()
+  if(level IN_LIST _log_suppressed_levels)
+    return()
+  endif()
+
   # Determine project context name
   if(PROJECT_NAME)
     set(_log_context_name "${PROJECT_NAME}")
@@ -36,55 +47,55 @@ function(project_log level)
     set(msg " ${_message_content}") # Prepend space if there's content, to match original format
   endif()
 
-  # Define ANSI color codes for different log levels (using CMake-compatible escapes)
-  if(WIN32)
-    # Windows terminals might not support ANSI colors by default Setting them to empty effectively disables them for Windows here.
-    set(COLOR_RESET "")
-    set(COLOR_STATUS "")
-    set(COLOR_VERBOSE "")
-    set(COLOR_DEBUG "")
-    set(COLOR_TRACE "")
-    set(COLOR_WARNING "")
-    set(COLOR_AUTHOR_WARNING "")
-    set(COLOR_DEPRECATION "")
-    set(COLOR_NOTICE "")
-    set(COLOR_ERROR "")
-    set(COLOR_FATAL_ERROR "")
-  else()
+  if(PROJECT_LOG_COLORS)
     # Define ANSI color codes for different log levels (using CMake-compatible escapes)
-    string(ASCII 27 Esc)
-    set(ColourReset "${Esc}[m")
-    set(ColourBold "${Esc}[1m")
-    set(Red "${Esc}[31m")
-    set(Green "${Esc}[32m")
-    set(Yellow "${Esc}[33m")
-    set(Blue "${Esc}[34m")
-    set(Magenta "${Esc}[35m")
-    set(Cyan "${Esc}[36m")
-    set(White "${Esc}[37m")
-    set(BoldRed "${Esc}[1;31m")
-    set(BoldGreen "${Esc}[1;32m")
-    set(BoldYellow "${Esc}[1;33m")
-    set(BoldBlue "${Esc}[1;34m")
-    set(BoldMagenta "${Esc}[1;35m")
-    set(BoldCyan "${Esc}[1;36m")
-    set(BoldWhite "${Esc}[1;37m")
+    if(WIN32)
+      # Windows terminals might not support ANSI colors by default Setting them to empty effectively disables them for Windows here.
+      set(COLOR_RESET "")
+      set(COLOR_STATUS "")
+      set(COLOR_VERBOSE "")
+      set(COLOR_DEBUG "")
+      set(COLOR_TRACE "")
+      set(COLOR_WARNING "")
+      set(COLOR_AUTHOR_WARNING "")
+      set(COLOR_DEPRECATION "")
+      set(COLOR_NOTICE "")
+      set(COLOR_ERROR "")
+      set(COLOR_FATAL_ERROR "")
+    else()
+      # Define ANSI color codes for different log levels (using CMake-compatible escapes)
+      string(ASCII 27 Esc)
+      set(ColourReset "${Esc}[m")
+      set(ColourBold "${Esc}[1m")
+      set(Red "${Esc}[31m")
+      set(Green "${Esc}[32m")
+      set(Yellow "${Esc}[33m")
+      set(Blue "${Esc}[34m")
+      set(Magenta "${Esc}[35m")
+      set(Cyan "${Esc}[36m")
+      set(White "${Esc}[37m")
+      set(BoldRed "${Esc}[1;31m")
+      set(BoldGreen "${Esc}[1;32m")
+      set(BoldYellow "${Esc}[1;33m")
+      set(BoldBlue "${Esc}[1;34m")
+      set(BoldMagenta "${Esc}[1;35m")
+      set(BoldCyan "${Esc}[1;36m")
+      set(BoldWhite "${Esc}[1;37m")
 
-    # Map the new color variables to the COLOR_* variables used in the existing code
-    set(COLOR_RESET "${ColourReset}")
-    set(COLOR_STATUS "${Green}") # green
-    set(COLOR_VERBOSE "${BoldGreen}") # bold green
-    set(COLOR_DEBUG "${BoldBlue}") # bold blue
-    set(COLOR_TRACE "${Cyan}") # cyan
-    set(COLOR_WARNING "${BoldYellow}") # bold yellow
-    set(COLOR_AUTHOR_WARNING "${Yellow}") # yellow
-    set(COLOR_DEPRECATION "${BoldMagenta}") # bold magenta
-    set(COLOR_NOTICE "${White}") # light gray
-    set(COLOR_ERROR "${BoldRed}") # bold red
-    set(COLOR_FATAL_ERROR "${Esc}[1;41;37m") # white on red background (keeping original as no direct equivalent)
-  endif()
+      # Map the new color variables to the COLOR_* variables used in the existing code
+      set(COLOR_RESET "${ColourReset}")
+      set(COLOR_STATUS "${Green}") # green
+      set(COLOR_VERBOSE "${BoldGreen}") # bold green
+      set(COLOR_DEBUG "${BoldBlue}") # bold blue
+      set(COLOR_TRACE "${Cyan}") # cyan
+      set(COLOR_WARNING "${BoldYellow}") # bold yellow
+      set(COLOR_AUTHOR_WARNING "${Yellow}") # yellow
+      set(COLOR_DEPRECATION "${BoldMagenta}") # bold magenta
+      set(COLOR_NOTICE "${White}") # light gray
+      set(COLOR_ERROR "${BoldRed}") # bold red
+      set(COLOR_FATAL_ERROR "${Esc}[1;41;37m") # white on red background (keeping original as no direct equivalent)
+    endif()
 
-  if(PROJECT_LOG_COLORS)
     # Select color based on log level
     if(DEFINED COLOR_${level})
       set(level_color "${COLOR_${level}}")
@@ -101,3 +112,25 @@ function(project_log level)
   # Forward the message with the specified log level
   message(${level} "${full_msg}")
 endfunction()
+
+# Cache the message levels hidden at the active log level in PROJECT_LOG_SUPPRESSED_LEVELS_<CMAKE_MESSAGE_LOG_LEVEL>.
+# The cached list starts with a "-" placeholder so an empty result still counts as resolved.
+function(_project_log_resolve_suppressed_levels out_var)
+  cmake_language(GET_MESSAGE_LOG_LEVEL _log_active_level)
+  set(_log_levels
+      ERROR
+      WARNING
+      NOTICE
+      STATUS
+      VERBOSE
+      DEBUG
+      TRACE)
+  list(FIND _log_levels "${_log_active_level}" _log_active_index)
+  math(EXPR _log_first_suppressed "${_log_active_index} + 1")
+  list(SUBLIST _log_levels ${_log_first_suppressed} -1 _log_suppressed)
+  list(PREPEND _log_suppressed "-")
+  set_property(GLOBAL PROPERTY "PROJECT_LOG_SUPPRESSED_LEVELS_${CMAKE_MESSAGE_LOG_LEVEL}" "${_log_suppressed}")
+  set(${out_var}
+      "${_log_suppressed}"
+      PARENT_SCOPE)
+endfunction()
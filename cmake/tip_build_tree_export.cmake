@@ -0,0 +1,60 @@
+cmake_minimum_required(VERSION 3.25)
+
+# ~~~
+# Build-tree package export for finalize_package(BUILD_TREE_EXPORT), loaded by
+# _tip_load_feature_module(tip_build_tree_export) when such an export is finalized.
+#
+# The package is written to ${CMAKE_BINARY_DIR}/<CMAKE_CONFIG_DESTINATION>, the same layout the install uses, and a
+# consumer finds it with <Export>_DIR pointing there. The build directory itself is no search prefix for it, since
+# find_package() would find the install-tree config that finalize_package() generates in the binary directory first.
+# The targets file comes from export(EXPORT) and refers to the build outputs, so a rebuild of the producer is picked
+# up without an install step.
+# ~~~
+
+# ~~~
+# Export the targets of the export being finalized by the calling finalize_package() to the build tree, and write a
+# config from the same template and dependency content as the installed one, the version files, the
+# INCLUDE_ON_FIND_PACKAGE files and the find_package() profiling helpers next to them. Baked dependency hints point at
+# the directories the producer found its dependencies in, since the build tree does not move.
+# ~~~
+function(_tip_export_build_tree_package)
+  if(IS_ABSOLUTE "${CMAKE_CONFIG_DESTINATION}")
+    project_log(FATAL_ERROR "BUILD_TREE_EXPORT for export '${ARG_EXPORT_NAME}' requires a relative CMAKE_CONFIG_DESTINATION, got '${CMAKE_CONFIG_DESTINATION}'")
+  endif()
+  set(_tip_build_tree_dir "${CMAKE_BINARY_DIR}/${CMAKE_CONFIG_DESTINATION}")
+
+  if(SHARD_BY_COMPONENT)
+    foreach(_tip_shard_export_set IN LISTS _tip_shard_order)
+      _tip_component_shard_file(_tip_shard_file "${ARG_EXPORT_NAME}" "${_tip_shard_export_set}")
+      export(
+        EXPORT ${_tip_shard_export_set}
+        FILE "${_tip_build_tree_dir}/${_tip_shard_file}"
+        NAMESPACE ${NAMESPACE})
+    endforeach()
+    configure_file("${CURRENT_BINARY_DIR}/${ARG_EXPORT_NAME}Targets.cmake" "${_tip_build_tree_dir}/${ARG_EXPORT_NAME}Targets.cmake" COPYONLY)
+  else()
+    export(
+      EXPORT ${ARG_EXPORT_NAME}
+      FILE "${_tip_build_tree_dir}/${ARG_EXPORT_NAME}Targets.cmake"
+      NAMESPACE ${NAMESPACE})
+  endif()
+
+  if(BAKE_DEPENDENCY_HINTS)
+    _tip_package_dependency_content("${_tip_build_tree_dir}")
+  endif()
+
+  # PACKAGE_PREFIX_DIR and PACKAGE_CMAKE_INSTALL_PREFIX of the build-tree config resolve to the build directory
+  set(CMAKE_INSTALL_PREFIX "${CMAKE_BINARY_DIR}")
+  configure_package_config_file(
+    "${CONFIG_TEMPLATE_TO_USE}" "${_tip_build_tree_dir}/${CONFIG_FILENAME}"
+    INSTALL_DESTINATION ${CMAKE_CONFIG_DESTINATION}
+    INSTALL_PREFIX "${CMAKE_BINARY_DIR}"
+    PATH_VARS CMAKE_INSTALL_PREFIX)
+
+  foreach(_tip_build_tree_file IN LISTS VERSION_FILE_PATH LEGACY_VERSION_FILE_PATH _tip_include_on_find_package_files _tip_find_package_profile_file)
+    get_filename_component(_tip_build_tree_file_name "${_tip_build_tree_file}" NAME)
+    configure_file("${_tip_build_tree_file}" "${_tip_build_tree_dir}/${_tip_build_tree_file_name}" COPYONLY)
+  endforeach()
+
+  project_log(VERBOSE "Build-tree package for export '${ARG_EXPORT_NAME}': ${_tip_build_tree_dir}")
+endfunction()
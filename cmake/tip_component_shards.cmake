@@ -0,0 +1,206 @@
+cmake_minimum_required(VERSION 3.25)
+
+# ~~~
+# Per-component imported target files for finalize_package(SHARD_BY_COMPONENT), loaded by
+# _tip_load_feature_module(tip_component_shards) when an export that uses the option is finalized.
+#
+# Every target of a sharded export is installed into its own export set: targets with a COMPONENT go to
+# <Export>-<Component>, written as <Export>-<Component>Targets.cmake, and targets without one go to <Export>, written as
+# <Export>-Targets.cmake. The installed <Export>Targets.cmake is a generated loader that includes the files for the
+# components passed to find_package(<Export> COMPONENTS ...) plus the components their targets link to, or every file
+# when no components are requested.
+# ~~~
+
+# ~~~
+# Name of the export set that holds the targets of COMPONENT ("" for targets without a component).
+# ~~~
+function(_tip_component_shard_export_set OUT_VAR EXPORT_NAME COMPONENT)
+  if("${COMPONENT}" STREQUAL "")
+    set(${OUT_VAR}
+        "${EXPORT_NAME}"
+        PARENT_SCOPE)
+  else()
+    set(${OUT_VAR}
+        "${EXPORT_NAME}-${COMPONENT}"
+        PARENT_SCOPE)
+  endif()
+endfunction()
+
+# ~~~
+# File name install(EXPORT) writes for EXPORT_SET. <Export>Targets.cmake is the loader, so the set without a component
+# is written as <Export>-Targets.cmake.
+# ~~~
+function(_tip_component_shard_file OUT_VAR EXPORT_NAME EXPORT_SET)
+  if(EXPORT_SET STREQUAL EXPORT_NAME)
+    set(${OUT_VAR}
+        "${EXPORT_NAME}-Targets.cmake"
+        PARENT_SCOPE)
+  else()
+    set(${OUT_VAR}
+        "${EXPORT_SET}Targets.cmake"
+        PARENT_SCOPE)
+  endif()
+endfunction()
+
+# ~~~
+# Set OUT_VAR to the entries of CANDIDATES that TARGET_NAME names in its INTERFACE_LINK_LIBRARIES, the property the
+# exported link interface is generated from. Alias names are resolved, and $<BUILD_INTERFACE:...> entries are ignored
+# because they are not exported. Other generator expressions are split into their tokens, so a target referenced under
+# any condition counts; loading an extra component is harmless, missing one makes find_package() fail.
+# ~~~
+function(_tip_link_interface_references OUT_VAR TARGET_NAME)
+  set(_tip_references "")
+  get_target_property(_tip_link_interface ${TARGET_NAME} INTERFACE_LINK_LIBRARIES)
+  if(_tip_link_interface)
+    string(REGEX REPLACE "\\$<BUILD_INTERFACE:[^<>]*>" "" _tip_link_interface "${_tip_link_interface}")
+    string(REPLACE "::" "@@" _tip_link_interface "${_tip_link_interface}")
+    string(REGEX REPLACE "[$<>:,]" ";" _tip_link_tokens "${_tip_link_interface}")
+    foreach(_tip_token IN LISTS _tip_link_tokens)
+      string(REPLACE "@@" "::" _tip_token "${_tip_token}")
+      if(_tip_token STREQUAL "" OR NOT TARGET "${_tip_token}")
+        continue()
+      endif()
+      get_target_property(_tip_aliased ${_tip_token} ALIASED_TARGET)
+      if(_tip_aliased)
+        set(_tip_token "${_tip_aliased}")
+      endif()
+      if(_tip_token IN_LIST ARGN AND NOT _tip_token STREQUAL TARGET_NAME)
+        list(APPEND _tip_references "${_tip_token}")
+      endif()
+    endforeach()
+  endif()
+  set(${OUT_VAR}
+      "${_tip_references}"
+      PARENT_SCOPE)
+endfunction()
+
+# ~~~
+# Assign the targets of an export to export sets and order the sets so every set comes after the sets its targets link
+# to. Reads TARGETS and the decoded _tip_target_<target>_COMPONENT variables of finalize_package() and sets, in the
+# calling scope:
+#   _tip_shard_export_set_<target> - Export set of each target
+#   _tip_shard_order               - Export sets in load order
+#   _tip_shard_closure_<set>       - The set and every set it needs, in load order
+#
+# API:
+#   _tip_plan_component_shards(<export_name>)
+# ~~~
+function(_tip_plan_component_shards EXPORT_NAME)
+  set(_tip_sets "")
+  foreach(_tip_target IN LISTS TARGETS)
+    _tip_component_shard_export_set(_tip_set "${EXPORT_NAME}" "${_tip_target_${_tip_target}_COMPONENT}")
+    set(_tip_set_of_${_tip_target} "${_tip_set}")
+    list(APPEND _tip_sets "${_tip_set}")
+    set(_tip_shard_export_set_${_tip_target}
+        "${_tip_set}"
+        PARENT_SCOPE)
+  endforeach()
+  list(REMOVE_DUPLICATES _tip_sets)
+
+  foreach(_tip_set IN LISTS _tip_sets)
+    set(_tip_deps_${_tip_set} "")
+  endforeach()
+  foreach(_tip_target IN LISTS TARGETS)
+    _tip_link_interface_references(_tip_references ${_tip_target} ${TARGETS})
+    foreach(_tip_reference IN LISTS _tip_references)
+      if(NOT _tip_set_of_${_tip_reference} STREQUAL _tip_set_of_${_tip_target})
+        list(APPEND _tip_deps_${_tip_set_of_${_tip_target}} "${_tip_set_of_${_tip_reference}}")
+      endif()
+    endforeach()
+  endforeach()
+
+  # Repeatedly take every set whose dependencies are already ordered; no progress means the sets link in a cycle.
+  set(_tip_order "")
+  set(_tip_pending ${_tip_sets})
+  while(_tip_pending)
+    set(_tip_ready "")
+    foreach(_tip_set IN LISTS _tip_pending)
+      set(_tip_set_ready TRUE)
+      foreach(_tip_dep IN LISTS _tip_deps_${_tip_set})
+        if(NOT _tip_dep IN_LIST _tip_order)
+          set(_tip_set_ready FALSE)
+          break()
+        endif()
+      endforeach()
+      if(_tip_set_ready)
+        list(APPEND _tip_ready "${_tip_set}")
+      endif()
+    endforeach()
+    if(NOT _tip_ready)
+      project_log(FATAL_ERROR "SHARD_BY_COMPONENT for export '${EXPORT_NAME}': the targets of export sets [${_tip_pending}] link to each other in a cycle, "
+                              "so their components cannot be loaded separately. Move the targets into one component.")
+    endif()
+    list(APPEND _tip_order ${_tip_ready})
+    list(REMOVE_ITEM _tip_pending ${_tip_ready})
+  endwhile()
+
+  foreach(_tip_set IN LISTS _tip_order)
+    set(_tip_closure "")
+    foreach(_tip_dep IN LISTS _tip_deps_${_tip_set})
+      list(APPEND _tip_closure ${_tip_closure_${_tip_dep}})
+    endforeach()
+    list(APPEND _tip_closure "${_tip_set}")
+    list(REMOVE_DUPLICATES _tip_closure)
+    # Keep the closure in load order
+    set(_tip_closure_${_tip_set} "")
+    foreach(_tip_ordered IN LISTS _tip_order)
+      if(_tip_ordered IN_LIST _tip_closure)
+        list(APPEND _tip_closure_${_tip_set} "${_tip_ordered}")
+      endif()
+    endforeach()
+    set(_tip_shard_closure_${_tip_set}
+        "${_tip_closure_${_tip_set}}"
+        PARENT_SCOPE)
+  endforeach()
+  set(_tip_shard_order
+      "${_tip_order}"
+      PARENT_SCOPE)
+  project_log(VERBOSE "Export '${EXPORT_NAME}' imported target shards in load order: [${_tip_order}]")
+endfunction()
+
+# ~~~
+# Write the <Export>Targets.cmake loader for the shards planned by _tip_plan_component_shards(). The file is only
+# rewritten when its content changes.
+#
+# API:
+#   _tip_write_component_shard_loader(<output_file> <export_name>)
+# ~~~
+function(_tip_write_component_shard_loader OUTPUT_FILE EXPORT_NAME)
+  set(_tip_always "")
+  if(EXPORT_NAME IN_LIST _tip_shard_order)
+    set(_tip_always ${_tip_shard_closure_${EXPORT_NAME}})
+  endif()
+
+  string(
+    CONCAT
+    _tip_loader
+    "# Generated by target_install_package for export '${EXPORT_NAME}' (SHARD_BY_COMPONENT).\n"
+    "# Loads the imported targets of the components passed to find_package(${EXPORT_NAME} COMPONENTS ...) and of the\n"
+    "# components they link to. Without COMPONENTS, the targets of every component are loaded.\n"
+    "if(${EXPORT_NAME}_FIND_COMPONENTS)\n"
+    "  set(_tip_component_shards \"${_tip_always}\")\n")
+  foreach(_tip_set IN LISTS _tip_shard_order)
+    if(_tip_set STREQUAL EXPORT_NAME)
+      continue()
+    endif()
+    string(LENGTH "${EXPORT_NAME}-" _tip_prefix_length)
+    string(SUBSTRING "${_tip_set}" ${_tip_prefix_length} -1 _tip_component)
+    string(APPEND _tip_loader "  if(\"${_tip_component}\" IN_LIST ${EXPORT_NAME}_FIND_COMPONENTS)\n" "    list(APPEND _tip_component_shards \"${_tip_shard_closure_${_tip_set}}\")\n" "  endif()\n")
+  endforeach()
+  string(APPEND _tip_loader "else()\n" "  set(_tip_component_shards \"${_tip_shard_order}\")\n" "endif()\n")
+  foreach(_tip_set IN LISTS _tip_shard_order)
+    _tip_component_shard_file(_tip_file "${EXPORT_NAME}" "${_tip_set}")
+    if(_tip_set IN_LIST _tip_always)
+      string(APPEND _tip_loader "include(\"\${CMAKE_CURRENT_LIST_DIR}/${_tip_file}\")\n")
+    else()
+      string(APPEND _tip_loader "if(\"${_tip_set}\" IN_LIST _tip_component_shards)\n" "  include(\"\${CMAKE_CURRENT_LIST_DIR}/${_tip_file}\")\n" "endif()\n")
+    endif()
+  endforeach()
+  string(APPEND _tip_loader "unset(_tip_component_shards)\n")
+
+  file(
+    CONFIGURE
+    OUTPUT "${OUTPUT_FILE}"
+    CONTENT "${_tip_loader}"
+    @ONLY)
+endfunction()
@@ -0,0 +1,135 @@
+cmake_minimum_required(VERSION 3.25)
+
+# ~~~
+# Content-addressed install store for LAYOUT content_store. An export whose targets use this layout installs like fhs,
+# then a last install(CODE) rule moves the content of every regular file it installed into a store shared by all
+# prefixes and leaves a hardlink to it at the installed path:
+#
+#   <store>/<first two hex digits>/<sha256>-<octal mode>
+#
+# Several versions of a package installed side by side (prefix/1.0, prefix/1.1, ...) keep one copy of every file whose
+# bytes did not change between them, on disk and in the page cache. The store defaults to .tip-store next to the
+# install prefix; the cache variable TIP_INSTALL_STORE, or the environment variable of the same name at install time,
+# points it elsewhere. A relative store is relative to the install prefix, and DESTDIR applies to it like to the
+# install() rules. The store must be on the filesystem of the prefix; where a hardlink cannot be made the installed
+# files stay plain copies and the install warns once.
+#
+# The installed paths are hardlinks rather than symbolic links into the store, so $ORIGIN RPATHs, relocatable package
+# config files and CMAKE_CURRENT_LIST_DIR resolve inside each prefix. Objects are keyed by mode as well as content,
+# since hardlinks share their permissions. file(INSTALL) replaces a file instead of writing into it, so a later install
+# of changed content never alters an object another prefix links. Objects that no prefix links any more have a link
+# count of 1:
+#
+#   find <store> -type f -links 1 -delete
+#
+# Code that runs at install time cannot use project_log().
+# ~~~
+
+if(NOT COMMAND _tip_installed_export_files)
+  include("${CMAKE_CURRENT_LIST_DIR}/tip_install_manifest.cmake")
+endif()
+
+# ~~~
+# Add the install rule that moves the files of the export into the store, after all of its other install rules. Called
+# by finalize_package() and reads its variables ARG_EXPORT_NAME and TIP_INSTALL_STORE.
+# ~~~
+function(_tip_add_content_store_rule)
+  _tip_find_target_install_package_resource_file("tip_content_store.cmake" _tip_store_script)
+  if(TIP_INSTALL_STORE)
+    set(_tip_store "${TIP_INSTALL_STORE}")
+  else()
+    set(_tip_store "../.tip-store")
+  endif()
+  string(
+    CONCAT _tip_code
+           "if(NOT COMMAND _tip_store_installed_files)\n"
+           "  include([==[${_tip_store_script}]==])\n"
+           "endif()\n"
+           "_tip_store_installed_files(EXPORT [==[${ARG_EXPORT_NAME}]==] STORE [==[${_tip_store}]==])\n")
+  install(CODE "${_tip_code}" ALL_COMPONENTS)
+endfunction()
+
+# ~~~
+# Install time: replace each regular file installed for EXPORT since _tip_begin_install_manifest() with a hardlink to its
+# object in STORE, adding the object when the store has none.
+#
+# API:
+#   _tip_store_installed_files(EXPORT <export> STORE <dir>)
+# ~~~
+function(_tip_store_installed_files)
+  cmake_parse_arguments(ARG "" "EXPORT;STORE" "" ${ARGN})
+  get_property(_tip_store_unsupported GLOBAL PROPERTY _TIP_INSTALL_STORE_UNSUPPORTED)
+  if(_tip_store_unsupported)
+    return()
+  endif()
+  set(_tip_store "${ARG_STORE}")
+  if(NOT "$ENV{TIP_INSTALL_STORE}" STREQUAL "")
+    set(_tip_store "$ENV{TIP_INSTALL_STORE}")
+  endif()
+  _tip_install_destination_dir(_tip_store "${_tip_store}")
+
+  _tip_installed_export_files(_tip_installed "${ARG_EXPORT}")
+  set(_tip_files "")
+  foreach(_tip_file IN LISTS _tip_installed)
+    if(NOT IS_SYMLINK "${_tip_file}"
+       AND EXISTS "${_tip_file}"
+       AND NOT IS_DIRECTORY "${_tip_file}")
+      list(APPEND _tip_files "${_tip_file}")
+    endif()
+  endforeach()
+  if(NOT _tip_files)
+    return()
+  endif()
+  _tip_installed_file_modes(_tip_modes ${_tip_files})
+
+  set(_tip_added 0)
+  set(_tip_shared 0)
+  set(_tip_index 0)
+  foreach(_tip_file IN LISTS _tip_files)
+    get_property(_tip_hash GLOBAL PROPERTY "_TIP_INSTALL_HASH_${_tip_file}")
+    if(NOT _tip_hash)
+      file(SHA256 "${_tip_file}" _tip_hash)
+    endif()
+    string(SUBSTRING "${_tip_hash}" 0 2 _tip_bucket)
+    set(_tip_object "${_tip_store}/${_tip_bucket}/${_tip_hash}")
+    if(_tip_modes)
+      list(GET _tip_modes ${_tip_index} _tip_mode)
+      string(APPEND _tip_object "-${_tip_mode}")
+    endif()
+    math(EXPR _tip_index "${_tip_index} + 1")
+
+    # A new object is the installed file itself; link() never leaves a partial object for a concurrent install to find
+    if(NOT EXISTS "${_tip_object}")
+      file(MAKE_DIRECTORY "${_tip_store}/${_tip_bucket}")
+      file(CREATE_LINK "${_tip_file}" "${_tip_object}" RESULT _tip_link_result)
+      if(_tip_link_result EQUAL 0)
+        math(EXPR _tip_added "${_tip_added} + 1")
+        continue()
+      endif()
+      if(NOT EXISTS "${_tip_object}")
+        set_property(GLOBAL PROPERTY _TIP_INSTALL_STORE_UNSUPPORTED TRUE)
+        message(WARNING "Cannot hardlink installed files into the content store ${_tip_store} (${_tip_link_result}); "
+                        "the files of ${ARG_EXPORT} stay plain copies. The store must be on the filesystem of the prefix.")
+        return()
+      endif()
+    endif()
+
+    # An existing object replaces the installed copy under a temporary name, so the path never goes missing
+    string(RANDOM LENGTH 8 _tip_suffix)
+    set(_tip_temporary "${_tip_file}.tip-${_tip_suffix}")
+    file(CREATE_LINK "${_tip_object}" "${_tip_temporary}" RESULT _tip_link_result)
+    if(NOT _tip_link_result EQUAL 0)
+      continue()
+    endif()
+    file(RENAME "${_tip_temporary}" "${_tip_file}")
+    # rename() leaves both names in place when the file already is a link to the object
+    if(EXISTS "${_tip_temporary}")
+      file(REMOVE "${_tip_temporary}")
+    endif()
+    math(EXPR _tip_shared "${_tip_shared} + 1")
+  endforeach()
+
+  if(NOT CMAKE_INSTALL_MESSAGE STREQUAL "NEVER")
+    message(STATUS "Content store: ${_tip_store} (${ARG_EXPORT}: ${_tip_shared} shared, ${_tip_added} added)")
+  endif()
+endfunction()
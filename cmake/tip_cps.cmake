@@ -0,0 +1,353 @@
+cmake_minimum_required(VERSION 3.25)
+
+# Set policy for install() DESTINATION path normalization if supported
+if(POLICY CMP0177)
+  cmake_policy(SET CMP0177 NEW)
+endif()
+
+# ~~~
+# CPS package metadata support for target_install_package, loaded by _tip_load_feature_module(tip_cps) the first time
+# a call passes CPS or an export with CPS metadata is finalized.
+# ~~~
+
+function(_tip_derive_cps_compat_version OUT_VAR VERSION COMPATIBILITY VERSION_SCHEMA)
+  set(_tip_compat_version "")
+
+  if(NOT "${VERSION_SCHEMA}" STREQUAL "" AND NOT "${VERSION_SCHEMA}" STREQUAL "simple")
+    set(${OUT_VAR}
+        ""
+        PARENT_SCOPE)
+    return()
+  endif()
+
+  if("${COMPATIBILITY}" STREQUAL "ExactVersion"
+     OR "${COMPATIBILITY}" STREQUAL "SamePatchVersion"
+     OR "${COMPATIBILITY}" STREQUAL "SameFullVersion")
+    set(${OUT_VAR}
+        ""
+        PARENT_SCOPE)
+    return()
+  endif()
+
+  if("${COMPATIBILITY}" STREQUAL "AnyNewerVersion")
+    set(_tip_compat_version "0.0.0")
+  elseif("${VERSION}" MATCHES "^([0-9]+)(\\.([0-9]+))?(\\.([0-9]+))?.*$")
+    set(_tip_major "${CMAKE_MATCH_1}")
+    set(_tip_minor "${CMAKE_MATCH_3}")
+    if(_tip_minor STREQUAL "")
+      set(_tip_minor "0")
+    endif()
+
+    if("${COMPATIBILITY}" STREQUAL "SameMajorVersion")
+      set(_tip_compat_version "${_tip_major}.0.0")
+    elseif("${COMPATIBILITY}" STREQUAL "SameMinorVersion")
+      set(_tip_compat_version "${_tip_major}.${_tip_minor}.0")
+    elseif("${COMPATIBILITY}" STREQUAL "SemanticVersion")
+      if(_tip_major EQUAL 0)
+        set(_tip_compat_version "0.${_tip_minor}.0")
+      else()
+        set(_tip_compat_version "${_tip_major}.0.0")
+      endif()
+    endif()
+  endif()
+
+  set(${OUT_VAR}
+      "${_tip_compat_version}"
+      PARENT_SCOPE)
+endfunction()
+
+# ~~~
+# Validate the CPS_* arguments of the calling _tip_prepare_package_targets().
+# ~~~
+function(_tip_validate_cps_arguments)
+  if(CMAKE_VERSION VERSION_LESS "4.3")
+    project_log(FATAL_ERROR "CPS package metadata requires CMake 4.3 or newer because it uses install(PACKAGE_INFO).")
+  endif()
+
+  if(NOT "${ARG_CPS_PROJECT}" STREQUAL "" AND ARG_CPS_NO_PROJECT_METADATA)
+    project_log(FATAL_ERROR "CPS_PROJECT and CPS_NO_PROJECT_METADATA cannot be used together.")
+  endif()
+
+  if(ARG_CPS_PRIMARY AND NOT "${ARG_CPS_APPENDIX}" STREQUAL "")
+    project_log(FATAL_ERROR "CPS_PRIMARY and CPS_APPENDIX cannot be used together: an appendix is never a find_package() entry point.")
+  endif()
+
+  if(NOT "${ARG_CPS_APPENDIX}" STREQUAL "")
+    set(_tip_cps_appendix_forbidden "")
+    foreach(
+      _tip_cps_appendix_arg IN
+      ITEMS ARG_CPS_PROJECT
+            ARG_CPS_VERSION
+            ARG_CPS_COMPAT_VERSION
+            ARG_CPS_VERSION_SCHEMA
+            ARG_CPS_DEFAULT_TARGETS
+            ARG_CPS_DEFAULT_CONFIGURATIONS
+            ARG_CPS_LICENSE
+            ARG_CPS_DESCRIPTION
+            ARG_CPS_HOMEPAGE_URL)
+      if(DEFINED ${_tip_cps_appendix_arg} AND NOT "${${_tip_cps_appendix_arg}}" STREQUAL "")
+        string(REGEX REPLACE "^ARG_" "" _tip_cps_appendix_name "${_tip_cps_appendix_arg}")
+        list(APPEND _tip_cps_appendix_forbidden "${_tip_cps_appendix_name}")
+      endif()
+    endforeach()
+
+    if(_tip_cps_appendix_forbidden)
+      project_log(FATAL_ERROR "CPS_APPENDIX cannot be combined with: ${_tip_cps_appendix_forbidden}")
+    endif()
+  endif()
+endfunction()
+
+# ~~~
+# Merge the CPS_* arguments of the calling _tip_prepare_package_targets() into the export's CPS record.
+# ~~~
+function(_tip_merge_cps_export_record)
+  get_property(_tip_export_cps_record_fields GLOBAL PROPERTY _TIP_EXPORT_CPS_RECORD_FIELDS)
+  get_property(_tip_export_cps_record GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_CPS_RECORD")
+  _tip_decode_record(_tip_export _tip_export_cps_record_fields _tip_export_cps_record)
+
+  set(_tip_export_CPS_ENABLED TRUE)
+  if(_tip_cps_version_explicit)
+    set(_tip_export_CPS_VERSION_EXPLICIT TRUE)
+  endif()
+
+  foreach(
+    _tip_cps_one_value IN
+    ITEMS CPS_PACKAGE_NAME
+          CPS_PROJECT
+          CPS_APPENDIX
+          CPS_DESTINATION
+          CPS_VERSION
+          CPS_COMPAT_VERSION
+          CPS_VERSION_SCHEMA
+          CPS_LICENSE
+          CPS_DEFAULT_LICENSE
+          CPS_DESCRIPTION
+          CPS_HOMEPAGE_URL
+          CPS_CXX_MODULES_DIRECTORY
+          CPS_COMPONENT)
+    set(_tip_cps_arg_var "ARG_${_tip_cps_one_value}")
+    if(DEFINED ${_tip_cps_arg_var} AND NOT "${${_tip_cps_arg_var}}" STREQUAL "")
+      string(REPLACE "_" " " _tip_cps_description "${_tip_cps_one_value}")
+      string(TOLOWER "${_tip_cps_description}" _tip_cps_description)
+      _tip_merge_export_field(_tip_export_ "${ARG_EXPORT_NAME}" "${_tip_cps_one_value}" "${${_tip_cps_arg_var}}" "${_tip_cps_description}")
+    endif()
+  endforeach()
+
+  foreach(_tip_cps_multi_value IN ITEMS CPS_DEFAULT_TARGETS CPS_DEFAULT_CONFIGURATIONS CPS_PERMISSIONS CPS_CONFIGURATIONS)
+    set(_tip_cps_arg_var "ARG_${_tip_cps_multi_value}")
+    if(DEFINED ${_tip_cps_arg_var} AND NOT "${${_tip_cps_arg_var}}" STREQUAL "")
+      _tip_append_export_field_unique(_tip_export_ "${_tip_cps_multi_value}" ${${_tip_cps_arg_var}})
+    endif()
+  endforeach()
+
+  if(ARG_CPS_PRIMARY)
+    set(_tip_export_CPS_PRIMARY TRUE)
+  endif()
+  if(ARG_CPS_NO_PROJECT_METADATA)
+    set(_tip_export_CPS_NO_PROJECT_METADATA TRUE)
+  endif()
+  if(ARG_CPS_LOWER_CASE_FILE)
+    set(_tip_export_CPS_LOWER_CASE_FILE TRUE)
+  endif()
+  if(ARG_CPS_EXCLUDE_FROM_ALL)
+    set(_tip_export_CPS_EXCLUDE_FROM_ALL TRUE)
+  endif()
+
+  _tip_encode_export_cps_record("${EXPORT_PROPERTY_PREFIX}_CPS_RECORD" _tip_export_)
+endfunction()
+
+# ~~~
+# CPS_PRIMARY: the .cps file is the export's entry point and finalize_package() generates a thin config from
+# cps-primary-config.cmake.in, which hands a CPS-capable consumer on to the .cps file and only loads the targets file
+# for one that cannot read CPS. Check that both give the same package.
+#
+# find_package(<Export>) must reach both under one name and create the same <Export>::<target> imported targets, and
+# the config must not do anything a CPS-aware consumer would skip: CMake script hooks and per-component find_dependency
+# calls have no CPS equivalent. PUBLIC_DEPENDENCIES stay allowed because the fallback needs them; the .cps gets its
+# requirements from the targets' link usage instead. Reads the decoded export record of the calling finalize_package().
+# ~~~
+function(_tip_check_cps_primary)
+  set(_tip_cps_consistency_conflicts "")
+  if(NOT "${CPS_PACKAGE_NAME}" STREQUAL "${ARG_EXPORT_NAME}")
+    list(APPEND _tip_cps_consistency_conflicts "CPS_PACKAGE_NAME '${CPS_PACKAGE_NAME}' differs from the export name")
+  endif()
+  if(NOT "${NAMESPACE}" STREQUAL "${ARG_EXPORT_NAME}::")
+    list(APPEND _tip_cps_consistency_conflicts "NAMESPACE '${NAMESPACE}' is not '${ARG_EXPORT_NAME}::'")
+  endif()
+  if(NOT "${CPS_APPENDIX}" STREQUAL "")
+    list(APPEND _tip_cps_consistency_conflicts "CPS_APPENDIX is set")
+  endif()
+  if(CONFIG_TEMPLATE)
+    list(APPEND _tip_cps_consistency_conflicts "CONFIG_TEMPLATE is set")
+  endif()
+  if(INCLUDE_ON_FIND_PACKAGE)
+    list(APPEND _tip_cps_consistency_conflicts "INCLUDE_ON_FIND_PACKAGE is set")
+  endif()
+  if(COMPONENT_DEPENDENCY_COMPONENTS)
+    list(APPEND _tip_cps_consistency_conflicts "COMPONENT_DEPENDENCIES is set")
+  endif()
+
+  if(_tip_cps_consistency_conflicts)
+    string(REPLACE ";" "; " _tip_cps_consistency_conflicts "${_tip_cps_consistency_conflicts}")
+    project_log(FATAL_ERROR "CPS_PRIMARY export '${ARG_EXPORT_NAME}' would load differently through its .cps file and its fallback config: ${_tip_cps_consistency_conflicts}.")
+  endif()
+endfunction()
+
+# ~~~
+# Install the CPS package description for the export being finalized by the calling finalize_package().
+# ~~~
+function(_tip_install_cps_package_info)
+  if(CMAKE_VERSION VERSION_LESS "4.3")
+    project_log(FATAL_ERROR "CPS package metadata requires CMake 4.3 or newer because it uses install(PACKAGE_INFO).")
+  endif()
+
+  set(_tip_cps_explicit_version "")
+  if(CPS_VERSION_EXPLICIT)
+    set(_tip_cps_explicit_version "${CPS_VERSION}")
+  endif()
+
+  if("${CPS_PACKAGE_NAME}" STREQUAL "")
+    set(CPS_PACKAGE_NAME "${ARG_EXPORT_NAME}")
+  endif()
+  if(CPS_PRIMARY)
+    _tip_check_cps_primary()
+  endif()
+
+  set(_tip_cps_effective_version "${CPS_VERSION}")
+  if("${_tip_cps_effective_version}" STREQUAL "")
+    if(VERSION_EXPLICIT OR "${CPS_PROJECT}" STREQUAL "")
+      set(_tip_cps_effective_version "${VERSION}")
+    elseif(NOT "${CPS_COMPAT_VERSION}" STREQUAL "" OR NOT "${CPS_VERSION_SCHEMA}" STREQUAL "")
+      set(_tip_cps_project_version_var "${CPS_PROJECT}_VERSION")
+      if(DEFINED ${_tip_cps_project_version_var} AND NOT "${${_tip_cps_project_version_var}}" STREQUAL "")
+        set(_tip_cps_effective_version "${${_tip_cps_project_version_var}}")
+      else()
+        project_log(FATAL_ERROR "CPS_COMPAT_VERSION or CPS_VERSION_SCHEMA for export '${ARG_EXPORT_NAME}' requires explicit CPS_VERSION/VERSION or a CPS_PROJECT with version metadata.")
+      endif()
+    endif()
+  endif()
+
+  if(NOT "${CPS_PROJECT}" STREQUAL "" AND CPS_NO_PROJECT_METADATA)
+    project_log(FATAL_ERROR "CPS_PROJECT and CPS_NO_PROJECT_METADATA cannot be used together for export '${ARG_EXPORT_NAME}'.")
+  endif()
+
+  if(NOT "${CPS_APPENDIX}" STREQUAL "")
+    set(_tip_cps_appendix_forbidden "")
+    foreach(
+      _tip_cps_appendix_option IN
+      ITEMS CPS_PROJECT
+            CPS_VERSION
+            CPS_COMPAT_VERSION
+            CPS_VERSION_SCHEMA
+            CPS_DEFAULT_TARGETS
+            CPS_DEFAULT_CONFIGURATIONS
+            CPS_LICENSE
+            CPS_DESCRIPTION
+            CPS_HOMEPAGE_URL)
+      set(_tip_cps_appendix_value "${${_tip_cps_appendix_option}}")
+
+      if(NOT "${_tip_cps_appendix_value}" STREQUAL "")
+        list(APPEND _tip_cps_appendix_forbidden "${_tip_cps_appendix_option}")
+      endif()
+    endforeach()
+
+    if(_tip_cps_appendix_forbidden)
+      project_log(FATAL_ERROR "CPS_APPENDIX cannot be combined with export-level CPS options for export '${ARG_EXPORT_NAME}': ${_tip_cps_appendix_forbidden}")
+    endif()
+  endif()
+
+  set(_tip_cps_args PACKAGE_INFO "${CPS_PACKAGE_NAME}" EXPORT "${ARG_EXPORT_NAME}")
+
+  if(NOT "${CPS_PROJECT}" STREQUAL "")
+    list(APPEND _tip_cps_args PROJECT "${CPS_PROJECT}")
+  elseif(CPS_NO_PROJECT_METADATA)
+    list(APPEND _tip_cps_args NO_PROJECT_METADATA)
+  endif()
+
+  if(NOT "${CPS_APPENDIX}" STREQUAL "")
+    list(APPEND _tip_cps_args APPENDIX "${CPS_APPENDIX}")
+  endif()
+  if(NOT "${CPS_DESTINATION}" STREQUAL "")
+    list(APPEND _tip_cps_args DESTINATION "${CPS_DESTINATION}")
+  endif()
+  if(CPS_LOWER_CASE_FILE)
+    list(APPEND _tip_cps_args LOWER_CASE_FILE)
+  endif()
+
+  if("${CPS_APPENDIX}" STREQUAL "")
+    if(NOT "${_tip_cps_effective_version}" STREQUAL "")
+      list(APPEND _tip_cps_args VERSION "${_tip_cps_effective_version}")
+
+      set(_tip_cps_effective_compat_version "${CPS_COMPAT_VERSION}")
+      if("${_tip_cps_effective_compat_version}" STREQUAL "")
+        _tip_derive_cps_compat_version(_tip_cps_effective_compat_version "${_tip_cps_effective_version}" "${COMPATIBILITY}" "${CPS_VERSION_SCHEMA}")
+        if(COMPATIBILITY STREQUAL "SamePatchVersion" OR COMPATIBILITY STREQUAL "ExactVersion")
+          project_log(
+            WARNING
+            "CPS cannot represent COMPATIBILITY '${COMPATIBILITY}' exactly for export '${ARG_EXPORT_NAME}'. Omitting COMPAT_VERSION makes CPS require the package version. Set CPS_COMPAT_VERSION explicitly to override this stricter behavior."
+          )
+        endif()
+      endif()
+      if(NOT "${_tip_cps_effective_compat_version}" STREQUAL "")
+        list(APPEND _tip_cps_args COMPAT_VERSION "${_tip_cps_effective_compat_version}")
+      endif()
+
+      if(NOT "${CPS_VERSION_SCHEMA}" STREQUAL "")
+        list(APPEND _tip_cps_args VERSION_SCHEMA "${CPS_VERSION_SCHEMA}")
+      endif()
+    endif()
+
+    set(_tip_cps_effective_default_targets ${CPS_DEFAULT_TARGETS})
+    list(LENGTH _tip_cps_effective_default_targets _tip_cps_effective_default_target_count)
+    if(_tip_cps_effective_default_target_count EQUAL 0)
+      set(_tip_cps_effective_default_targets ${_tip_cps_default_target_names})
+      list(REMOVE_DUPLICATES _tip_cps_effective_default_targets)
+      list(LENGTH _tip_cps_effective_default_targets _tip_cps_effective_default_target_count)
+    endif()
+    if(_tip_cps_effective_default_target_count GREATER 0)
+      foreach(_tip_cps_default_target IN LISTS _tip_cps_effective_default_targets)
+        if(NOT _tip_cps_default_target IN_LIST _tip_cps_exported_target_names)
+          project_log(FATAL_ERROR "CPS_DEFAULT_TARGETS entry '${_tip_cps_default_target}' is not an exported target name for export '${ARG_EXPORT_NAME}'.")
+        endif()
+      endforeach()
+      list(APPEND _tip_cps_args DEFAULT_TARGETS ${_tip_cps_effective_default_targets})
+    endif()
+
+    if(NOT "${CPS_DEFAULT_CONFIGURATIONS}" STREQUAL "")
+      list(APPEND _tip_cps_args DEFAULT_CONFIGURATIONS ${CPS_DEFAULT_CONFIGURATIONS})
+    endif()
+  endif()
+
+  if(NOT "${CPS_LICENSE}" STREQUAL "")
+    list(APPEND _tip_cps_args LICENSE "${CPS_LICENSE}")
+  endif()
+  if(NOT "${CPS_DEFAULT_LICENSE}" STREQUAL "")
+    list(APPEND _tip_cps_args DEFAULT_LICENSE "${CPS_DEFAULT_LICENSE}")
+  endif()
+  if(NOT "${CPS_DESCRIPTION}" STREQUAL "")
+    list(APPEND _tip_cps_args DESCRIPTION "${CPS_DESCRIPTION}")
+  endif()
+  if(NOT "${CPS_HOMEPAGE_URL}" STREQUAL "")
+    list(APPEND _tip_cps_args HOMEPAGE_URL "${CPS_HOMEPAGE_URL}")
+  endif()
+  if(NOT "${CPS_PERMISSIONS}" STREQUAL "")
+    list(APPEND _tip_cps_args PERMISSIONS ${CPS_PERMISSIONS})
+  endif()
+  if(NOT "${CPS_CONFIGURATIONS}" STREQUAL "")
+    list(APPEND _tip_cps_args CONFIGURATIONS ${CPS_CONFIGURATIONS})
+  endif()
+  if(NOT "${CPS_CXX_MODULES_DIRECTORY}" STREQUAL "")
+    list(APPEND _tip_cps_args CXX_MODULES_DIRECTORY "${CPS_CXX_MODULES_DIRECTORY}")
+  endif()
+  if(NOT "${CPS_COMPONENT}" STREQUAL "")
+    list(APPEND _tip_cps_args COMPONENT "${CPS_COMPONENT}")
+  else()
+    list(APPEND _tip_cps_args ${CONFIG_COMPONENT_ARGS})
+  endif()
+  if(CPS_EXCLUDE_FROM_ALL)
+    list(APPEND _tip_cps_args EXCLUDE_FROM_ALL)
+  endif()
+
+  install(${_tip_cps_args})
+  project_log(STATUS "CPS package '${CPS_PACKAGE_NAME}' is ready for export '${ARG_EXPORT_NAME}'")
+endfunction()
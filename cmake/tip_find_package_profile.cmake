@@ -0,0 +1,78 @@
+cmake_minimum_required(VERSION 3.25)
+
+# ~~~
+# find_package() load-time profiling for consumers that set TIP_PROFILE_FIND_PACKAGE. Installed next to every
+# generated <Export>Config.cmake and included by the first config that is loaded with the variable set, so consumers
+# that do not profile never read it.
+#
+# Each config records spans for the whole find_package() call, every find_dependency() call, every
+# INCLUDE_ON_FIND_PACKAGE file and the targets file. The spans are collected as Chrome trace events in the global
+# property _TIP_FIND_PACKAGE_PROFILE_EVENTS and written to TIP_PROFILE_FIND_PACKAGE_OUTPUT, by default
+# ${CMAKE_BINARY_DIR}/tip-find-package-profile.json, at the end of the top-level directory. Open the file in
+# chrome://tracing or https://ui.perfetto.dev; dependency spans enclose the spans of the packages they load.
+# ~~~
+
+# ~~~
+# Start a span and store its start time in <out_var>. The first span of a run sets the trace epoch and schedules the
+# trace file to be written at the end of the top-level directory.
+#
+# API:
+#   _tip_find_package_profile_begin(<out_var>)
+# ~~~
+function(_tip_find_package_profile_begin OUT_VAR)
+  string(TIMESTAMP _tip_now "%s%f" UTC)
+  get_property(_tip_epoch GLOBAL PROPERTY _TIP_FIND_PACKAGE_PROFILE_EPOCH_US)
+  if(NOT _tip_epoch)
+    set_property(GLOBAL PROPERTY _TIP_FIND_PACKAGE_PROFILE_EPOCH_US "${_tip_now}")
+    if(NOT CMAKE_SCRIPT_MODE_FILE)
+      cmake_language(DEFER DIRECTORY "${CMAKE_SOURCE_DIR}" CALL _tip_find_package_profile_flush)
+    endif()
+  endif()
+  set(${OUT_VAR} "${_tip_now}" PARENT_SCOPE)
+endfunction()
+
+# ~~~
+# Close the span started in <begin_var> and record it as <name> of <package>. Does nothing when the span was not
+# started. In script mode there is no end of directory, so the trace is written after every span.
+#
+# API:
+#   _tip_find_package_profile_end(<begin_var> <package> <name>)
+# ~~~
+function(_tip_find_package_profile_end BEGIN_VAR PACKAGE NAME)
+  if(NOT ${BEGIN_VAR})
+    return()
+  endif()
+  string(TIMESTAMP _tip_now "%s%f" UTC)
+  get_property(_tip_epoch GLOBAL PROPERTY _TIP_FIND_PACKAGE_PROFILE_EPOCH_US)
+  math(EXPR _tip_ts "${${BEGIN_VAR}} - ${_tip_epoch}")
+  math(EXPR _tip_dur "${_tip_now} - ${${BEGIN_VAR}}")
+  string(REPLACE "\\" "\\\\" NAME "${NAME}")
+  string(REPLACE "\"" "\\\"" NAME "${NAME}")
+  get_property(_tip_events GLOBAL PROPERTY _TIP_FIND_PACKAGE_PROFILE_EVENTS)
+  if(_tip_events)
+    set_property(GLOBAL APPEND_STRING PROPERTY _TIP_FIND_PACKAGE_PROFILE_EVENTS ",\n")
+  endif()
+  set_property(
+    GLOBAL APPEND_STRING
+    PROPERTY _TIP_FIND_PACKAGE_PROFILE_EVENTS
+    "{\"name\":\"${NAME}\",\"cat\":\"find_package\",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":${_tip_ts},\"dur\":${_tip_dur},\"args\":{\"package\":\"${PACKAGE}\"}}")
+  unset(${BEGIN_VAR} PARENT_SCOPE)
+  if(CMAKE_SCRIPT_MODE_FILE)
+    _tip_find_package_profile_flush()
+  endif()
+endfunction()
+
+# ~~~
+# Write the recorded spans as a JSON array to TIP_PROFILE_FIND_PACKAGE_OUTPUT.
+#
+# API:
+#   _tip_find_package_profile_flush()
+# ~~~
+function(_tip_find_package_profile_flush)
+  set(_tip_output "${TIP_PROFILE_FIND_PACKAGE_OUTPUT}")
+  if(NOT _tip_output)
+    set(_tip_output "${CMAKE_BINARY_DIR}/tip-find-package-profile.json")
+  endif()
+  get_property(_tip_events GLOBAL PROPERTY _TIP_FIND_PACKAGE_PROFILE_EVENTS)
+  file(WRITE "${_tip_output}" "[\n${_tip_events}\n]\n")
+endfunction()
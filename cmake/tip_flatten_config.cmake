@@ -0,0 +1,95 @@
+cmake_minimum_required(VERSION 3.25)
+
+# ~~~
+# Flattened package configs for finalize_package(FLATTEN_CONFIG). finalize_package() loads this module to check the
+# generated config, and the install(CODE) rule it adds after the config file includes it again in the install script
+# to rewrite the installed config. Code that runs at install time cannot use project_log().
+# ~~~
+
+# ~~~
+# Find the line of CONFIG_CONTENT that includes <Export>Targets.cmake from the config directory. Sets OUT_VAR to the
+# exact line, or to an empty string when the config does not include the targets file that way.
+#
+# API:
+#   _tip_find_flatten_targets_include(<out_var> <config_content> <export_name>)
+# ~~~
+function(_tip_find_flatten_targets_include OUT_VAR CONFIG_CONTENT EXPORT_NAME)
+  foreach(_tip_include_line IN ITEMS "include(\"\${CMAKE_CURRENT_LIST_DIR}/${EXPORT_NAME}Targets.cmake\")" "include(\${CMAKE_CURRENT_LIST_DIR}/${EXPORT_NAME}Targets.cmake)")
+    string(FIND "${CONFIG_CONTENT}" "${_tip_include_line}" _tip_include_index)
+    if(NOT _tip_include_index EQUAL -1)
+      set(${OUT_VAR}
+          "${_tip_include_line}"
+          PARENT_SCOPE)
+      return()
+    endif()
+  endforeach()
+  set(${OUT_VAR}
+      ""
+      PARENT_SCOPE)
+endfunction()
+
+# ~~~
+# Rewrite the installed <Export>Config.cmake from SOURCE_CONFIG, the config generated in the build tree, with the
+# installed <Export>Targets.cmake inlined in place of its include(). The file(GLOB) loop that loads the
+# <Export>Targets-<config>.cmake files is replaced by the contents of the files installed so far, in sorted order, so
+# installing a second configuration into the same prefix rewrites the config with both. The targets code runs in the
+# scope of the config, as it does when included, so the <Package>_FOUND and <Package>_NOT_FOUND_MESSAGE it sets for
+# targets missing from other export sets reach find_package(). It runs in a loop of one pass whose break() stands in for
+# its return(), which would otherwise end the whole config. CMAKE_CURRENT_LIST_FILE still names a file in the same
+# directory, so the computed import prefix is unchanged. The targets files stay installed for consumers that include
+# them directly.
+#
+# API:
+#   _tip_flatten_installed_package_config(EXPORT_NAME <name> SOURCE_CONFIG <path> DESTINATION <config_dest>)
+# ~~~
+function(_tip_flatten_installed_package_config)
+  cmake_parse_arguments(ARG "" "EXPORT_NAME;SOURCE_CONFIG;DESTINATION" "" ${ARGN})
+
+  if(IS_ABSOLUTE "${ARG_DESTINATION}")
+    set(_tip_config_dir "$ENV{DESTDIR}${ARG_DESTINATION}")
+  else()
+    set(_tip_config_dir "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/${ARG_DESTINATION}")
+  endif()
+  set(_tip_installed_config "${_tip_config_dir}/${ARG_EXPORT_NAME}Config.cmake")
+  set(_tip_targets_file "${_tip_config_dir}/${ARG_EXPORT_NAME}Targets.cmake")
+  if(NOT EXISTS "${_tip_targets_file}")
+    message(FATAL_ERROR "Cannot flatten '${_tip_installed_config}': '${_tip_targets_file}' was not installed")
+  endif()
+
+  file(READ "${ARG_SOURCE_CONFIG}" _tip_config_content)
+  _tip_find_flatten_targets_include(_tip_include_line "${_tip_config_content}" "${ARG_EXPORT_NAME}")
+  if(NOT _tip_include_line)
+    message(FATAL_ERROR "Cannot flatten '${_tip_installed_config}': '${ARG_SOURCE_CONFIG}' does not include ${ARG_EXPORT_NAME}Targets.cmake")
+  endif()
+
+  file(READ "${_tip_targets_file}" _tip_targets_content)
+  string(REGEX MATCH "file\\(GLOB [^\n]*Targets-\\*\\.cmake\"?\\)\nforeach\\([^\n]*\\)\n[^\n]*\nendforeach\\(\\)\n" _tip_glob_block "${_tip_targets_content}")
+  if(NOT _tip_glob_block)
+    message(WARNING "Not flattening '${_tip_installed_config}': no per-configuration include loop found in '${_tip_targets_file}'")
+    return()
+  endif()
+
+  file(GLOB _tip_config_files "${_tip_config_dir}/${ARG_EXPORT_NAME}Targets-*.cmake")
+  list(SORT _tip_config_files)
+  set(_tip_config_contents "")
+  foreach(_tip_config_file IN LISTS _tip_config_files)
+    file(READ "${_tip_config_file}" _tip_config_file_content)
+    get_filename_component(_tip_config_file_name "${_tip_config_file}" NAME)
+    string(APPEND _tip_config_contents "# Inlined ${_tip_config_file_name}\n${_tip_config_file_content}\n")
+  endforeach()
+  string(REPLACE "${_tip_glob_block}" "${_tip_config_contents}" _tip_targets_content "${_tip_targets_content}")
+  string(REGEX REPLACE "(^|\n)([ \t]*)return\\(\\)" "\\1\\2break()" _tip_targets_content "${_tip_targets_content}")
+
+  string(
+    CONCAT
+    _tip_flattened_targets
+    "# Inlined ${ARG_EXPORT_NAME}Targets.cmake\n"
+    "foreach(_tip_flattened_targets_pass IN ITEMS 1)\n"
+    "${_tip_targets_content}"
+    "endforeach()")
+  string(REPLACE "${_tip_include_line}" "${_tip_flattened_targets}" _tip_config_content "${_tip_config_content}")
+  # A new file, since the installed one may be a hardlink into a content store
+  file(REMOVE "${_tip_installed_config}")
+  file(WRITE "${_tip_installed_config}" "${_tip_config_content}")
+  message(STATUS "Flattened: ${_tip_installed_config}")
+endfunction()
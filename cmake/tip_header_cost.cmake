@@ -0,0 +1,325 @@
+cmake_minimum_required(VERSION 3.25)
+
+# ~~~
+# Consumer compile-cost report for finalize_package(HEADER_COST_REPORT). finalize_package() loads this module to add a
+# <Export>_header_cost target, and that target runs this file again as a script to measure the headers.
+#
+# Every header the export installs, from its HEADERS file sets and PUBLIC_HEADER, is compiled on its own in a
+# translation unit that only includes it, with the include directories and compile definitions a consumer gets from
+# the target. Headers are compiled as C++ when the project enables CXX and as C otherwise. For each header the report
+# records the syntax-only frontend time, the preprocessed line count and the number of headers it pulls in, and flags
+# headers that do not compile on their own. The report is written to ${CMAKE_BINARY_DIR}/tip-header-cost/<Export>.txt,
+# slowest header first, and the target fails when a header is not self-contained. GNU-style and MSVC-style compiler
+# frontends are supported. Code that runs from the target cannot use project_log().
+# ~~~
+
+# ~~~
+# Add the <Export>_header_cost target for the export being finalized by the calling finalize_package(), and make the
+# aggregate tip_header_cost target depend on it. The compiler, the flags and the headers of each target are written to
+# an inputs file at generate time, so generator expressions in the usage requirements are evaluated for the build tree.
+# ~~~
+function(_tip_add_header_cost_target)
+  set(_tip_target_name "${ARG_EXPORT_NAME}_header_cost")
+  if(TARGET "${_tip_target_name}")
+    project_log(FATAL_ERROR "HEADER_COST_REPORT for export '${ARG_EXPORT_NAME}' cannot create target '${_tip_target_name}': a target with that name exists")
+  endif()
+
+  get_property(_tip_languages GLOBAL PROPERTY ENABLED_LANGUAGES)
+  if("CXX" IN_LIST _tip_languages)
+    set(_tip_language CXX)
+    set(_tip_extension cpp)
+  elseif("C" IN_LIST _tip_languages)
+    set(_tip_language C)
+    set(_tip_extension c)
+  else()
+    project_log(WARNING "HEADER_COST_REPORT for export '${ARG_EXPORT_NAME}' needs the C or CXX language enabled to compile headers, skipping")
+    return()
+  endif()
+
+  if(CMAKE_${_tip_language}_COMPILER_ID STREQUAL "MSVC" OR CMAKE_${_tip_language}_COMPILER_FRONTEND_VARIANT STREQUAL "MSVC")
+    set(_tip_frontend MSVC)
+    set(_tip_include_flag "/I")
+    set(_tip_define_flag "/D")
+  else()
+    set(_tip_frontend GNU)
+    set(_tip_include_flag "-I")
+    set(_tip_define_flag "-D")
+  endif()
+
+  # The language standard a consumer compiles with is at least the newest one the targets require. Standards from
+  # the last century (90, 98, 99) sort before the two-digit years after them.
+  string(TOLOWER "${_tip_language}" _tip_feature_prefix)
+  set(_tip_standard "${CMAKE_${_tip_language}_STANDARD}")
+  foreach(TARGET_NAME IN LISTS TARGETS)
+    get_target_property(_tip_features ${TARGET_NAME} INTERFACE_COMPILE_FEATURES)
+    foreach(_tip_feature IN LISTS _tip_features)
+      if(NOT _tip_feature MATCHES "^${_tip_feature_prefix}_std_([0-9]+)$")
+        continue()
+      endif()
+      set(_tip_candidate "${CMAKE_MATCH_1}")
+      if(NOT _tip_standard)
+        set(_tip_standard "${_tip_candidate}")
+        continue()
+      endif()
+      set(_tip_candidate_rank ${_tip_candidate})
+      set(_tip_standard_rank ${_tip_standard})
+      foreach(_tip_rank_var IN ITEMS _tip_candidate_rank _tip_standard_rank)
+        if(${_tip_rank_var} GREATER_EQUAL 90)
+          math(EXPR ${_tip_rank_var} "${${_tip_rank_var}} - 100")
+        endif()
+      endforeach()
+      if(_tip_candidate_rank GREATER _tip_standard_rank)
+        set(_tip_standard "${_tip_candidate}")
+      endif()
+    endforeach()
+  endforeach()
+  set(_tip_base_flags "")
+  if(CMAKE_${_tip_language}_FLAGS)
+    separate_arguments(_tip_base_flags NATIVE_COMMAND "${CMAKE_${_tip_language}_FLAGS}")
+  endif()
+  if(_tip_standard)
+    if(DEFINED CMAKE_${_tip_language}_EXTENSIONS AND NOT CMAKE_${_tip_language}_EXTENSIONS)
+      set(_tip_standard_option "${CMAKE_${_tip_language}${_tip_standard}_STANDARD_COMPILE_OPTION}")
+    else()
+      set(_tip_standard_option "${CMAKE_${_tip_language}${_tip_standard}_EXTENSION_COMPILE_OPTION}")
+    endif()
+    list(APPEND _tip_base_flags ${_tip_standard_option})
+  endif()
+
+  set(_tip_report_dir "${CMAKE_BINARY_DIR}/tip-header-cost")
+  string(
+    CONCAT
+    _tip_inputs
+    "set(_tip_header_cost_export [==[${ARG_EXPORT_NAME}]==])\n"
+    "set(_tip_header_cost_report [==[${_tip_report_dir}/${ARG_EXPORT_NAME}.txt]==])\n"
+    "set(_tip_header_cost_work_dir [==[${_tip_report_dir}/${ARG_EXPORT_NAME}]==])\n"
+    "set(_tip_header_cost_compiler [==[${CMAKE_${_tip_language}_COMPILER}]==])\n"
+    "set(_tip_header_cost_compiler_label [==[${CMAKE_${_tip_language}_COMPILER_ID} ${CMAKE_${_tip_language}_COMPILER_VERSION}, ${_tip_language}]==])\n"
+    "set(_tip_header_cost_frontend ${_tip_frontend})\n"
+    "set(_tip_header_cost_show_includes_prefix [==[${CMAKE_CL_SHOWINCLUDES_PREFIX}]==])\n"
+    "set(_tip_header_cost_extension ${_tip_extension})\n"
+    "set(_tip_header_cost_base_flags [==[${_tip_base_flags}]==])\n")
+
+  set(_tip_header_targets "")
+  foreach(TARGET_NAME IN LISTS TARGETS)
+    get_target_property(_tip_source_dir ${TARGET_NAME} SOURCE_DIR)
+    get_target_property(_tip_header_sets ${TARGET_NAME} INTERFACE_HEADER_SETS)
+    get_target_property(_tip_public_headers ${TARGET_NAME} PUBLIC_HEADER)
+    if(NOT _tip_header_sets)
+      set(_tip_header_sets "")
+    endif()
+    if(NOT _tip_public_headers)
+      set(_tip_public_headers "")
+    endif()
+    set(_tip_headers "")
+    set(_tip_names "")
+    foreach(_tip_header_set IN LISTS _tip_header_sets)
+      get_target_property(_tip_set_files ${TARGET_NAME} HEADER_SET_${_tip_header_set})
+      get_target_property(_tip_set_dirs ${TARGET_NAME} HEADER_DIRS_${_tip_header_set})
+      set(_tip_base_dirs "")
+      foreach(_tip_set_dir IN LISTS _tip_set_dirs)
+        cmake_path(ABSOLUTE_PATH _tip_set_dir BASE_DIRECTORY "${_tip_source_dir}" NORMALIZE)
+        list(APPEND _tip_base_dirs "${_tip_set_dir}")
+      endforeach()
+      foreach(_tip_header IN LISTS _tip_set_files)
+        if(_tip_header MATCHES "\\$<")
+          continue()
+        endif()
+        cmake_path(ABSOLUTE_PATH _tip_header BASE_DIRECTORY "${_tip_source_dir}" NORMALIZE)
+        get_filename_component(_tip_name "${_tip_header}" NAME)
+        foreach(_tip_base_dir IN LISTS _tip_base_dirs)
+          cmake_path(IS_PREFIX _tip_base_dir "${_tip_header}" _tip_in_base_dir)
+          if(_tip_in_base_dir)
+            file(RELATIVE_PATH _tip_name "${_tip_base_dir}" "${_tip_header}")
+            break()
+          endif()
+        endforeach()
+        list(APPEND _tip_headers "${_tip_header}")
+        list(APPEND _tip_names "${_tip_name}")
+      endforeach()
+    endforeach()
+    foreach(_tip_header IN LISTS _tip_public_headers)
+      if(_tip_header MATCHES "\\$<")
+        continue()
+      endif()
+      cmake_path(ABSOLUTE_PATH _tip_header BASE_DIRECTORY "${_tip_source_dir}" NORMALIZE)
+      get_filename_component(_tip_name "${_tip_header}" NAME)
+      list(APPEND _tip_headers "${_tip_header}")
+      list(APPEND _tip_names "${_tip_name}")
+    endforeach()
+    if(NOT _tip_headers)
+      continue()
+    endif()
+
+    list(APPEND _tip_header_targets ${TARGET_NAME})
+    set(_tip_includes "$<TARGET_PROPERTY:${TARGET_NAME},INTERFACE_INCLUDE_DIRECTORIES>")
+    set(_tip_defines "$<TARGET_PROPERTY:${TARGET_NAME},INTERFACE_COMPILE_DEFINITIONS>")
+    string(
+      APPEND
+      _tip_inputs
+      "set(_tip_header_cost_${TARGET_NAME}_headers [==[${_tip_headers}]==])\n"
+      "set(_tip_header_cost_${TARGET_NAME}_names [==[${_tip_names}]==])\n"
+      "set(_tip_header_cost_${TARGET_NAME}_flags [==[$<$<BOOL:${_tip_includes}>:${_tip_include_flag}$<JOIN:${_tip_includes},;${_tip_include_flag}>>;"
+      "$<$<BOOL:${_tip_defines}>:${_tip_define_flag}$<JOIN:${_tip_defines},;${_tip_define_flag}>>]==])\n")
+  endforeach()
+  if(NOT _tip_header_targets)
+    project_log(WARNING "HEADER_COST_REPORT for export '${ARG_EXPORT_NAME}' found no installed headers, skipping")
+    return()
+  endif()
+  string(APPEND _tip_inputs "set(_tip_header_cost_targets [==[${_tip_header_targets}]==])\n")
+
+  set(_tip_inputs_file "${_tip_report_dir}/${ARG_EXPORT_NAME}-inputs$<$<BOOL:$<CONFIG>>:-$<CONFIG>>.cmake")
+  file(GENERATE OUTPUT "${_tip_inputs_file}" CONTENT "${_tip_inputs}")
+  _tip_find_target_install_package_resource_file("tip_header_cost.cmake" _tip_header_cost_script)
+  # The targets are built first, so headers generated at build time exist when they are measured
+  add_custom_target(
+    ${_tip_target_name}
+    COMMAND "${CMAKE_COMMAND}" "-DTIP_HEADER_COST_INPUTS=${_tip_inputs_file}" -P "${_tip_header_cost_script}"
+    COMMENT "Measuring the compile cost of the headers of export '${ARG_EXPORT_NAME}'"
+    VERBATIM)
+  add_dependencies(${_tip_target_name} ${_tip_header_targets})
+  if(NOT TARGET tip_header_cost)
+    add_custom_target(tip_header_cost)
+  endif()
+  add_dependencies(tip_header_cost ${_tip_target_name})
+  project_log(VERBOSE "Header compile-cost report for export '${ARG_EXPORT_NAME}': build target '${_tip_target_name}'")
+endfunction()
+
+# ~~~
+# Pad VALUE with spaces to WIDTH characters, on the left with RIGHT_ALIGN, and append it to the row in OUT_VAR.
+# ~~~
+function(_tip_header_cost_append_cell OUT_VAR WIDTH VALUE RIGHT_ALIGN)
+  string(LENGTH "${VALUE}" _tip_length)
+  set(_tip_padding "")
+  if(_tip_length LESS WIDTH)
+    math(EXPR _tip_padding_length "${WIDTH} - ${_tip_length}")
+    string(REPEAT " " ${_tip_padding_length} _tip_padding)
+  endif()
+  if(RIGHT_ALIGN)
+    set(_tip_cell "${_tip_padding}${VALUE}  ")
+  else()
+    set(_tip_cell "${VALUE}${_tip_padding}  ")
+  endif()
+  set(${OUT_VAR}
+      "${${OUT_VAR}}${_tip_cell}"
+      PARENT_SCOPE)
+endfunction()
+
+# ~~~
+# Measure every header listed in the inputs file written by _tip_add_header_cost_target() and write the report.
+#
+# API:
+#   _tip_run_header_cost_report(<inputs_file>)
+# ~~~
+function(_tip_run_header_cost_report INPUTS_FILE)
+  include("${INPUTS_FILE}")
+  file(REMOVE_RECURSE "${_tip_header_cost_work_dir}")
+  file(MAKE_DIRECTORY "${_tip_header_cost_work_dir}")
+
+  set(_tip_rows "")
+  set(_tip_not_self_contained "")
+  set(_tip_index 0)
+  foreach(_tip_target IN LISTS _tip_header_cost_targets)
+    set(_tip_flags ${_tip_header_cost_base_flags} ${_tip_header_cost_${_tip_target}_flags})
+    list(REMOVE_ITEM _tip_flags "-I" "/I" "-D" "/D")
+    list(LENGTH _tip_header_cost_${_tip_target}_headers _tip_header_count)
+    math(EXPR _tip_last_header "${_tip_header_count} - 1")
+    foreach(_tip_header_index RANGE ${_tip_last_header})
+      list(GET _tip_header_cost_${_tip_target}_headers ${_tip_header_index} _tip_header)
+      list(GET _tip_header_cost_${_tip_target}_names ${_tip_header_index} _tip_name)
+      math(EXPR _tip_index "${_tip_index} + 1")
+      set(_tip_unit "${_tip_header_cost_work_dir}/${_tip_index}.${_tip_header_cost_extension}")
+      file(WRITE "${_tip_unit}" "#include \"${_tip_header}\"\n")
+
+      if(_tip_header_cost_frontend STREQUAL "MSVC")
+        set(_tip_syntax_args /nologo /Zs)
+        set(_tip_preprocess_args /nologo /E /showIncludes)
+        string(REGEX REPLACE "([][+.*?^$()|\\\\])" "\\\\\\1" _tip_include_pattern "${_tip_header_cost_show_includes_prefix}")
+      else()
+        set(_tip_syntax_args -fsyntax-only)
+        set(_tip_preprocess_args -E -H)
+        set(_tip_include_pattern "\\.+ ")
+      endif()
+
+      # Syntax-only compile: frontend time and self-containment
+      string(TIMESTAMP _tip_begin "%s%f" UTC)
+      execute_process(
+        COMMAND "${_tip_header_cost_compiler}" ${_tip_flags} ${_tip_syntax_args} "${_tip_unit}"
+        WORKING_DIRECTORY "${_tip_header_cost_work_dir}"
+        RESULT_VARIABLE _tip_result
+        OUTPUT_VARIABLE _tip_diagnostics
+        ERROR_VARIABLE _tip_diagnostics)
+      string(TIMESTAMP _tip_end "%s%f" UTC)
+      math(EXPR _tip_elapsed "${_tip_end} - ${_tip_begin}")
+      set(_tip_self_contained yes)
+      if(NOT _tip_result EQUAL 0)
+        set(_tip_self_contained no)
+        file(WRITE "${_tip_header_cost_work_dir}/${_tip_index}.log" "${_tip_diagnostics}")
+        list(APPEND _tip_not_self_contained "${_tip_name} (${_tip_header_cost_work_dir}/${_tip_index}.log)")
+      endif()
+
+      # Preprocess: lines of code left after preprocessing and headers included on the way
+      execute_process(
+        COMMAND "${_tip_header_cost_compiler}" ${_tip_flags} ${_tip_preprocess_args} "${_tip_unit}"
+        WORKING_DIRECTORY "${_tip_header_cost_work_dir}"
+        OUTPUT_FILE "${_tip_header_cost_work_dir}/${_tip_index}.i"
+        ERROR_VARIABLE _tip_include_trace
+        RESULT_VARIABLE _tip_result)
+      file(READ "${_tip_header_cost_work_dir}/${_tip_index}.i" _tip_preprocessed)
+      file(REMOVE "${_tip_header_cost_work_dir}/${_tip_index}.i")
+      # Only line starts that are not directives or blank are counted. Semicolons and square brackets would change how
+      # the match list splits, and a ^ anchor would match again wherever MATCHALL resumes, so they are replaced and
+      # every line is matched by its preceding newline.
+      string(REGEX REPLACE "[][;]" "_" _tip_preprocessed "\n${_tip_preprocessed}")
+      string(REGEX MATCHALL "\n[ \t]*[^#\n \t\r]" _tip_code_lines "${_tip_preprocessed}")
+      list(LENGTH _tip_code_lines _tip_line_count)
+      string(REGEX MATCHALL "\n${_tip_include_pattern}" _tip_includes "\n${_tip_include_trace}")
+      list(LENGTH _tip_includes _tip_include_count)
+      # The header itself is the first include of the translation unit
+      if(_tip_include_count GREATER 0)
+        math(EXPR _tip_include_count "${_tip_include_count} - 1")
+      endif()
+
+      list(APPEND _tip_rows "${_tip_elapsed}|${_tip_line_count}|${_tip_include_count}|${_tip_self_contained}|${_tip_target}|${_tip_name}")
+    endforeach()
+  endforeach()
+  list(SORT _tip_rows COMPARE NATURAL ORDER DESCENDING)
+
+  set(_tip_report "# Compile cost of the headers of export '${_tip_header_cost_export}' (${_tip_header_cost_compiler_label}), slowest first\n")
+  set(_tip_row "")
+  _tip_header_cost_append_cell(_tip_row 12 frontend_ms TRUE)
+  _tip_header_cost_append_cell(_tip_row 10 lines TRUE)
+  _tip_header_cost_append_cell(_tip_row 9 includes TRUE)
+  _tip_header_cost_append_cell(_tip_row 14 self_contained FALSE)
+  _tip_header_cost_append_cell(_tip_row 24 target FALSE)
+  string(APPEND _tip_report "${_tip_row}header\n")
+  foreach(_tip_entry IN LISTS _tip_rows)
+    string(REPLACE "|" ";" _tip_fields "${_tip_entry}")
+    list(GET _tip_fields 0 _tip_elapsed)
+    math(EXPR _tip_ms "${_tip_elapsed} / 1000")
+    math(EXPR _tip_tenths "(${_tip_elapsed} % 1000) / 100")
+    list(GET _tip_fields 1 _tip_line_count)
+    list(GET _tip_fields 2 _tip_include_count)
+    list(GET _tip_fields 3 _tip_self_contained)
+    list(GET _tip_fields 4 _tip_target)
+    list(GET _tip_fields 5 _tip_name)
+    set(_tip_row "")
+    _tip_header_cost_append_cell(_tip_row 12 "${_tip_ms}.${_tip_tenths}" TRUE)
+    _tip_header_cost_append_cell(_tip_row 10 "${_tip_line_count}" TRUE)
+    _tip_header_cost_append_cell(_tip_row 9 "${_tip_include_count}" TRUE)
+    _tip_header_cost_append_cell(_tip_row 14 "${_tip_self_contained}" FALSE)
+    _tip_header_cost_append_cell(_tip_row 24 "${_tip_target}" FALSE)
+    string(APPEND _tip_report "${_tip_row}${_tip_name}\n")
+  endforeach()
+  file(WRITE "${_tip_header_cost_report}" "${_tip_report}")
+  message(STATUS "Header compile-cost report for export '${_tip_header_cost_export}': ${_tip_header_cost_report}")
+
+  if(_tip_not_self_contained)
+    list(JOIN _tip_not_self_contained "\n  " _tip_not_self_contained)
+    message(FATAL_ERROR "Headers of export '${_tip_header_cost_export}' that do not compile on their own:\n  ${_tip_not_self_contained}")
+  endif()
+endfunction()
+
+if(CMAKE_SCRIPT_MODE_FILE AND DEFINED TIP_HEADER_COST_INPUTS)
+  _tip_run_header_cost_report("${TIP_HEADER_COST_INPUTS}")
+endif()
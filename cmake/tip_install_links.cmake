@@ -0,0 +1,299 @@
+cmake_minimum_required(VERSION 3.25)
+
+# ~~~
+# Rules that run ahead of the install() rules finalize_package() generates, loaded by
+# _tip_load_feature_module(tip_install_links) when an export is finalized with TIP_INSTALL_LINK_MODE or
+# INSTALL_MANIFEST, and included again by the install(CODE) rules it adds. Each rule runs just before the install()
+# rule for the same files. With INSTALL_MANIFEST it first keeps installed files whose content is unchanged (see
+# cmake/tip_install_manifest.cmake), then with a link mode it links the rest:
+#
+#   cmake -DTIP_INSTALL_LINK_MODE=<copy|reflink|hardlink> ...
+#
+# A linked file is a copy-on-write clone (reflink) or a hardlink of the source file at its installed path. The clone or
+# link carries the source's timestamps, so the file(INSTALL) that follows reports it up to date instead of copying it,
+# and still sets its permissions and records it in the install manifest. Where a link cannot be made the file is left
+# to that copy:
+#
+#   reflink  - `cp --reflink=always` (Linux: btrfs, XFS, bcachefs) or `cp -c` (macOS: APFS), else copy
+#   hardlink - hardlink, else reflink, else copy
+#
+# Binaries that the install rewrites in place (RPATH changes, --strip, ranlib on Apple) are never hardlinked, since
+# that would rewrite the build output: executables, shared and module libraries outside Windows, and static
+# libraries on Apple. A hardlinked file shares its permissions with the source, so the install's chmod applies to both;
+# files outside CMAKE_BINARY_DIR, such as headers and data in the source tree, are therefore never hardlinked either.
+#
+# The environment variable TIP_INSTALL_LINK_MODE overrides the configured mode for one install, for example
+# `TIP_INSTALL_LINK_MODE=copy cmake --install build`. CMAKE_INSTALL_ALWAYS disables linking, because it makes
+# file(INSTALL) copy onto the link. An install over a prefix with links from an earlier run keeps them while the
+# sources are unchanged; install into a fresh prefix when switching a prefix to plain copies. Code that runs at
+# install time cannot use project_log().
+# ~~~
+
+# ~~~
+# Add the rules for the binary, HEADERS file sets and PUBLIC_HEADER files of TARGET_NAME. Called by finalize_package()
+# before the install(TARGETS) rule of the target, and reads its variables: _tip_cfgdir, INCLUDE_DESTINATION and the
+# TARGET_*_COMPONENT_ARGS lists, besides the ones _tip_add_pre_install_rule() reads.
+# ~~~
+function(_tip_add_target_pre_install_rules TARGET_NAME)
+  get_target_property(_tip_type ${TARGET_NAME} TYPE)
+  get_target_property(_tip_framework ${TARGET_NAME} FRAMEWORK)
+  get_target_property(_tip_bundle ${TARGET_NAME} MACOSX_BUNDLE)
+  if(WIN32 OR CYGWIN)
+    set(_tip_dll_platform TRUE)
+  else()
+    set(_tip_dll_platform FALSE)
+  endif()
+
+  if(NOT _tip_framework AND NOT _tip_bundle)
+    set(_tip_binary_args "")
+    if(_tip_type STREQUAL "STATIC_LIBRARY")
+      set(_tip_binary_args DESTINATION "${_tip_cfgdir}${CMAKE_INSTALL_LIBDIR}" ${TARGET_DEV_COMPONENT_ARGS})
+      if(APPLE)
+        list(APPEND _tip_binary_args NO_HARDLINK)
+      endif()
+    elseif(_tip_type STREQUAL "SHARED_LIBRARY" AND _tip_dll_platform)
+      set(_tip_binary_args DESTINATION "${_tip_cfgdir}${CMAKE_INSTALL_BINDIR}" ${TARGET_RUNTIME_COMPONENT_ARGS})
+    elseif(_tip_type STREQUAL "SHARED_LIBRARY" OR _tip_type STREQUAL "MODULE_LIBRARY")
+      set(_tip_binary_args DESTINATION "${_tip_cfgdir}${CMAKE_INSTALL_LIBDIR}" ${TARGET_RUNTIME_COMPONENT_ARGS})
+    elseif(_tip_type STREQUAL "EXECUTABLE")
+      set(_tip_binary_args DESTINATION "${_tip_cfgdir}${CMAKE_INSTALL_BINDIR}" ${TARGET_RUNTIME_COMPONENT_ARGS})
+    endif()
+    if(_tip_binary_args)
+      if(NOT _tip_type STREQUAL "STATIC_LIBRARY" AND NOT _tip_dll_platform)
+        list(APPEND _tip_binary_args NO_HARDLINK)
+      endif()
+      _tip_add_pre_install_rule(${_tip_binary_args} FILES "$<TARGET_FILE:${TARGET_NAME}>")
+    endif()
+  endif()
+
+  # Header file sets keep their path below the base directory, so files are grouped by installed directory
+  get_target_property(_tip_source_dir ${TARGET_NAME} SOURCE_DIR)
+  get_target_property(_tip_header_sets ${TARGET_NAME} INTERFACE_HEADER_SETS)
+  set(_tip_header_destinations "")
+  foreach(_tip_set IN LISTS _tip_header_sets)
+    if(_tip_set STREQUAL "HEADERS")
+      set(_tip_set_property HEADER_SET)
+      set(_tip_dirs_property HEADER_DIRS)
+    else()
+      set(_tip_set_property HEADER_SET_${_tip_set})
+      set(_tip_dirs_property HEADER_DIRS_${_tip_set})
+    endif()
+    get_target_property(_tip_set_files ${TARGET_NAME} ${_tip_set_property})
+    get_target_property(_tip_set_dirs ${TARGET_NAME} ${_tip_dirs_property})
+    if(NOT _tip_set_files OR NOT _tip_set_dirs)
+      continue()
+    endif()
+    _tip_resolve_absolute_paths(_tip_set_dirs "${_tip_source_dir}" ${_tip_set_dirs})
+    foreach(_tip_file IN LISTS _tip_set_files)
+      # Generator expressions are left to the install(TARGETS) copy
+      if(_tip_file MATCHES "\\$<")
+        continue()
+      endif()
+      _tip_resolve_absolute_paths(_tip_file "${_tip_source_dir}" "${_tip_file}")
+      foreach(_tip_dir IN LISTS _tip_set_dirs)
+        cmake_path(IS_PREFIX _tip_dir "${_tip_file}" NORMALIZE _tip_in_dir)
+        if(_tip_in_dir)
+          cmake_path(RELATIVE_PATH _tip_file BASE_DIRECTORY "${_tip_dir}" OUTPUT_VARIABLE _tip_relative)
+          cmake_path(GET _tip_relative PARENT_PATH _tip_relative_dir)
+          set(_tip_destination "${INCLUDE_DESTINATION}")
+          if(_tip_relative_dir)
+            string(APPEND _tip_destination "/${_tip_relative_dir}")
+          endif()
+          string(MD5 _tip_key "${_tip_destination}")
+          if(NOT _tip_key IN_LIST _tip_header_destinations)
+            list(APPEND _tip_header_destinations "${_tip_key}")
+            set(_tip_header_destination_${_tip_key} "${_tip_destination}")
+            set(_tip_header_files_${_tip_key} "")
+          endif()
+          list(APPEND _tip_header_files_${_tip_key} "${_tip_file}")
+          break()
+        endif()
+      endforeach()
+    endforeach()
+  endforeach()
+  foreach(_tip_key IN LISTS _tip_header_destinations)
+    _tip_add_pre_install_rule(DESTINATION "${_tip_header_destination_${_tip_key}}" ${TARGET_DEV_COMPONENT_ARGS} FILES ${_tip_header_files_${_tip_key}})
+  endforeach()
+
+  get_target_property(_tip_public_headers ${TARGET_NAME} PUBLIC_HEADER)
+  if(_tip_public_headers)
+    list(FILTER _tip_public_headers EXCLUDE REGEX "\\$<")
+    _tip_resolve_absolute_paths(_tip_public_headers "${_tip_source_dir}" ${_tip_public_headers})
+    if(_tip_public_headers)
+      _tip_add_pre_install_rule(DESTINATION "${INCLUDE_DESTINATION}" ${TARGET_DEV_COMPONENT_ARGS} FILES ${_tip_public_headers})
+    endif()
+  endif()
+endfunction()
+
+# ~~~
+# Add one install(CODE) rule for FILES installed to DESTINATION, ahead of the install() rule that follows it. Reads the
+# finalize_package() variables _tip_install_link_mode, _tip_content_store, INSTALL_MANIFEST, ARG_EXPORT_NAME and
+# CURRENT_BINARY_DIR. Files of a content_store export are never hardlinked, since the store would then share the build
+# and source files. Files outside CMAKE_BINARY_DIR get a rule of their own with NO_HARDLINK.
+#
+# API:
+#   _tip_add_pre_install_rule(DESTINATION <dest> COMPONENT <component> [NO_HARDLINK] FILES <files...>)
+# ~~~
+function(_tip_add_pre_install_rule)
+  cmake_parse_arguments(ARG "NO_HARDLINK" "DESTINATION;COMPONENT" "FILES" ${ARGN})
+  if(_tip_install_link_mode
+     AND NOT ARG_NO_HARDLINK
+     AND NOT _tip_content_store)
+    # Build outputs, given as generator expressions or below the build tree, are the only files safe to hardlink
+    set(_tip_build_files "")
+    set(_tip_other_files "")
+    foreach(_tip_file IN LISTS ARG_FILES)
+      string(FIND "${_tip_file}" "${CMAKE_BINARY_DIR}/" _tip_position)
+      if(_tip_position EQUAL 0 OR _tip_file MATCHES "^\\$<")
+        list(APPEND _tip_build_files "${_tip_file}")
+      else()
+        list(APPEND _tip_other_files "${_tip_file}")
+      endif()
+    endforeach()
+    if(_tip_other_files)
+      _tip_add_pre_install_rule(DESTINATION "${ARG_DESTINATION}" COMPONENT "${ARG_COMPONENT}" NO_HARDLINK FILES ${_tip_other_files})
+      if(NOT _tip_build_files)
+        return()
+      endif()
+      set(ARG_FILES ${_tip_build_files})
+    endif()
+  endif()
+  _tip_find_target_install_package_resource_file("tip_install_links.cmake" _tip_links_script)
+  # Joined before any bracket enters the list, since list() does not split at a ; inside [ ]
+  list(JOIN ARG_FILES "]==] [==[" _tip_files)
+  string(
+    CONCAT _tip_code
+           "if(NOT COMMAND _tip_link_install_files)\n"
+           "  include([==[${_tip_links_script}]==])\n"
+           "endif()\n"
+           "set(_tip_install_files [==[${_tip_files}]==])\n")
+  if(INSTALL_MANIFEST)
+    _tip_find_target_install_package_resource_file("tip_install_manifest.cmake" _tip_manifest_script)
+    string(
+      CONCAT _tip_code
+             "${_tip_code}"
+             "if(NOT COMMAND _tip_keep_unchanged_install_files)\n"
+             "  include([==[${_tip_manifest_script}]==])\n"
+             "endif()\n"
+             "_tip_keep_unchanged_install_files(_tip_install_files EXPORT [==[${ARG_EXPORT_NAME}]==] "
+             "STATE_DIR [==[${CURRENT_BINARY_DIR}/CMakeFiles/tip-install-state]==] DESTINATION [==[${ARG_DESTINATION}]==])\n")
+  endif()
+  if(_tip_install_link_mode)
+    set(_tip_options "")
+    if(ARG_NO_HARDLINK OR _tip_content_store)
+      set(_tip_options " NO_HARDLINK")
+    endif()
+    string(APPEND _tip_code "_tip_link_install_files(MODE ${_tip_install_link_mode}${_tip_options} DESTINATION [==[${ARG_DESTINATION}]==] FILES \${_tip_install_files})\n")
+  endif()
+  install(CODE "${_tip_code}" COMPONENT "${ARG_COMPONENT}")
+endfunction()
+
+# ~~~
+# Install time: the directory DESTINATION is installed to, relative to CMAKE_INSTALL_PREFIX and below DESTDIR like the
+# install() rules.
+# ~~~
+function(_tip_install_destination_dir OUT_VAR DESTINATION)
+  if(IS_ABSOLUTE "${DESTINATION}")
+    set(_tip_dir "${DESTINATION}")
+  else()
+    set(_tip_dir "${CMAKE_INSTALL_PREFIX}/${DESTINATION}")
+  endif()
+  if(NOT "$ENV{DESTDIR}" STREQUAL "")
+    # file(INSTALL) drops the drive letter of a Windows path below DESTDIR
+    if(_tip_dir MATCHES "^[A-Za-z]:")
+      string(SUBSTRING "${_tip_dir}" 2 -1 _tip_dir)
+    endif()
+    set(_tip_dir "$ENV{DESTDIR}${_tip_dir}")
+  endif()
+  cmake_path(ABSOLUTE_PATH _tip_dir NORMALIZE)
+  set(${OUT_VAR}
+      "${_tip_dir}"
+      PARENT_SCOPE)
+endfunction()
+
+# ~~~
+# Install time: place a reflink or hardlink of each of FILES in the directory DESTINATION is installed to. Files that
+# cannot be linked are left for the install() rule to copy.
+#
+# API:
+#   _tip_link_install_files(MODE <reflink|hardlink> [NO_HARDLINK] DESTINATION <dest> FILES <files...>)
+# ~~~
+function(_tip_link_install_files)
+  cmake_parse_arguments(ARG "NO_HARDLINK" "MODE;DESTINATION" "FILES" ${ARGN})
+  set(_tip_mode "${ARG_MODE}")
+  if(NOT "$ENV{TIP_INSTALL_LINK_MODE}" STREQUAL "")
+    string(TOLOWER "$ENV{TIP_INSTALL_LINK_MODE}" _tip_mode)
+  endif()
+  if(_tip_mode STREQUAL "copy" OR NOT "$ENV{CMAKE_INSTALL_ALWAYS}" STREQUAL "")
+    return()
+  endif()
+  if(NOT _tip_mode MATCHES "^(reflink|hardlink)$")
+    message(FATAL_ERROR "Invalid TIP_INSTALL_LINK_MODE '${_tip_mode}'. Valid values: copy, reflink, hardlink")
+  endif()
+
+  if(NOT ARG_FILES)
+    return()
+  endif()
+  _tip_install_destination_dir(_tip_dir "${ARG_DESTINATION}")
+  file(MAKE_DIRECTORY "${_tip_dir}")
+
+  if(CMAKE_INSTALL_MESSAGE STREQUAL "NEVER")
+    set(_tip_report FALSE)
+  else()
+    set(_tip_report TRUE)
+  endif()
+
+  set(_tip_clone_sources "")
+  set(_tip_clone_targets "")
+  foreach(_tip_file IN LISTS ARG_FILES)
+    # Missing sources are reported by the install() rule
+    if(NOT EXISTS "${_tip_file}" OR IS_DIRECTORY "${_tip_file}")
+      continue()
+    endif()
+    cmake_path(GET _tip_file FILENAME _tip_name)
+    set(_tip_target "${_tip_dir}/${_tip_name}")
+    file(REMOVE "${_tip_target}")
+    if(_tip_mode STREQUAL "hardlink" AND NOT ARG_NO_HARDLINK)
+      file(CREATE_LINK "${_tip_file}" "${_tip_target}" RESULT _tip_link_result)
+      if(_tip_link_result EQUAL 0)
+        if(_tip_report)
+          message(STATUS "Hardlinked: ${_tip_target}")
+        endif()
+        continue()
+      endif()
+    endif()
+    list(APPEND _tip_clone_sources "${_tip_file}")
+    list(APPEND _tip_clone_targets "${_tip_target}")
+  endforeach()
+
+  # One cp per destination directory. The first failure turns cloning off for the rest of the install, so a prefix
+  # without reflink support costs one failed cp.
+  get_property(_tip_clone_unsupported GLOBAL PROPERTY _TIP_INSTALL_REFLINK_UNSUPPORTED)
+  if(NOT _tip_clone_sources
+     OR _tip_clone_unsupported
+     OR CMAKE_HOST_WIN32)
+    return()
+  endif()
+  if(CMAKE_HOST_APPLE)
+    set(_tip_clone_command cp -c -p)
+  else()
+    set(_tip_clone_command cp --reflink=always --preserve=mode,timestamps)
+  endif()
+  execute_process(
+    COMMAND ${_tip_clone_command} ${_tip_clone_sources} "${_tip_dir}/"
+    RESULT_VARIABLE _tip_clone_result
+    OUTPUT_QUIET ERROR_QUIET)
+  if(NOT _tip_clone_result EQUAL 0)
+    file(REMOVE ${_tip_clone_targets})
+    set_property(GLOBAL PROPERTY _TIP_INSTALL_REFLINK_UNSUPPORTED TRUE)
+    if(_tip_report)
+      message(STATUS "Reflinks are not supported for ${_tip_dir}, copying")
+    endif()
+    return()
+  endif()
+  if(_tip_report)
+    foreach(_tip_target IN LISTS _tip_clone_targets)
+      message(STATUS "Reflinked: ${_tip_target}")
+    endforeach()
+  endif()
+endfunction()
@@ -0,0 +1,304 @@
+cmake_minimum_required(VERSION 3.25)
+
+# ~~~
+# Content-hash install manifests for finalize_package(INSTALL_MANIFEST). The install(CODE) rules finalize_package() adds
+# include this module in the install script: one ahead of the export's install() rules marks where its files begin in
+# CMAKE_INSTALL_MANIFEST_FILES, one after them writes the manifest, and the rules of cmake/tip_install_links.cmake keep
+# installed files whose content is unchanged. Each install writes
+#
+#   <CMAKE_CONFIG_DESTINATION>/<Export>.manifest              (cmake --install <build>)
+#   <CMAKE_CONFIG_DESTINATION>/<Export>-<Component>.manifest  (cmake --install <build> --component <Component>)
+#
+# with one line per installed file, sorted by path: SHA-256, size in bytes, octal mode and the path relative to the
+# prefix, separated by tabs. A symbolic link is listed as `link:<target>` with size 0 and mode `-`. Deploy tools diff
+# the manifests of two installs and push only the lines that changed. The manifest is rewritten only when its content
+# changes.
+#
+# A rebuild that produces the same bytes still gives a file a new timestamp, which makes file(INSTALL) copy it again.
+# Ahead of the copy, a file whose installed content matches is given the timestamp of its source instead, so the install
+# reports it up to date and leaves it alone. A file whose content differs is removed, so it is copied even when the two
+# timestamps are less than the second apart that file(INSTALL) needs to see a change. Binaries whose installed copy is
+# rewritten (RPATH changes) match by the source and installed hashes that earlier installs recorded in
+# CMakeFiles/tip-install-state of the export's build directory. Windows has no timestamp copy here, so files there are
+# compared but installed as before. Code that runs at install time cannot use project_log().
+# ~~~
+
+if(NOT COMMAND _tip_install_destination_dir)
+  include("${CMAKE_CURRENT_LIST_DIR}/tip_install_links.cmake")
+endif()
+
+# ~~~
+# Install time: load the source and installed hash pairs recorded for EXPORT_NAME in STATE_DIR once per install.
+# ~~~
+function(_tip_load_install_state STATE_DIR EXPORT_NAME)
+  get_property(_tip_loaded GLOBAL PROPERTY "_TIP_INSTALL_STATE_LOADED_${EXPORT_NAME}")
+  if(_tip_loaded)
+    return()
+  endif()
+  set_property(GLOBAL PROPERTY "_TIP_INSTALL_STATE_LOADED_${EXPORT_NAME}" TRUE)
+  file(GLOB _tip_state_files "${STATE_DIR}/${EXPORT_NAME}-*.txt")
+  foreach(_tip_state_file IN LISTS _tip_state_files)
+    file(STRINGS "${_tip_state_file}" _tip_state_lines)
+    foreach(_tip_state_line IN LISTS _tip_state_lines)
+      if(_tip_state_line MATCHES "^([^\t]+)\t([0-9a-f]+)\t([0-9a-f]+)$")
+        set_property(GLOBAL APPEND PROPERTY "_TIP_INSTALL_STATE_${CMAKE_MATCH_1}" "${CMAKE_MATCH_2}|${CMAKE_MATCH_3}")
+      endif()
+    endforeach()
+  endforeach()
+endfunction()
+
+# ~~~
+# Install time: remove from the list FILES_VAR the files whose installed copy in DESTINATION has the same content, after
+# giving that copy the timestamp of its source, so the install() rule that follows reports them up to date. The source
+# hash of every file is kept for _tip_write_install_manifest().
+#
+# API:
+#   _tip_keep_unchanged_install_files(<files_var> EXPORT <export> STATE_DIR <dir> DESTINATION <dest>)
+# ~~~
+function(_tip_keep_unchanged_install_files FILES_VAR)
+  cmake_parse_arguments(ARG "" "EXPORT;STATE_DIR;DESTINATION" "" ${ARGN})
+  if("${${FILES_VAR}}" STREQUAL "")
+    return()
+  endif()
+  _tip_install_destination_dir(_tip_dir "${ARG_DESTINATION}")
+  _tip_load_install_state("${ARG_STATE_DIR}" "${ARG_EXPORT}")
+
+  set(_tip_remaining "")
+  set(_tip_sync_sources "")
+  set(_tip_sync_targets "")
+  foreach(_tip_file IN LISTS ${FILES_VAR})
+    if(IS_DIRECTORY "${_tip_file}" OR NOT EXISTS "${_tip_file}")
+      list(APPEND _tip_remaining "${_tip_file}")
+      continue()
+    endif()
+    cmake_path(GET _tip_file FILENAME _tip_name)
+    set(_tip_target "${_tip_dir}/${_tip_name}")
+    file(SHA256 "${_tip_file}" _tip_source_hash)
+    set_property(GLOBAL PROPERTY "_TIP_INSTALL_SOURCE_HASH_${_tip_target}" "${_tip_source_hash}")
+    if(NOT EXISTS "${_tip_target}" OR IS_SYMLINK "${_tip_target}" OR IS_DIRECTORY "${_tip_target}")
+      list(APPEND _tip_remaining "${_tip_file}")
+      continue()
+    endif()
+    file(SHA256 "${_tip_target}" _tip_target_hash)
+    get_property(_tip_recorded GLOBAL PROPERTY "_TIP_INSTALL_STATE_${_tip_target}")
+    if(NOT _tip_target_hash STREQUAL _tip_source_hash AND NOT "${_tip_source_hash}|${_tip_target_hash}" IN_LIST _tip_recorded)
+      # file(INSTALL) takes timestamps less than a second apart as equal; the changed file must be copied
+      file(REMOVE "${_tip_target}")
+      list(APPEND _tip_remaining "${_tip_file}")
+      continue()
+    endif()
+    set_property(GLOBAL PROPERTY "_TIP_INSTALL_HASH_${_tip_target}" "${_tip_target_hash}")
+    file(TIMESTAMP "${_tip_file}" _tip_source_time "%s%f" UTC)
+    file(TIMESTAMP "${_tip_target}" _tip_target_time "%s%f" UTC)
+    if(_tip_source_time STREQUAL _tip_target_time)
+      continue()
+    endif()
+    if(CMAKE_HOST_WIN32)
+      list(APPEND _tip_remaining "${_tip_file}")
+    else()
+      list(APPEND _tip_sync_sources "${_tip_file}")
+      list(APPEND _tip_sync_targets "${_tip_target}")
+    endif()
+  endforeach()
+
+  if(_tip_sync_sources)
+    # GNU cp copies the timestamps of all files in one process; elsewhere touch -r does it per file
+    execute_process(
+      COMMAND cp --attributes-only --preserve=timestamps ${_tip_sync_sources} "${_tip_dir}/"
+      RESULT_VARIABLE _tip_result
+      OUTPUT_QUIET ERROR_QUIET)
+    set(_tip_index 0)
+    foreach(_tip_file IN LISTS _tip_sync_sources)
+      list(GET _tip_sync_targets ${_tip_index} _tip_target)
+      math(EXPR _tip_index "${_tip_index} + 1")
+      if(NOT _tip_result EQUAL 0)
+        execute_process(
+          COMMAND touch -r "${_tip_file}" "${_tip_target}"
+          RESULT_VARIABLE _tip_touch_result
+          OUTPUT_QUIET ERROR_QUIET)
+        if(NOT _tip_touch_result EQUAL 0)
+          list(APPEND _tip_remaining "${_tip_file}")
+          continue()
+        endif()
+      endif()
+      if(NOT CMAKE_INSTALL_MESSAGE STREQUAL "NEVER")
+        message(STATUS "Unchanged: ${_tip_target}")
+      endif()
+    endforeach()
+  endif()
+
+  set(${FILES_VAR}
+      "${_tip_remaining}"
+      PARENT_SCOPE)
+endfunction()
+
+# ~~~
+# Install time: mark where the files of EXPORT_NAME begin in CMAKE_INSTALL_MANIFEST_FILES, for the manifest and for
+# the content store of cmake/tip_content_store.cmake.
+# ~~~
+macro(_tip_begin_install_manifest EXPORT_NAME)
+  list(LENGTH CMAKE_INSTALL_MANIFEST_FILES "_TIP_INSTALL_MANIFEST_BEGIN_${EXPORT_NAME}")
+endmacro()
+
+# ~~~
+# Install time: set OUT_VAR to the files installed for EXPORT_NAME since _tip_begin_install_manifest(), each once.
+# ~~~
+function(_tip_installed_export_files OUT_VAR EXPORT_NAME)
+  set(_tip_begin "${_TIP_INSTALL_MANIFEST_BEGIN_${EXPORT_NAME}}")
+  if("${_tip_begin}" STREQUAL "")
+    set(_tip_begin 0)
+  endif()
+  list(LENGTH CMAKE_INSTALL_MANIFEST_FILES _tip_end)
+  set(_tip_files "")
+  if(_tip_end GREATER _tip_begin)
+    math(EXPR _tip_length "${_tip_end} - ${_tip_begin}")
+    list(SUBLIST CMAKE_INSTALL_MANIFEST_FILES ${_tip_begin} ${_tip_length} _tip_files)
+    list(REMOVE_DUPLICATES _tip_files)
+  endif()
+  set(${OUT_VAR}
+      "${_tip_files}"
+      PARENT_SCOPE)
+endfunction()
+
+# ~~~
+# Install time: set OUT_VAR to the octal modes of the regular files in ARGN, in order, from one stat process (GNU stat,
+# then BSD stat). OUT_VAR is empty on Windows or when stat is not available.
+# ~~~
+function(_tip_installed_file_modes OUT_VAR)
+  set(_tip_modes "")
+  if(ARGN AND NOT CMAKE_HOST_WIN32)
+    foreach(_tip_stat_format IN ITEMS "-c;%a" "-f;%Lp")
+      execute_process(
+        COMMAND stat ${_tip_stat_format} ${ARGN}
+        RESULT_VARIABLE _tip_result
+        OUTPUT_VARIABLE _tip_stat_output
+        ERROR_QUIET)
+      if(_tip_result EQUAL 0)
+        string(STRIP "${_tip_stat_output}" _tip_stat_output)
+        string(REPLACE "\n" ";" _tip_modes "${_tip_stat_output}")
+        break()
+      endif()
+    endforeach()
+  endif()
+  list(LENGTH ARGN _tip_file_count)
+  list(LENGTH _tip_modes _tip_mode_count)
+  if(NOT _tip_mode_count EQUAL _tip_file_count)
+    set(_tip_modes "")
+  endif()
+  set(${OUT_VAR}
+      "${_tip_modes}"
+      PARENT_SCOPE)
+endfunction()
+
+# ~~~
+# Install time: write the manifest of the files installed for EXPORT_NAME since _tip_begin_install_manifest(), record
+# the source and installed hashes of the files that had a source in STATE_DIR, and add the manifest to
+# CMAKE_INSTALL_MANIFEST_FILES.
+#
+# API:
+#   _tip_write_install_manifest(EXPORT <export> STATE_DIR <dir> DESTINATION <config_dest>)
+# ~~~
+function(_tip_write_install_manifest)
+  cmake_parse_arguments(ARG "" "EXPORT;STATE_DIR;DESTINATION" "" ${ARGN})
+  _tip_installed_export_files(_tip_files "${ARG_EXPORT}")
+
+  _tip_install_destination_dir(_tip_root "")
+  string(REGEX REPLACE "/+$" "" _tip_root "${_tip_root}")
+  set(_tip_paths "")
+  foreach(_tip_file IN LISTS _tip_files)
+    cmake_path(IS_PREFIX _tip_root "${_tip_file}" NORMALIZE _tip_in_prefix)
+    if(_tip_in_prefix)
+      cmake_path(RELATIVE_PATH _tip_file BASE_DIRECTORY "${_tip_root}" OUTPUT_VARIABLE _tip_path)
+    else()
+      set(_tip_path "${_tip_file}")
+    endif()
+    set(_tip_file_${_tip_path} "${_tip_file}")
+    list(APPEND _tip_paths "${_tip_path}")
+  endforeach()
+  if(NOT _tip_paths)
+    # Nothing of this export is in the component being installed
+    return()
+  endif()
+  list(SORT _tip_paths)
+
+  set(_tip_regular_files "")
+  foreach(_tip_path IN LISTS _tip_paths)
+    if(NOT IS_SYMLINK "${_tip_file_${_tip_path}}" AND EXISTS "${_tip_file_${_tip_path}}")
+      list(APPEND _tip_regular_files "${_tip_file_${_tip_path}}")
+    endif()
+  endforeach()
+  _tip_installed_file_modes(_tip_modes ${_tip_regular_files})
+
+  set(_tip_manifest "# ${ARG_EXPORT} install manifest: sha256, size, mode, path relative to the install prefix\n")
+  set(_tip_state "")
+  set(_tip_state_targets "")
+  set(_tip_regular_index 0)
+  foreach(_tip_path IN LISTS _tip_paths)
+    set(_tip_file "${_tip_file_${_tip_path}}")
+    if(IS_SYMLINK "${_tip_file}")
+      file(READ_SYMLINK "${_tip_file}" _tip_link_target)
+      string(APPEND _tip_manifest "link:${_tip_link_target}\t0\t-\t${_tip_path}\n")
+      continue()
+    endif()
+    if(NOT EXISTS "${_tip_file}")
+      continue()
+    endif()
+    get_property(_tip_hash GLOBAL PROPERTY "_TIP_INSTALL_HASH_${_tip_file}")
+    if(NOT _tip_hash)
+      file(SHA256 "${_tip_file}" _tip_hash)
+      set_property(GLOBAL PROPERTY "_TIP_INSTALL_HASH_${_tip_file}" "${_tip_hash}")
+    endif()
+    file(SIZE "${_tip_file}" _tip_size)
+    set(_tip_mode "-")
+    if(_tip_modes)
+      list(GET _tip_modes ${_tip_regular_index} _tip_mode)
+    endif()
+    math(EXPR _tip_regular_index "${_tip_regular_index} + 1")
+    string(APPEND _tip_manifest "${_tip_hash}\t${_tip_size}\t${_tip_mode}\t${_tip_path}\n")
+    get_property(_tip_source_hash GLOBAL PROPERTY "_TIP_INSTALL_SOURCE_HASH_${_tip_file}")
+    if(_tip_source_hash)
+      string(APPEND _tip_state "${_tip_file}\t${_tip_source_hash}\t${_tip_hash}\n")
+      list(APPEND _tip_state_targets "${_tip_file}")
+    endif()
+  endforeach()
+
+  if(CMAKE_INSTALL_COMPONENT)
+    set(_tip_manifest_name "${ARG_EXPORT}-${CMAKE_INSTALL_COMPONENT}.manifest")
+    set(_tip_state_name "${ARG_EXPORT}-${CMAKE_INSTALL_COMPONENT}.txt")
+  else()
+    set(_tip_manifest_name "${ARG_EXPORT}.manifest")
+    set(_tip_state_name "${ARG_EXPORT}-all.txt")
+  endif()
+  _tip_install_destination_dir(_tip_manifest_dir "${ARG_DESTINATION}")
+  set(_tip_manifest_file "${_tip_manifest_dir}/${_tip_manifest_name}")
+  set(_tip_previous "")
+  if(EXISTS "${_tip_manifest_file}")
+    file(READ "${_tip_manifest_file}" _tip_previous)
+  endif()
+  if(NOT _tip_previous STREQUAL _tip_manifest)
+    # A new file, since the old one may be a hardlink into a content store
+    file(REMOVE "${_tip_manifest_file}")
+    file(WRITE "${_tip_manifest_file}" "${_tip_manifest}")
+  endif()
+  if(NOT CMAKE_INSTALL_MESSAGE STREQUAL "NEVER")
+    message(STATUS "Manifest: ${_tip_manifest_file}")
+  endif()
+  list(APPEND CMAKE_INSTALL_MANIFEST_FILES "${_tip_manifest_file}")
+  set(CMAKE_INSTALL_MANIFEST_FILES
+      "${CMAKE_INSTALL_MANIFEST_FILES}"
+      PARENT_SCOPE)
+
+  # Records of other prefixes are kept; the file is replaced whole so parallel component installs never read half of it
+  set(_tip_state_file "${ARG_STATE_DIR}/${_tip_state_name}")
+  if(EXISTS "${_tip_state_file}")
+    file(STRINGS "${_tip_state_file}" _tip_state_lines)
+    foreach(_tip_state_line IN LISTS _tip_state_lines)
+      if(_tip_state_line MATCHES "^([^\t]+)\t" AND NOT CMAKE_MATCH_1 IN_LIST _tip_state_targets)
+        string(APPEND _tip_state "${_tip_state_line}\n")
+      endif()
+    endforeach()
+  endif()
+  string(RANDOM LENGTH 8 _tip_suffix)
+  file(WRITE "${_tip_state_file}.${_tip_suffix}" "${_tip_state}")
+  file(RENAME "${_tip_state_file}.${_tip_suffix}" "${_tip_state_file}")
+endfunction()
@@ -0,0 +1,74 @@
+cmake_minimum_required(VERSION 3.25)
+
+# ~~~
+# Prefix-wide package index for TIP_PACKAGE_INDEX, loaded by _tip_load_feature_module(tip_package_index)
+# when the deferred finalization driver runs with the variable set.
+#
+# The index is a package of its own, <Index>Config.cmake, installed next to the package configs. Finding it sets
+# <Package>_DIR for every indexed package the consumer has not located yet, so each following find_package(<Package>)
+# reads the config and version file in that directory instead of probing every search prefix and path pattern.
+# finalize_package() records each export it installs a config for in _TIP_PACKAGE_INDEX_EXPORTS.
+# ~~~
+
+# ~~~
+# Write and install <Index>Config.cmake for every export recorded so far. Running again after later registrations
+# rewrites the file with the new exports and only adds install rules for components that were not covered yet.
+#
+# API:
+#   _tip_install_package_index(<index_name>)
+# ~~~
+function(_tip_install_package_index INDEX_NAME)
+  get_property(_tip_index_exports GLOBAL PROPERTY _TIP_PACKAGE_INDEX_EXPORTS)
+  if(INDEX_NAME IN_LIST _tip_index_exports)
+    project_log(FATAL_ERROR "TIP_PACKAGE_INDEX '${INDEX_NAME}' has the name of an export it would index. Choose another index name.")
+  endif()
+
+  # Entries are relative to the install prefix, found from the index location like in CMake's generated targets files
+  set(_tip_index_destination "${CMAKE_INSTALL_DATADIR}/cmake/${INDEX_NAME}")
+  if(IS_ABSOLUTE "${_tip_index_destination}")
+    set(_tip_index_prefix "${CMAKE_INSTALL_PREFIX}")
+  else()
+    file(RELATIVE_PATH _tip_index_prefix "/${_tip_index_destination}" "/")
+    string(REGEX REPLACE "/$" "" _tip_index_prefix "${_tip_index_prefix}")
+    set(_tip_index_prefix "\${CMAKE_CURRENT_LIST_DIR}/${_tip_index_prefix}")
+  endif()
+  string(
+    CONCAT
+    _tip_index_content
+    "# Generated by target_install_package: config directories of the packages installed with ${INDEX_NAME}.\n"
+    "# Packages the consumer already located (<Package>_DIR set) are left alone.\n"
+    "get_filename_component(_tip_index_prefix \"${_tip_index_prefix}\" ABSOLUTE)\n")
+  set(_tip_index_components "")
+  foreach(_tip_export IN LISTS _tip_index_exports)
+    get_property(_tip_index_entry GLOBAL PROPERTY "_TIP_PACKAGE_INDEX_${_tip_export}")
+    list(POP_FRONT _tip_index_entry _tip_config_destination _tip_version)
+    list(APPEND _tip_index_components ${_tip_index_entry})
+    if(NOT IS_ABSOLUTE "${_tip_config_destination}")
+      set(_tip_config_destination "\${_tip_index_prefix}/${_tip_config_destination}")
+    endif()
+    string(APPEND _tip_index_content "if(NOT ${_tip_export}_DIR)\n" "  set(${_tip_export}_DIR \"${_tip_config_destination}\")\n" "endif()\n"
+           "set(${INDEX_NAME}_${_tip_export}_VERSION \"${_tip_version}\")\n")
+  endforeach()
+  string(APPEND _tip_index_content "set(${INDEX_NAME}_PACKAGES \"${_tip_index_exports}\")\n" "unset(_tip_index_prefix)\n")
+
+  set(_tip_index_file "${CMAKE_BINARY_DIR}/tip-package-index/${INDEX_NAME}Config.cmake")
+  file(
+    CONFIGURE
+    OUTPUT "${_tip_index_file}"
+    CONTENT "${_tip_index_content}"
+    @ONLY)
+
+  list(REMOVE_DUPLICATES _tip_index_components)
+  foreach(_tip_component IN LISTS _tip_index_components)
+    get_property(_tip_component_installed GLOBAL PROPERTY "_TIP_PACKAGE_INDEX_INSTALLED/${_tip_component}")
+    if(NOT _tip_component_installed)
+      set_property(GLOBAL PROPERTY "_TIP_PACKAGE_INDEX_INSTALLED/${_tip_component}" TRUE)
+      install(
+        FILES "${_tip_index_file}"
+        DESTINATION "${_tip_index_destination}"
+        COMPONENT "${_tip_component}")
+    endif()
+  endforeach()
+  list(LENGTH _tip_index_exports _tip_index_count)
+  project_log(STATUS "Package index '${INDEX_NAME}' covers ${_tip_index_count} packages")
+endfunction()
@@ -0,0 +1,341 @@
+cmake_minimum_required(VERSION 3.25)
+
+# ~~~
+# Parallel component install driver. At the end of configuration target_install_package writes the launcher
+# ${CMAKE_BINARY_DIR}/tip_parallel_install.cmake, which records the components finalize_package() registered in
+# _TIP_DETECTED_COMPONENTS and runs this file as a script:
+#
+#   cmake [-DTIP_INSTALL_JOBS=<n>] [-DTIP_INSTALL_PREFIX=<dir>] [-DTIP_INSTALL_CONFIG=<config>]
+#         [-DTIP_INSTALL_STRIP=ON] [-DTIP_INSTALL_COMPONENTS=<a;b>] [-DTIP_INSTALL_FAIL_ON_CONFLICT=OFF]
+#         -P <build>/tip_parallel_install.cmake
+#
+# Each component, plus Unspecified for install() rules without a COMPONENT, is installed with
+# `cmake --install <build> --component <name>` into the same prefix. TIP_INSTALL_JOBS worker processes, by default one
+# per logical core, take components from a shared queue, so a long component does not hold back the others.
+# TIP_INSTALL_COMPONENTS replaces the detected list, for projects that also install components of their own.
+#
+# Components that install the same files must not run concurrently: one worker would replace a file while another
+# writes it, or while its install(CODE) rules read it (FLATTEN_CONFIG, INSTALL_MANIFEST, LAYOUT content_store).
+# finalize_package() records the components it gives shared files, the CONFIG_COMPONENTS of an export and the
+# ADDITIONAL_FILES_COMPONENTS of a target, in _TIP_SHARED_INSTALL_COMPONENTS; the launcher passes them on, and the
+# driver queues components that share files, directly or through another component, as one entry that a single worker
+# installs in order.
+#
+# The driver prints the time and file count of every component. Files that the install manifests of components in
+# different queue entries both list, such as those of install() rules of the project itself, were written concurrently
+# and fail the install; TIP_INSTALL_FAIL_ON_CONFLICT=OFF reports them as a warning instead. Code that runs as a script
+# cannot use project_log().
+# ~~~
+
+# ~~~
+# Write the launcher for the components registered so far. Called by the deferred finalization driver; the file is
+# only rewritten when the component list or the build directory changes.
+# ~~~
+function(_tip_write_parallel_install_launcher)
+  get_property(_tip_components GLOBAL PROPERTY "_TIP_DETECTED_COMPONENTS")
+  if(NOT _tip_components)
+    return()
+  endif()
+  get_property(_tip_shared_components GLOBAL PROPERTY "_TIP_SHARED_INSTALL_COMPONENTS")
+  list(REMOVE_DUPLICATES _tip_shared_components)
+  set(_tip_driver "${CMAKE_CURRENT_FUNCTION_LIST_FILE}")
+  string(
+    CONCAT _tip_launcher
+           "# Generated by target_install_package. Installs the components of this build tree in parallel:\n"
+           "#   cmake [-DTIP_INSTALL_JOBS=<n>] [-DTIP_INSTALL_PREFIX=<dir>] [-DTIP_INSTALL_CONFIG=<config>] -P tip_parallel_install.cmake\n"
+           "if(NOT DEFINED TIP_INSTALL_BUILD_DIR)\n"
+           "  set(TIP_INSTALL_BUILD_DIR [==[@CMAKE_BINARY_DIR@]==])\n"
+           "endif()\n"
+           "set(TIP_INSTALL_DETECTED_COMPONENTS [==[@_tip_components@]==])\n"
+           "set(TIP_INSTALL_SHARED_COMPONENTS [==[@_tip_shared_components@]==])\n"
+           "include([==[@_tip_driver@]==])\n")
+  file(
+    CONFIGURE
+    OUTPUT
+    "${CMAKE_BINARY_DIR}/tip_parallel_install.cmake"
+    CONTENT
+    "${_tip_launcher}"
+    @ONLY)
+  project_log(DEBUG "Parallel install launcher: ${CMAKE_BINARY_DIR}/tip_parallel_install.cmake (components: ${_tip_components})")
+endfunction()
+
+set(_tip_parallel_install_script "${CMAKE_CURRENT_LIST_FILE}")
+
+# Format a duration in microseconds as seconds with two decimals.
+function(_tip_parallel_install_seconds OUT_VAR MICROSECONDS)
+  math(EXPR _tip_centiseconds "${MICROSECONDS} / 10000")
+  math(EXPR _tip_whole "${_tip_centiseconds} / 100")
+  math(EXPR _tip_fraction "${_tip_centiseconds} % 100")
+  if(_tip_fraction LESS 10)
+    set(_tip_fraction "0${_tip_fraction}")
+  endif()
+  set(${OUT_VAR}
+      "${_tip_whole}.${_tip_fraction}"
+      PARENT_SCOPE)
+endfunction()
+
+function(_tip_parallel_install_pad OUT_VAR WIDTH VALUE)
+  string(LENGTH "${VALUE}" _tip_length)
+  set(_tip_padding "")
+  if(_tip_length LESS WIDTH)
+    math(EXPR _tip_padding_length "${WIDTH} - ${_tip_length}")
+    string(REPEAT " " ${_tip_padding_length} _tip_padding)
+  endif()
+  set(${OUT_VAR}
+      "${_tip_padding}${VALUE}"
+      PARENT_SCOPE)
+endfunction()
+
+# ~~~
+# Worker process: take "<index>|<component>[|<index>|<component>...]" entries from the queue until it is empty, install
+# the components of each entry in order and record "<result>|<microseconds>" in <index>.result and the install output
+# in <index>.log. Workers share the driver's terminal, so they print nothing themselves.
+# ~~~
+function(_tip_parallel_install_worker)
+  set(_tip_queue "${TIP_INSTALL_STATE_DIR}/queue.txt")
+  set(_tip_install_options "")
+  if(TIP_INSTALL_PREFIX)
+    list(APPEND _tip_install_options --prefix "${TIP_INSTALL_PREFIX}")
+  endif()
+  if(TIP_INSTALL_CONFIG)
+    list(APPEND _tip_install_options --config "${TIP_INSTALL_CONFIG}")
+  endif()
+  if(TIP_INSTALL_STRIP)
+    list(APPEND _tip_install_options --strip)
+  endif()
+
+  while(TRUE)
+    file(LOCK "${_tip_queue}.lock")
+    file(STRINGS "${_tip_queue}" _tip_entries)
+    if(NOT _tip_entries)
+      file(LOCK "${_tip_queue}.lock" RELEASE)
+      break()
+    endif()
+    list(POP_FRONT _tip_entries _tip_entry)
+    list(JOIN _tip_entries "\n" _tip_remaining)
+    file(WRITE "${_tip_queue}" "${_tip_remaining}")
+    file(LOCK "${_tip_queue}.lock" RELEASE)
+
+    string(REPLACE "|" ";" _tip_entry "${_tip_entry}")
+    while(_tip_entry)
+      list(POP_FRONT _tip_entry _tip_index _tip_component)
+      string(TIMESTAMP _tip_begin "%s%f" UTC)
+      execute_process(
+        COMMAND "${CMAKE_COMMAND}" --install "${TIP_INSTALL_BUILD_DIR}" --component "${_tip_component}" ${_tip_install_options}
+        OUTPUT_FILE "${TIP_INSTALL_STATE_DIR}/${_tip_index}.log"
+        ERROR_FILE "${TIP_INSTALL_STATE_DIR}/${_tip_index}.log"
+        RESULT_VARIABLE _tip_result)
+      string(TIMESTAMP _tip_end "%s%f" UTC)
+      math(EXPR _tip_elapsed "${_tip_end} - ${_tip_begin}")
+      file(WRITE "${TIP_INSTALL_STATE_DIR}/${_tip_index}.result" "${_tip_result}|${_tip_elapsed}")
+    endwhile()
+  endwhile()
+endfunction()
+
+# ~~~
+# Driver process: queue the components, those that share files in one entry, run the workers, then report timings,
+# failed components and files that components of different entries both installed.
+# ~~~
+function(_tip_run_parallel_install)
+  if(NOT EXISTS "${TIP_INSTALL_BUILD_DIR}/cmake_install.cmake")
+    message(FATAL_ERROR "'${TIP_INSTALL_BUILD_DIR}' is not a configured build directory")
+  endif()
+
+  if(DEFINED TIP_INSTALL_COMPONENTS)
+    set(_tip_components ${TIP_INSTALL_COMPONENTS})
+  else()
+    set(_tip_components ${TIP_INSTALL_DETECTED_COMPONENTS} Unspecified)
+  endif()
+  list(REMOVE_DUPLICATES _tip_components)
+  list(LENGTH _tip_components _tip_component_count)
+  if(_tip_component_count EQUAL 0)
+    message(FATAL_ERROR "No components to install")
+  endif()
+
+  if(DEFINED TIP_INSTALL_JOBS)
+    if(NOT TIP_INSTALL_JOBS MATCHES "^[1-9][0-9]*$")
+      message(FATAL_ERROR "TIP_INSTALL_JOBS must be a positive integer, got '${TIP_INSTALL_JOBS}'")
+    endif()
+    set(_tip_jobs ${TIP_INSTALL_JOBS})
+  else()
+    cmake_host_system_information(RESULT _tip_jobs QUERY NUMBER_OF_LOGICAL_CORES)
+  endif()
+
+  # Each component starts in an entry of its own; a set of components that share files merges their entries
+  set(_tip_entries "")
+  set(_tip_index 0)
+  foreach(_tip_component IN LISTS _tip_components)
+    set("_tip_entry_of_${_tip_component}" ${_tip_index})
+    set(_tip_entry_${_tip_index} ${_tip_index})
+    list(APPEND _tip_entries ${_tip_index})
+    math(EXPR _tip_index "${_tip_index} + 1")
+  endforeach()
+  foreach(_tip_shared IN LISTS TIP_INSTALL_SHARED_COMPONENTS)
+    string(REPLACE "|" ";" _tip_shared "${_tip_shared}")
+    set(_tip_target_entry "")
+    foreach(_tip_component IN LISTS _tip_shared)
+      if(NOT DEFINED "_tip_entry_of_${_tip_component}")
+        continue()
+      endif()
+      set(_tip_entry "${_tip_entry_of_${_tip_component}}")
+      if(_tip_target_entry STREQUAL "")
+        set(_tip_target_entry ${_tip_entry})
+      elseif(NOT _tip_entry EQUAL _tip_target_entry)
+        foreach(_tip_member IN LISTS _tip_entry_${_tip_entry})
+          list(GET _tip_components ${_tip_member} _tip_member_component)
+          set("_tip_entry_of_${_tip_member_component}" ${_tip_target_entry})
+        endforeach()
+        list(APPEND _tip_entry_${_tip_target_entry} ${_tip_entry_${_tip_entry}})
+        list(REMOVE_ITEM _tip_entries ${_tip_entry})
+      endif()
+    endforeach()
+  endforeach()
+  list(LENGTH _tip_entries _tip_entry_count)
+  if(_tip_jobs GREATER _tip_entry_count)
+    set(_tip_jobs ${_tip_entry_count})
+  endif()
+
+  set(_tip_state_dir "${TIP_INSTALL_BUILD_DIR}/CMakeFiles/tip-parallel-install")
+  file(REMOVE_RECURSE "${_tip_state_dir}")
+  file(MAKE_DIRECTORY "${_tip_state_dir}")
+  set(_tip_queue "")
+  set(_tip_sequences "")
+  foreach(_tip_entry IN LISTS _tip_entries)
+    list(SORT _tip_entry_${_tip_entry} COMPARE NATURAL)
+    set(_tip_queue_entry "")
+    set(_tip_entry_components "")
+    foreach(_tip_index IN LISTS _tip_entry_${_tip_entry})
+      list(GET _tip_components ${_tip_index} _tip_component)
+      list(APPEND _tip_queue_entry ${_tip_index} "${_tip_component}")
+      list(APPEND _tip_entry_components "${_tip_component}")
+      # A manifest left by an earlier install would be read as this run's if the component installs nothing now
+      file(REMOVE "${TIP_INSTALL_BUILD_DIR}/install_manifest_${_tip_component}.txt")
+    endforeach()
+    list(JOIN _tip_queue_entry "|" _tip_queue_entry)
+    string(APPEND _tip_queue "${_tip_queue_entry}\n")
+    list(LENGTH _tip_entry_components _tip_entry_component_count)
+    if(_tip_entry_component_count GREATER 1)
+      list(JOIN _tip_entry_components ", " _tip_entry_components)
+      string(APPEND _tip_sequences "\n  ${_tip_entry_components}")
+    endif()
+  endforeach()
+  file(WRITE "${_tip_state_dir}/queue.txt" "${_tip_queue}")
+
+  # execute_process() starts all of its COMMANDs at once
+  set(_tip_worker COMMAND "${CMAKE_COMMAND}" -DTIP_INSTALL_WORKER=ON "-DTIP_INSTALL_STATE_DIR=${_tip_state_dir}" "-DTIP_INSTALL_BUILD_DIR=${TIP_INSTALL_BUILD_DIR}")
+  foreach(_tip_option IN ITEMS TIP_INSTALL_PREFIX TIP_INSTALL_CONFIG TIP_INSTALL_STRIP)
+    if(NOT "${${_tip_option}}" STREQUAL "")
+      list(APPEND _tip_worker "-D${_tip_option}=${${_tip_option}}")
+    endif()
+  endforeach()
+  list(APPEND _tip_worker -P "${_tip_parallel_install_script}")
+  set(_tip_workers "")
+  foreach(_tip_job RANGE 1 ${_tip_jobs})
+    list(APPEND _tip_workers ${_tip_worker})
+  endforeach()
+
+  message(STATUS "Installing ${_tip_component_count} components from '${TIP_INSTALL_BUILD_DIR}' with ${_tip_jobs} jobs")
+  if(_tip_sequences)
+    message(STATUS "Components that share files, installed one after another:${_tip_sequences}")
+  endif()
+  string(TIMESTAMP _tip_begin "%s%f" UTC)
+  execute_process(${_tip_workers} RESULTS_VARIABLE _tip_worker_results)
+  string(TIMESTAMP _tip_end "%s%f" UTC)
+  math(EXPR _tip_wall "${_tip_end} - ${_tip_begin}")
+
+  message(STATUS "  seconds     files  component")
+  set(_tip_component_total 0)
+  set(_tip_file_total 0)
+  set(_tip_failed "")
+  set(_tip_installed_files "")
+  set(_tip_index 0)
+  foreach(_tip_component IN LISTS _tip_components)
+    set(_tip_record "${_tip_state_dir}/${_tip_index}.result")
+    set(_tip_status "")
+    set(_tip_seconds "-")
+    set(_tip_component_files "")
+    if(EXISTS "${_tip_record}")
+      file(READ "${_tip_record}" _tip_record)
+      string(REPLACE "|" ";" _tip_record "${_tip_record}")
+      list(GET _tip_record 0 _tip_result)
+      list(GET _tip_record 1 _tip_elapsed)
+      math(EXPR _tip_component_total "${_tip_component_total} + ${_tip_elapsed}")
+      _tip_parallel_install_seconds(_tip_seconds ${_tip_elapsed})
+      if(NOT _tip_result EQUAL 0)
+        set(_tip_status "  FAILED, see ${_tip_state_dir}/${_tip_index}.log")
+        list(APPEND _tip_failed "${_tip_component}")
+      endif()
+    else()
+      set(_tip_status "  not installed, a worker failed")
+      list(APPEND _tip_failed "${_tip_component}")
+    endif()
+
+    set(_tip_manifest "${TIP_INSTALL_BUILD_DIR}/install_manifest_${_tip_component}.txt")
+    if(EXISTS "${_tip_manifest}")
+      file(STRINGS "${_tip_manifest}" _tip_component_files)
+      set(_tip_component_files_${_tip_index} ${_tip_component_files})
+      list(APPEND _tip_installed_files ${_tip_component_files})
+    endif()
+    list(LENGTH _tip_component_files _tip_file_count)
+    math(EXPR _tip_file_total "${_tip_file_total} + ${_tip_file_count}")
+
+    _tip_parallel_install_pad(_tip_seconds 9 "${_tip_seconds}")
+    _tip_parallel_install_pad(_tip_file_count 8 "${_tip_file_count}")
+    message(STATUS "${_tip_seconds}  ${_tip_file_count}  ${_tip_component}${_tip_status}")
+    math(EXPR _tip_index "${_tip_index} + 1")
+  endforeach()
+  _tip_parallel_install_seconds(_tip_wall ${_tip_wall})
+  _tip_parallel_install_seconds(_tip_component_total ${_tip_component_total})
+  message(STATUS "Installed ${_tip_file_total} files in ${_tip_wall} s (${_tip_component_total} s of component installs)")
+
+  # Most trees install every file once, which the length comparison settles without an owner lookup per file
+  list(LENGTH _tip_installed_files _tip_installed_count)
+  list(REMOVE_DUPLICATES _tip_installed_files)
+  list(LENGTH _tip_installed_files _tip_unique_count)
+  if(NOT _tip_installed_count EQUAL _tip_unique_count)
+    # Components of one queue entry installed their shared files one after another
+    set(_tip_shared_files "")
+    set(_tip_index 0)
+    foreach(_tip_component IN LISTS _tip_components)
+      set(_tip_entry "${_tip_entry_of_${_tip_component}}")
+      foreach(_tip_file IN LISTS _tip_component_files_${_tip_index})
+        if(NOT DEFINED "_tip_owners_${_tip_file}")
+          set("_tip_owners_${_tip_file}" "${_tip_component}")
+          set("_tip_owner_entries_${_tip_file}" ${_tip_entry})
+        elseif(NOT _tip_component IN_LIST "_tip_owners_${_tip_file}")
+          list(APPEND "_tip_owners_${_tip_file}" "${_tip_component}")
+          if(NOT _tip_entry IN_LIST "_tip_owner_entries_${_tip_file}")
+            list(APPEND "_tip_owner_entries_${_tip_file}" ${_tip_entry})
+            list(APPEND _tip_shared_files "${_tip_file}")
+          endif()
+        endif()
+      endforeach()
+      math(EXPR _tip_index "${_tip_index} + 1")
+    endforeach()
+    list(REMOVE_DUPLICATES _tip_shared_files)
+
+    set(_tip_shared_report "")
+    foreach(_tip_file IN LISTS _tip_shared_files)
+      list(JOIN "_tip_owners_${_tip_file}" ", " _tip_owners)
+      string(APPEND _tip_shared_report "\n  ${_tip_file} (${_tip_owners})")
+    endforeach()
+    if(_tip_shared_report)
+      if(DEFINED TIP_INSTALL_FAIL_ON_CONFLICT AND NOT TIP_INSTALL_FAIL_ON_CONFLICT)
+        set(_tip_conflict_level WARNING)
+      else()
+        set(_tip_conflict_level FATAL_ERROR)
+      endif()
+      message(${_tip_conflict_level} "Files installed concurrently by more than one component, the last install wins:${_tip_shared_report}")
+    endif()
+  endif()
+
+  if(_tip_failed)
+    message(FATAL_ERROR "Component installs failed: ${_tip_failed}")
+  endif()
+endfunction()
+
+if(CMAKE_SCRIPT_MODE_FILE AND TIP_INSTALL_WORKER)
+  _tip_parallel_install_worker()
+elseif(CMAKE_SCRIPT_MODE_FILE AND DEFINED TIP_INSTALL_BUILD_DIR)
+  _tip_run_parallel_install()
+endif()
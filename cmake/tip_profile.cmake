@@ -0,0 +1,95 @@
+include_guard(GLOBAL)
+
+# ~~~
+# Opt-in configure-time profiling for target_install_package and export_cpack.
+#
+# Enable with -DTIP_PROFILE=ON (or set TIP_PROFILE in the top-level CMakeLists.txt before the first
+# target_install_package() call). Every target_prepare_package(), target_install_packages(), finalize_package(),
+# per-target install() assembly, _tip_finalize_all_sboms(), _execute_deferred_cpack_config() and
+# _configure_gpg_signing() invocation is recorded as a span, and the spans are written as Chrome trace event JSON to
+# TIP_PROFILE_OUTPUT (default: ${CMAKE_BINARY_DIR}/tip-profile.json). Open the file in chrome://tracing or
+# https://ui.perfetto.dev.
+#
+# The deferred finalization calls run at the end of the top-level directory, so TIP_PROFILE must be visible there;
+# a cache entry or a top-level variable works, a variable set only in a subdirectory does not.
+#
+# Call sites guard each span with if(TIP_PROFILE), so a disabled profile costs one if() per span.
+# ~~~
+
+# ~~~
+# Open a span. NAME is shown in the trace viewer; the optional <key> <value> pairs are shown as span arguments.
+# Spans must be closed with _tip_profile_end() in the same order they were opened.
+#
+# API:
+#   _tip_profile_begin(<name> [<key> <value>]...)
+# ~~~
+function(_tip_profile_begin NAME)
+  set(_tip_profile_args "")
+  set(_tip_profile_pairs ${ARGN})
+  while(_tip_profile_pairs)
+    list(POP_FRONT _tip_profile_pairs _tip_profile_key _tip_profile_value)
+    _tip_profile_json_escape(_tip_profile_key "${_tip_profile_key}")
+    _tip_profile_json_escape(_tip_profile_value "${_tip_profile_value}")
+    string(APPEND _tip_profile_args ",\"${_tip_profile_key}\":\"${_tip_profile_value}\"")
+  endwhile()
+  if(_tip_profile_args)
+    string(SUBSTRING "${_tip_profile_args}" 1 -1 _tip_profile_args)
+  endif()
+  _tip_profile_json_escape(NAME "${NAME}")
+  _tip_profile_record_event("\"name\":\"${NAME}\",\"ph\":\"B\",\"args\":{${_tip_profile_args}}")
+endfunction()
+
+# ~~~
+# Close the innermost open span and schedule the trace file to be (re)written at the end of configuration.
+#
+# API:
+#   _tip_profile_end()
+# ~~~
+function(_tip_profile_end)
+  _tip_profile_record_event("\"ph\":\"E\"")
+
+  get_property(_tip_profile_flush_scheduled GLOBAL PROPERTY "_TIP_PROFILE_FLUSH_SCHEDULED")
+  if(NOT _tip_profile_flush_scheduled)
+    set_property(GLOBAL PROPERTY "_TIP_PROFILE_FLUSH_SCHEDULED" TRUE)
+    cmake_language(DEFER DIRECTORY "${CMAKE_SOURCE_DIR}" CALL _tip_profile_flush)
+  endif()
+endfunction()
+
+function(_tip_profile_json_escape OUT_VAR VALUE)
+  string(REPLACE "\\" "\\\\" VALUE "${VALUE}")
+  string(REPLACE "\"" "\\\"" VALUE "${VALUE}")
+  string(REPLACE "\n" "\\n" VALUE "${VALUE}")
+  set(${OUT_VAR}
+      "${VALUE}"
+      PARENT_SCOPE)
+endfunction()
+
+# Append one trace event. Timestamps are microseconds since the first recorded event.
+function(_tip_profile_record_event FIELDS)
+  string(TIMESTAMP _tip_profile_now "%s%f" UTC)
+  get_property(_tip_profile_epoch GLOBAL PROPERTY "_TIP_PROFILE_EPOCH_US")
+  if(NOT _tip_profile_epoch)
+    set(_tip_profile_epoch "${_tip_profile_now}")
+    set_property(GLOBAL PROPERTY "_TIP_PROFILE_EPOCH_US" "${_tip_profile_epoch}")
+    _tip_profile_json_escape(_tip_profile_process "cmake configure: ${CMAKE_SOURCE_DIR}")
+    set_property(GLOBAL APPEND_STRING PROPERTY "_TIP_PROFILE_EVENTS"
+                                               ",\n{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"tid\":1,\"args\":{\"name\":\"${_tip_profile_process}\"}}")
+  endif()
+  math(EXPR _tip_profile_ts "${_tip_profile_now} - ${_tip_profile_epoch}")
+  set_property(GLOBAL APPEND_STRING PROPERTY "_TIP_PROFILE_EVENTS" ",\n{${FIELDS},\"cat\":\"target_install_package\",\"pid\":1,\"tid\":1,\"ts\":${_tip_profile_ts}}")
+endfunction()
+
+# Write every event recorded so far. Deferred by _tip_profile_end(), so spans recorded by later deferred calls
+# (CPack, signing) schedule another write and the file always ends up complete.
+function(_tip_profile_flush)
+  set_property(GLOBAL PROPERTY "_TIP_PROFILE_FLUSH_SCHEDULED" FALSE)
+  if(NOT DEFINED TIP_PROFILE_OUTPUT OR TIP_PROFILE_OUTPUT STREQUAL "")
+    set(TIP_PROFILE_OUTPUT "${CMAKE_BINARY_DIR}/tip-profile.json")
+  endif()
+  get_property(_tip_profile_events GLOBAL PROPERTY "_TIP_PROFILE_EVENTS")
+  string(SUBSTRING "${_tip_profile_events}" 2 -1 _tip_profile_events)
+  file(WRITE "${TIP_PROFILE_OUTPUT}" "[\n${_tip_profile_events}\n]\n")
+  if(COMMAND project_log)
+    project_log(VERBOSE "Wrote configure profile: ${TIP_PROFILE_OUTPUT}")
+  endif()
+endfunction()
@@ -0,0 +1,145 @@
+cmake_minimum_required(VERSION 3.25)
+
+# ~~~
+# Default INSTALL_RPATH computation for target_install_package, loaded by _tip_load_feature_module(tip_rpath) the
+# first time an executable or shared library without a configured RPATH is installed.
+# ~~~
+
+# ~~~
+# Compute the path from one install destination to another using a dummy prefix so
+# results stay generator-agnostic. Returns an empty string if either destination
+# contains generator expressions that cannot be resolved at configure time.
+# ~~~
+function(_tip_compute_relative_install_path RESULT_VAR FROM_DESTINATION TO_DESTINATION)
+  set(${RESULT_VAR}
+      ""
+      PARENT_SCOPE)
+
+  if("${TO_DESTINATION}" STREQUAL "")
+    return()
+  endif()
+
+  if("${TO_DESTINATION}" MATCHES "\\$<" OR "${FROM_DESTINATION}" MATCHES "\\$<")
+    project_log(DEBUG "Skipping relative path computation for generator expression destinations: from='${FROM_DESTINATION}' to='${TO_DESTINATION}'")
+    return()
+  endif()
+
+  cmake_path(IS_ABSOLUTE TO_DESTINATION TO_IS_ABSOLUTE)
+  if(TO_IS_ABSOLUTE)
+    set(${RESULT_VAR}
+        "${TO_DESTINATION}"
+        PARENT_SCOPE)
+    return()
+  endif()
+
+  set(_tip_dummy_prefix "/target_install_package_prefix")
+
+  if("${FROM_DESTINATION}" STREQUAL "")
+    set(_tip_from ".")
+  else()
+    set(_tip_from "${FROM_DESTINATION}")
+  endif()
+
+  cmake_path(IS_ABSOLUTE _tip_from FROM_IS_ABSOLUTE)
+  if(FROM_IS_ABSOLUTE)
+    set(_from_abs "${_tip_from}")
+  else()
+    set(_from_abs "${_tip_dummy_prefix}")
+    cmake_path(APPEND _from_abs "${_tip_from}")
+  endif()
+  cmake_path(NORMAL_PATH _from_abs)
+
+  set(_to_abs "${_tip_dummy_prefix}")
+  cmake_path(APPEND _to_abs "${TO_DESTINATION}")
+  cmake_path(NORMAL_PATH _to_abs)
+
+  file(RELATIVE_PATH _relative "${_from_abs}" "${_to_abs}")
+  if(_relative STREQUAL "")
+    set(_relative ".")
+  endif()
+
+  cmake_path(NORMAL_PATH _relative OUTPUT_VARIABLE _relative)
+
+  set(${RESULT_VAR}
+      "${_relative}"
+      PARENT_SCOPE)
+endfunction()
+
+# ~~~
+# Compute the default INSTALL_RPATH entries for a target of TARGET_TYPE (EXECUTABLE or SHARED_LIBRARY) installed with
+# the GNUInstallDirs runtime and library destinations.
+#
+# API:
+#   _tip_compute_default_install_rpaths(<out_var> <target_type>)
+# ~~~
+function(_tip_compute_default_install_rpaths OUT_VAR TARGET_TYPE)
+  set(DEFAULT_RPATHS "")
+
+  set(_tip_runtime_destination "${CMAKE_INSTALL_BINDIR}")
+  if(NOT _tip_runtime_destination)
+    set(_tip_runtime_destination "bin")
+  endif()
+
+  set(_tip_library_destination "${CMAKE_INSTALL_LIBDIR}")
+  if(NOT _tip_library_destination)
+    set(_tip_library_destination "lib")
+  endif()
+
+  if(APPLE)
+    if(TARGET_TYPE STREQUAL "EXECUTABLE")
+      set(_tip_rel_path "")
+      _tip_compute_relative_install_path(_tip_rel_path "${_tip_runtime_destination}" "${_tip_library_destination}")
+
+      if(_tip_rel_path)
+        cmake_path(IS_ABSOLUTE _tip_rel_path _tip_rel_abs)
+        if(_tip_rel_abs)
+          list(APPEND DEFAULT_RPATHS "${_tip_rel_path}")
+        elseif(_tip_rel_path STREQUAL "." OR _tip_rel_path STREQUAL "./")
+          list(APPEND DEFAULT_RPATHS "@executable_path")
+        else()
+          string(REGEX REPLACE "^\\./" "" _tip_rel_path_clean "${_tip_rel_path}")
+          string(REPLACE "\\" "/" _tip_rel_path_clean "${_tip_rel_path_clean}")
+          list(APPEND DEFAULT_RPATHS "@executable_path/${_tip_rel_path_clean}")
+        endif()
+      else()
+        list(APPEND DEFAULT_RPATHS "@executable_path/../lib" "@executable_path/../lib64")
+      endif()
+
+      # Always allow colocated runtime resolution for custom layouts
+      list(APPEND DEFAULT_RPATHS "@executable_path")
+    else()
+      list(APPEND DEFAULT_RPATHS "@loader_path")
+    endif()
+  else() # Linux/Unix
+    if(TARGET_TYPE STREQUAL "EXECUTABLE")
+      set(_tip_rel_path "")
+      _tip_compute_relative_install_path(_tip_rel_path "${_tip_runtime_destination}" "${_tip_library_destination}")
+
+      if(_tip_rel_path)
+        cmake_path(IS_ABSOLUTE _tip_rel_path _tip_rel_abs)
+        if(_tip_rel_abs)
+          list(APPEND DEFAULT_RPATHS "${_tip_rel_path}")
+        elseif(_tip_rel_path STREQUAL "." OR _tip_rel_path STREQUAL "./")
+          list(APPEND DEFAULT_RPATHS "\$ORIGIN")
+        else()
+          string(REGEX REPLACE "^\\./" "" _tip_rel_path_clean "${_tip_rel_path}")
+          list(APPEND DEFAULT_RPATHS "\$ORIGIN/${_tip_rel_path_clean}")
+        endif()
+      else()
+        list(APPEND DEFAULT_RPATHS "\$ORIGIN/../lib" "\$ORIGIN/../lib64")
+      endif()
+
+      # Allow executables to resolve libraries placed alongside them (plugins, tests, etc.)
+      list(APPEND DEFAULT_RPATHS "\$ORIGIN")
+    else()
+      list(APPEND DEFAULT_RPATHS "\$ORIGIN")
+    endif()
+  endif()
+
+  list(FILTER DEFAULT_RPATHS EXCLUDE REGEX "^$")
+  list(REMOVE_DUPLICATES DEFAULT_RPATHS)
+
+  set(${OUT_VAR}
+      "${DEFAULT_RPATHS}"
+      PARENT_SCOPE)
+endfunction()
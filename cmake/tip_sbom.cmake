@@ -0,0 +1,347 @@
+cmake_minimum_required(VERSION 3.25)
+
+# Set policy for install() DESTINATION path normalization if supported
+if(POLICY CMP0177)
+  cmake_policy(SET CMP0177 NEW)
+endif()
+
+# ~~~
+# SBOM generation support for target_install_package, loaded by _tip_load_feature_module(tip_sbom) the first time a
+# call passes SBOM.
+# ~~~
+
+function(_tip_is_cmake_boolean_literal OUT_VAR VALUE)
+  string(TOUPPER "${VALUE}" _tip_upper_value)
+
+  if("${_tip_upper_value}" MATCHES "^(0|1|ON|OFF|YES|NO|TRUE|FALSE|Y|N|IGNORE|NOTFOUND)$" OR "${_tip_upper_value}" MATCHES ".*-NOTFOUND$")
+    set(${OUT_VAR}
+        TRUE
+        PARENT_SCOPE)
+  else()
+    set(${OUT_VAR}
+        FALSE
+        PARENT_SCOPE)
+  endif()
+endfunction()
+
+function(_tip_validate_sbom_activation EXPORT_NAME)
+  if(CMAKE_VERSION VERSION_LESS "4.3")
+    project_log(FATAL_ERROR "SBOM metadata requires CMake 4.3 or newer because it uses install(SBOM).")
+  endif()
+
+  if(NOT DEFINED CMAKE_EXPERIMENTAL_GENERATE_SBOM OR "${CMAKE_EXPERIMENTAL_GENERATE_SBOM}" STREQUAL "")
+    project_log(FATAL_ERROR "SBOM metadata for export '${EXPORT_NAME}' requires CMAKE_EXPERIMENTAL_GENERATE_SBOM to be set to the activation value for this CMake version.")
+  endif()
+
+  _tip_is_cmake_boolean_literal(_tip_sbom_activation_is_boolean "${CMAKE_EXPERIMENTAL_GENERATE_SBOM}")
+  if(_tip_sbom_activation_is_boolean)
+    project_log(FATAL_ERROR "SBOM metadata for export '${EXPORT_NAME}' requires CMAKE_EXPERIMENTAL_GENERATE_SBOM " "to be set to the activation value for this CMake version, not a boolean toggle "
+                "such as '${CMAKE_EXPERIMENTAL_GENERATE_SBOM}'.")
+  endif()
+endfunction()
+
+function(_tip_resolve_sbom_export_metadata EXPORT_NAME OUT_PREFIX)
+  foreach(_tip_record_name IN ITEMS RECORD SBOM_RECORD)
+    get_property(_tip_record_fields GLOBAL PROPERTY "_TIP_EXPORT_${_tip_record_name}_FIELDS")
+    get_property(_tip_record GLOBAL PROPERTY "_CMAKE_PACKAGE_EXPORT_${EXPORT_NAME}_${_tip_record_name}")
+    cmake_parse_arguments(_tip "" "" "${_tip_record_fields}" ${_tip_record})
+  endforeach()
+
+  if("${_tip_SBOM_NAME}" STREQUAL "")
+    set(_tip_SBOM_NAME "${EXPORT_NAME}")
+  endif()
+
+  set(_tip_effective_version "")
+  if(_tip_SBOM_VERSION_EXPLICIT)
+    set(_tip_effective_version "${_tip_SBOM_VERSION}")
+  elseif(_tip_VERSION_EXPLICIT)
+    set(_tip_effective_version "${_tip_VERSION}")
+  elseif(NOT "${_tip_SBOM_INHERITED_VERSION}" STREQUAL "")
+    set(_tip_effective_version "${_tip_SBOM_INHERITED_VERSION}")
+  elseif("${_tip_SBOM_PROJECT}" STREQUAL "")
+    set(_tip_effective_version "${_tip_VERSION}")
+  endif()
+
+  set(_tip_effective_license "${_tip_SBOM_LICENSE}")
+  if("${_tip_effective_license}" STREQUAL "")
+    set(_tip_effective_license "${_tip_SBOM_INHERITED_LICENSE}")
+  endif()
+
+  set(_tip_effective_description "${_tip_SBOM_DESCRIPTION}")
+  if("${_tip_effective_description}" STREQUAL "")
+    set(_tip_effective_description "${_tip_SBOM_INHERITED_DESCRIPTION}")
+  endif()
+
+  set(_tip_effective_homepage_url "${_tip_SBOM_HOMEPAGE_URL}")
+  if("${_tip_effective_homepage_url}" STREQUAL "")
+    set(_tip_effective_homepage_url "${_tip_SBOM_INHERITED_HOMEPAGE_URL}")
+  endif()
+
+  set(${OUT_PREFIX}_NAME
+      "${_tip_SBOM_NAME}"
+      PARENT_SCOPE)
+  set(${OUT_PREFIX}_DESTINATION
+      "${_tip_SBOM_DESTINATION}"
+      PARENT_SCOPE)
+  set(${OUT_PREFIX}_VERSION
+      "${_tip_effective_version}"
+      PARENT_SCOPE)
+  set(${OUT_PREFIX}_LICENSE
+      "${_tip_effective_license}"
+      PARENT_SCOPE)
+  set(${OUT_PREFIX}_DESCRIPTION
+      "${_tip_effective_description}"
+      PARENT_SCOPE)
+  set(${OUT_PREFIX}_HOMEPAGE_URL
+      "${_tip_effective_homepage_url}"
+      PARENT_SCOPE)
+  set(${OUT_PREFIX}_PACKAGE_URL
+      "${_tip_SBOM_PACKAGE_URL}"
+      PARENT_SCOPE)
+  set(${OUT_PREFIX}_FORMAT
+      "${_tip_SBOM_FORMAT}"
+      PARENT_SCOPE)
+  set(${OUT_PREFIX}_METADATA_MODE
+      "${_tip_SBOM_METADATA_MODE}"
+      PARENT_SCOPE)
+  set(${OUT_PREFIX}_EXPERIMENTAL_VALUE
+      "${_tip_SBOM_EXPERIMENTAL_VALUE}"
+      PARENT_SCOPE)
+endfunction()
+
+function(_tip_finalize_all_sboms)
+  get_property(_tip_sboms_finalized GLOBAL PROPERTY "_TIP_SBOMS_FINALIZED")
+  if(_tip_sboms_finalized)
+    return()
+  endif()
+  if(TIP_PROFILE)
+    _tip_profile_begin("_tip_finalize_all_sboms()")
+  endif()
+
+  get_property(_tip_sbom_group_hashes GLOBAL PROPERTY "_TIP_SBOM_GROUP_HASHES")
+  foreach(_tip_sbom_group_hash IN LISTS _tip_sbom_group_hashes)
+    get_property(_tip_sbom_name GLOBAL PROPERTY "_TIP_SBOM_GROUP_${_tip_sbom_group_hash}_NAME")
+    get_property(_tip_sbom_exports GLOBAL PROPERTY "_TIP_SBOM_GROUP_${_tip_sbom_group_hash}_EXPORTS")
+    list(REMOVE_DUPLICATES _tip_sbom_exports)
+
+    foreach(_tip_sbom_export IN LISTS _tip_sbom_exports)
+      get_property(_tip_export_finalized GLOBAL PROPERTY "_CMAKE_PACKAGE_EXPORT_${_tip_sbom_export}_FINALIZED")
+      if(NOT _tip_export_finalized)
+        finalize_package(EXPORT_NAME "${_tip_sbom_export}")
+      endif()
+    endforeach()
+
+    list(GET _tip_sbom_exports 0 _tip_reference_export)
+    _tip_resolve_sbom_export_metadata("${_tip_reference_export}" _tip_reference)
+
+    foreach(_tip_sbom_export IN LISTS _tip_sbom_exports)
+      _tip_resolve_sbom_export_metadata("${_tip_sbom_export}" _tip_candidate)
+      foreach(
+        _tip_field IN
+        ITEMS NAME
+              DESTINATION
+              VERSION
+              LICENSE
+              DESCRIPTION
+              HOMEPAGE_URL
+              PACKAGE_URL
+              FORMAT
+              METADATA_MODE
+              EXPERIMENTAL_VALUE)
+        if(NOT "${_tip_candidate_${_tip_field}}" STREQUAL "${_tip_reference_${_tip_field}}")
+          string(REPLACE "_" " " _tip_field_description "${_tip_field}")
+          string(TOLOWER "${_tip_field_description}" _tip_field_description)
+          project_log(
+            FATAL_ERROR
+            "Conflicting SBOM ${_tip_field_description} for SBOM '${_tip_sbom_name}' across exports '${_tip_reference_export}' and '${_tip_sbom_export}': '${_tip_reference_${_tip_field}}' vs '${_tip_candidate_${_tip_field}}'."
+          )
+        endif()
+      endforeach()
+    endforeach()
+
+    set(CMAKE_EXPERIMENTAL_GENERATE_SBOM "${_tip_reference_EXPERIMENTAL_VALUE}")
+    _tip_validate_sbom_activation("${_tip_reference_export}")
+
+    if(CMAKE_VERSION VERSION_GREATER_EQUAL "4.4")
+      set(_tip_sbom_args SBOM "${_tip_sbom_name}" EXPORTS ${_tip_sbom_exports})
+    else()
+      list(GET _tip_sbom_exports 0 _tip_sbom_export)
+      set(_tip_sbom_args SBOM "${_tip_sbom_name}" EXPORT "${_tip_sbom_export}")
+    endif()
+    list(APPEND _tip_sbom_args NO_PROJECT_METADATA)
+
+    foreach(
+      _tip_field IN
+      ITEMS DESTINATION
+            VERSION
+            LICENSE
+            DESCRIPTION
+            HOMEPAGE_URL
+            PACKAGE_URL
+            FORMAT)
+      if(NOT "${_tip_reference_${_tip_field}}" STREQUAL "")
+        list(APPEND _tip_sbom_args "${_tip_field}" "${_tip_reference_${_tip_field}}")
+      endif()
+    endforeach()
+
+    install(${_tip_sbom_args})
+    project_log(STATUS "SBOM '${_tip_sbom_name}' is ready for exports: [${_tip_sbom_exports}]")
+  endforeach()
+
+  set_property(GLOBAL PROPERTY "_TIP_SBOMS_FINALIZED" TRUE)
+  if(TIP_PROFILE)
+    _tip_profile_end()
+  endif()
+endfunction()
+
+# ~~~
+# Validate the SBOM_* arguments of the calling _tip_prepare_package_targets() and resolve the SBOM name and project
+# metadata source. Sets _tip_effective_sbom_name, _tip_sbom_metadata_project and _tip_sbom_metadata_mode in the caller.
+# ~~~
+function(_tip_validate_sbom_arguments)
+  _tip_validate_sbom_activation("${ARG_EXPORT_NAME}")
+
+  if(NOT "${ARG_SBOM_PACKAGE_URL}" STREQUAL "" AND CMAKE_VERSION VERSION_LESS "4.4")
+    project_log(FATAL_ERROR "SBOM_PACKAGE_URL requires CMake 4.4 or newer because CMake 4.3 does not accept PACKAGE_URL in install(SBOM).")
+  endif()
+
+  set(_tip_effective_sbom_name "${ARG_SBOM_NAME}")
+  if("${_tip_effective_sbom_name}" STREQUAL "")
+    set(_tip_effective_sbom_name "${ARG_EXPORT_NAME}")
+  endif()
+
+  if(NOT "${ARG_SBOM_PROJECT}" STREQUAL "" AND ARG_SBOM_NO_PROJECT_METADATA)
+    project_log(FATAL_ERROR "SBOM_PROJECT and SBOM_NO_PROJECT_METADATA cannot be used together.")
+  endif()
+
+  set(_tip_sbom_metadata_project "")
+  if(NOT ARG_SBOM_NO_PROJECT_METADATA)
+    if(NOT "${ARG_SBOM_PROJECT}" STREQUAL "")
+      set(_tip_sbom_metadata_project "${ARG_SBOM_PROJECT}")
+      set(_tip_sbom_project_source_var "${ARG_SBOM_PROJECT}_SOURCE_DIR")
+      if(NOT DEFINED ${_tip_sbom_project_source_var})
+        project_log(FATAL_ERROR "SBOM_PROJECT '${ARG_SBOM_PROJECT}' is not visible from target '${_tip_targets_label}'.")
+      endif()
+    else()
+      if("${_tip_effective_sbom_name}" STREQUAL "${PROJECT_NAME}")
+        set(_tip_sbom_metadata_project "${PROJECT_NAME}")
+      endif()
+    endif()
+  endif()
+
+  if(ARG_SBOM_NO_PROJECT_METADATA)
+    set(_tip_sbom_metadata_mode "none")
+  elseif(NOT "${_tip_sbom_metadata_project}" STREQUAL "")
+    set(_tip_sbom_metadata_mode "project:${_tip_sbom_metadata_project}")
+  else()
+    set(_tip_sbom_metadata_mode "explicit")
+  endif()
+
+  set(_tip_effective_sbom_name
+      "${_tip_effective_sbom_name}"
+      PARENT_SCOPE)
+  set(_tip_sbom_metadata_project
+      "${_tip_sbom_metadata_project}"
+      PARENT_SCOPE)
+  set(_tip_sbom_metadata_mode
+      "${_tip_sbom_metadata_mode}"
+      PARENT_SCOPE)
+endfunction()
+
+# ~~~
+# Merge the SBOM_* arguments of the calling _tip_prepare_package_targets() into the export's SBOM record and register
+# the export with its SBOM group.
+# ~~~
+function(_tip_merge_sbom_export_record)
+  get_property(_tip_export_sbom_record_fields GLOBAL PROPERTY _TIP_EXPORT_SBOM_RECORD_FIELDS)
+  get_property(_tip_export_sbom_record GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_SBOM_RECORD")
+  _tip_decode_record(_tip_export _tip_export_sbom_record_fields _tip_export_sbom_record)
+
+  set(_tip_export_SBOM_ENABLED TRUE)
+  _tip_merge_export_field(_tip_export_ "${ARG_EXPORT_NAME}" "SBOM_METADATA_MODE" "${_tip_sbom_metadata_mode}" "SBOM metadata inheritance mode")
+  _tip_merge_export_field(_tip_export_ "${ARG_EXPORT_NAME}" "SBOM_EXPERIMENTAL_VALUE" "${CMAKE_EXPERIMENTAL_GENERATE_SBOM}" "SBOM experimental activation value")
+  if(_tip_sbom_version_explicit)
+    set(_tip_export_SBOM_VERSION_EXPLICIT TRUE)
+  endif()
+
+  foreach(
+    _tip_sbom_one_value IN
+    ITEMS SBOM_NAME
+          SBOM_PROJECT
+          SBOM_DESTINATION
+          SBOM_VERSION
+          SBOM_LICENSE
+          SBOM_DESCRIPTION
+          SBOM_HOMEPAGE_URL
+          SBOM_PACKAGE_URL
+          SBOM_FORMAT)
+    set(_tip_sbom_arg_var "ARG_${_tip_sbom_one_value}")
+    if(DEFINED ${_tip_sbom_arg_var} AND NOT "${${_tip_sbom_arg_var}}" STREQUAL "")
+      string(REPLACE "_" " " _tip_sbom_description "${_tip_sbom_one_value}")
+      string(TOLOWER "${_tip_sbom_description}" _tip_sbom_description)
+      _tip_merge_export_field(_tip_export_ "${ARG_EXPORT_NAME}" "${_tip_sbom_one_value}" "${${_tip_sbom_arg_var}}" "${_tip_sbom_description}")
+    endif()
+  endforeach()
+
+  if(ARG_SBOM_NO_PROJECT_METADATA)
+    set(_tip_export_SBOM_NO_PROJECT_METADATA TRUE)
+  endif()
+
+  if(NOT "${_tip_sbom_metadata_project}" STREQUAL "")
+    set(_tip_export_SBOM_INHERITED_PROJECT_METADATA TRUE)
+
+    set(_tip_sbom_project_version_var "${_tip_sbom_metadata_project}_VERSION")
+    if(NOT _tip_sbom_version_explicit
+       AND NOT _tip_version_explicit
+       AND DEFINED ${_tip_sbom_project_version_var}
+       AND NOT "${${_tip_sbom_project_version_var}}" STREQUAL "")
+      _tip_merge_export_field(_tip_export_ "${ARG_EXPORT_NAME}" "SBOM_INHERITED_VERSION" "${${_tip_sbom_project_version_var}}" "SBOM inherited project version")
+    endif()
+
+    set(_tip_sbom_project_license_var "${_tip_sbom_metadata_project}_SPDX_LICENSE")
+    if("${ARG_SBOM_LICENSE}" STREQUAL ""
+       AND DEFINED ${_tip_sbom_project_license_var}
+       AND NOT "${${_tip_sbom_project_license_var}}" STREQUAL "")
+      _tip_merge_export_field(_tip_export_ "${ARG_EXPORT_NAME}" "SBOM_INHERITED_LICENSE" "${${_tip_sbom_project_license_var}}" "SBOM inherited project license")
+    endif()
+
+    set(_tip_sbom_project_description_var "${_tip_sbom_metadata_project}_DESCRIPTION")
+    if("${ARG_SBOM_DESCRIPTION}" STREQUAL ""
+       AND DEFINED ${_tip_sbom_project_description_var}
+       AND NOT "${${_tip_sbom_project_description_var}}" STREQUAL "")
+      _tip_merge_export_field(_tip_export_ "${ARG_EXPORT_NAME}" "SBOM_INHERITED_DESCRIPTION" "${${_tip_sbom_project_description_var}}" "SBOM inherited project description")
+    endif()
+
+    set(_tip_sbom_project_homepage_var "${_tip_sbom_metadata_project}_HOMEPAGE_URL")
+    if("${ARG_SBOM_HOMEPAGE_URL}" STREQUAL ""
+       AND DEFINED ${_tip_sbom_project_homepage_var}
+       AND NOT "${${_tip_sbom_project_homepage_var}}" STREQUAL "")
+      _tip_merge_export_field(_tip_export_ "${ARG_EXPORT_NAME}" "SBOM_INHERITED_HOMEPAGE_URL" "${${_tip_sbom_project_homepage_var}}" "SBOM inherited project homepage URL")
+    endif()
+  endif()
+
+  _tip_encode_export_sbom_record("${EXPORT_PROPERTY_PREFIX}_SBOM_RECORD" _tip_export_)
+
+  string(SHA256 _tip_sbom_group_hash "${_tip_effective_sbom_name}")
+  get_property(_tip_sbom_group_name GLOBAL PROPERTY "_TIP_SBOM_GROUP_${_tip_sbom_group_hash}_NAME")
+  if(NOT "${_tip_sbom_group_name}" STREQUAL "" AND NOT "${_tip_sbom_group_name}" STREQUAL "${_tip_effective_sbom_name}")
+    project_log(FATAL_ERROR "Internal SBOM name hash collision between '${_tip_sbom_group_name}' and '${_tip_effective_sbom_name}'.")
+  endif()
+  set_property(GLOBAL PROPERTY "_TIP_SBOM_GROUP_${_tip_sbom_group_hash}_NAME" "${_tip_effective_sbom_name}")
+
+  get_property(_tip_sbom_group_exports GLOBAL PROPERTY "_TIP_SBOM_GROUP_${_tip_sbom_group_hash}_EXPORTS")
+  if(CMAKE_VERSION VERSION_LESS "4.4"
+     AND _tip_sbom_group_exports
+     AND NOT ARG_EXPORT_NAME IN_LIST _tip_sbom_group_exports)
+    project_log(FATAL_ERROR
+                "SBOM_NAME '${_tip_effective_sbom_name}' is already registered for export '${_tip_sbom_group_exports}'. Aggregating multiple export sets into one SBOM requires CMake 4.4 or newer.")
+  endif()
+  list(APPEND _tip_sbom_group_exports "${ARG_EXPORT_NAME}")
+  list(REMOVE_DUPLICATES _tip_sbom_group_exports)
+  set_property(GLOBAL PROPERTY "_TIP_SBOM_GROUP_${_tip_sbom_group_hash}_EXPORTS" "${_tip_sbom_group_exports}")
+
+  get_property(_tip_sbom_group_hashes GLOBAL PROPERTY "_TIP_SBOM_GROUP_HASHES")
+  list(APPEND _tip_sbom_group_hashes "${_tip_sbom_group_hash}")
+  list(REMOVE_DUPLICATES _tip_sbom_group_hashes)
+  set_property(GLOBAL PROPERTY "_TIP_SBOM_GROUP_HASHES" "${_tip_sbom_group_hashes}")
+endfunction()
@@ -0,0 +1,93 @@
+cmake_minimum_required(VERSION 3.25)
+
+# ~~~
+# Package signing and checksum support for export_cpack, included by _configure_gpg_signing() the first time a
+# package enables GPG_SIGNING_KEY or CHECKSUMS.
+# ~~~
+
+# ~~~
+# Resolve the signing method, locate gpg and rpmsign, check the signing key and generate the CPack post-build
+# script for the calling _configure_gpg_signing().
+# ~~~
+function(_tip_configure_signing_script)
+  if(NOT ARG_SIGNING_METHOD)
+    if(ARG_SIGNING_KEY)
+      set(ARG_SIGNING_METHOD "detached")
+    else()
+      set(ARG_SIGNING_METHOD "none")
+    endif()
+  endif()
+
+  if(NOT ARG_SIGNING_METHOD STREQUAL "detached"
+     AND NOT ARG_SIGNING_METHOD STREQUAL "embedded"
+     AND NOT ARG_SIGNING_METHOD STREQUAL "both"
+     AND NOT ARG_SIGNING_METHOD STREQUAL "none")
+    project_log(FATAL_ERROR "SIGNING_METHOD must be one of 'detached', 'embedded', or 'both', got: ${ARG_SIGNING_METHOD}")
+  endif()
+
+  if(NOT ARG_KEYSERVER)
+    set(ARG_KEYSERVER "keyserver.ubuntu.com")
+  endif()
+
+  # Find GPG executable
+  if(ARG_SIGNING_KEY)
+    find_program(
+      GPG_EXECUTABLE
+      NAMES gpg2 gpg
+      DOC "GNU Privacy Guard")
+    if(NOT GPG_EXECUTABLE)
+      project_log(FATAL_ERROR "GPG executable not found. Install GPG to enable package signing.")
+    endif()
+  else()
+    set(GPG_EXECUTABLE "")
+  endif()
+
+  if(ARG_SIGNING_KEY AND ARG_REQUIRE_RPMSIGN)
+    find_program(
+      RPMSIGN_EXECUTABLE
+      NAMES rpmsign
+      DOC "RPM signing tool")
+    if(NOT RPMSIGN_EXECUTABLE)
+      project_log(FATAL_ERROR "rpmsign executable not found. Install rpm-sign to enable embedded RPM signing.")
+    endif()
+  else()
+    set(RPMSIGN_EXECUTABLE "")
+  endif()
+
+  if(ARG_SIGNING_KEY
+     AND ARG_PASSPHRASE_FILE
+     AND ARG_REQUIRE_RPMSIGN)
+    project_log(WARNING "GPG_PASSPHRASE_FILE is used for detached signatures only; embedded RPM signing uses rpmsign and the configured GPG agent.")
+  endif()
+
+  # Validate signing key exists
+  if(ARG_SIGNING_KEY)
+    execute_process(
+      COMMAND ${GPG_EXECUTABLE} --list-secret-keys "${ARG_SIGNING_KEY}"
+      RESULT_VARIABLE gpg_result
+      OUTPUT_QUIET ERROR_QUIET)
+
+    if(NOT gpg_result EQUAL 0)
+      project_log(FATAL_ERROR "GPG signing key '${ARG_SIGNING_KEY}' not found in keyring or no private key available.")
+    endif()
+  endif()
+
+  # Generate signing script
+  _tip_find_export_cpack_resource_file("sign_packages.cmake.in" _tip_sign_packages_template)
+  configure_file("${_tip_sign_packages_template}" "${CMAKE_BINARY_DIR}/sign_packages.cmake" @ONLY)
+
+  # Set CPack post-build script
+  _tip_store_cpack_var(CPACK_POST_BUILD_SCRIPTS "${CMAKE_BINARY_DIR}/sign_packages.cmake")
+
+  if(ARG_SIGNING_KEY)
+    project_log(STATUS "GPG package signing configured:")
+    project_log(STATUS "  Signing key: ${ARG_SIGNING_KEY}")
+    project_log(STATUS "  Signing method: ${ARG_SIGNING_METHOD}")
+    project_log(STATUS "  Post-build checksums: ${ARG_CHECKSUMS}")
+    project_log(STATUS "  Post-build script: ${CMAKE_BINARY_DIR}/sign_packages.cmake")
+  else()
+    project_log(STATUS "CPack checksum generation configured:")
+    project_log(STATUS "  Post-build checksums: ${ARG_CHECKSUMS}")
+    project_log(STATUS "  Post-build script: ${CMAKE_BINARY_DIR}/sign_packages.cmake")
+  endif()
+endfunction()
@@ -26,6 +26,15 @@ if(NOT COMMAND project_log)
   endfunction()
 endif()
 
+# Opt-in configure-time profiling (TIP_PROFILE). The source tree keeps the helper under cmake/, installs keep it flat.
+if(NOT COMMAND _tip_profile_begin)
+  if(EXISTS "${CMAKE_CURRENT_LIST_DIR}/cmake/tip_profile.cmake")
+    include("${CMAKE_CURRENT_LIST_DIR}/cmake/tip_profile.cmake")
+  else()
+    include("${CMAKE_CURRENT_LIST_DIR}/tip_profile.cmake")
+  endif()
+endif()
+
 include(GNUInstallDirs)
 
 # Set policy for install() DESTINATION path normalization if supported
@@ -851,6 +860,9 @@ function(_execute_deferred_cpack_config)
   if(NOT args)
     return()
   endif()
+  if(TIP_PROFILE)
+    _tip_profile_begin("_execute_deferred_cpack_config()")
+  endif()
   _tip_finalize_registered_exports_for_cpack()
   get_property(_tip_cpack_config_source_dir GLOBAL PROPERTY "_TIP_CPACK_CONFIG_SOURCE_DIR")
   if(NOT _tip_cpack_config_source_dir)
@@ -1592,6 +1604,9 @@ function(_execute_deferred_cpack_config)
 
   # Include CPack after all variables are set This ensures CPack sees all the deferred configuration
   include(CPack)
+  if(TIP_PROFILE)
+    _tip_profile_end()
+  endif()
 
 endfunction(_execute_deferred_cpack_config)
 
@@ -1616,6 +1631,9 @@ function(_configure_gpg_signing)
   if(ARG_UNPARSED_ARGUMENTS)
     project_log(FATAL_ERROR "Unknown arguments for GPG signing configuration: ${ARG_UNPARSED_ARGUMENTS}")
   endif()
+  if(TIP_PROFILE)
+    _tip_profile_begin("_configure_gpg_signing(${ARG_PACKAGE_NAME})" package "${ARG_PACKAGE_NAME}")
+  endif()
 
   # Set defaults with environment variable fallbacks
   if(NOT ARG_SIGNING_KEY AND DEFINED ENV{GPG_SIGNING_KEY})
@@ -1638,88 +1656,19 @@ function(_configure_gpg_signing)
   endif()
 
   if(NOT ARG_SIGNING_KEY AND NOT ARG_CHECKSUMS)
-    return()
-  endif()
-
-  if(NOT ARG_SIGNING_METHOD)
-    if(ARG_SIGNING_KEY)
-      set(ARG_SIGNING_METHOD "detached")
-    else()
-      set(ARG_SIGNING_METHOD "none")
-    endif()
-  endif()
-
-  if(NOT ARG_SIGNING_METHOD STREQUAL "detached"
-     AND NOT ARG_SIGNING_METHOD STREQUAL "embedded"
-     AND NOT ARG_SIGNING_METHOD STREQUAL "both"
-     AND NOT ARG_SIGNING_METHOD STREQUAL "none")
-    project_log(FATAL_ERROR "SIGNING_METHOD must be one of 'detached', 'embedded', or 'both', got: ${ARG_SIGNING_METHOD}")
-  endif()
-
-  if(NOT ARG_KEYSERVER)
-    set(ARG_KEYSERVER "keyserver.ubuntu.com")
-  endif()
-
-  # Find GPG executable
-  if(ARG_SIGNING_KEY)
-    find_program(
-      GPG_EXECUTABLE
-      NAMES gpg2 gpg
-      DOC "GNU Privacy Guard")
-    if(NOT GPG_EXECUTABLE)
-      project_log(FATAL_ERROR "GPG executable not found. Install GPG to enable package signing.")
+    if(TIP_PROFILE)
+      _tip_profile_end()
     endif()
-  else()
-    set(GPG_EXECUTABLE "")
-  endif()
-
-  if(ARG_SIGNING_KEY AND ARG_REQUIRE_RPMSIGN)
-    find_program(
-      RPMSIGN_EXECUTABLE
-      NAMES rpmsign
-      DOC "RPM signing tool")
-    if(NOT RPMSIGN_EXECUTABLE)
-      project_log(FATAL_ERROR "rpmsign executable not found. Install rpm-sign to enable embedded RPM signing.")
-    endif()
-  else()
-    set(RPMSIGN_EXECUTABLE "")
-  endif()
-
-  if(ARG_SIGNING_KEY
-     AND ARG_PASSPHRASE_FILE
-     AND ARG_REQUIRE_RPMSIGN)
-    project_log(WARNING "GPG_PASSPHRASE_FILE is used for detached signatures only; embedded RPM signing uses rpmsign and the configured GPG agent.")
+    return()
   endif()
 
-  # Validate signing key exists
-  if(ARG_SIGNING_KEY)
-    execute_process(
-      COMMAND ${GPG_EXECUTABLE} --list-secret-keys "${ARG_SIGNING_KEY}"
-      RESULT_VARIABLE gpg_result
-      OUTPUT_QUIET ERROR_QUIET)
-
-    if(NOT gpg_result EQUAL 0)
-      project_log(FATAL_ERROR "GPG signing key '${ARG_SIGNING_KEY}' not found in keyring or no private key available.")
-    endif()
+  if(NOT COMMAND _tip_configure_signing_script)
+    _tip_find_export_cpack_resource_file("tip_signing.cmake" _tip_signing_module)
+    include("${_tip_signing_module}")
   endif()
-
-  # Generate signing script
-  _tip_find_export_cpack_resource_file("sign_packages.cmake.in" _tip_sign_packages_template)
-  configure_file("${_tip_sign_packages_template}" "${CMAKE_BINARY_DIR}/sign_packages.cmake" @ONLY)
-
-  # Set CPack post-build script
-  _tip_store_cpack_var(CPACK_POST_BUILD_SCRIPTS "${CMAKE_BINARY_DIR}/sign_packages.cmake")
-
-  if(ARG_SIGNING_KEY)
-    project_log(STATUS "GPG package signing configured:")
-    project_log(STATUS "  Signing key: ${ARG_SIGNING_KEY}")
-    project_log(STATUS "  Signing method: ${ARG_SIGNING_METHOD}")
-    project_log(STATUS "  Post-build checksums: ${ARG_CHECKSUMS}")
-    project_log(STATUS "  Post-build script: ${CMAKE_BINARY_DIR}/sign_packages.cmake")
-  else()
-    project_log(STATUS "CPack checksum generation configured:")
-    project_log(STATUS "  Post-build checksums: ${ARG_CHECKSUMS}")
-    project_log(STATUS "  Post-build script: ${CMAKE_BINARY_DIR}/sign_packages.cmake")
+  _tip_configure_signing_script()
+  if(TIP_PROFILE)
+    _tip_profile_end()
   endif()
 
 endfunction(_configure_gpg_signing)
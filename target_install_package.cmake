@@ -27,6 +27,15 @@ if(POLICY CMP0177)
   cmake_policy(SET CMP0177 NEW)
 endif()
 
+# Opt-in configure-time profiling (TIP_PROFILE). The source tree keeps the helper under cmake/, installs keep it flat.
+if(NOT COMMAND _tip_profile_begin)
+  if(EXISTS "${CMAKE_CURRENT_LIST_DIR}/cmake/tip_profile.cmake")
+    include("${CMAKE_CURRENT_LIST_DIR}/cmake/tip_profile.cmake")
+  else()
+    include("${CMAKE_CURRENT_LIST_DIR}/tip_profile.cmake")
+  endif()
+endif()
+
 # Show log level tip only once per CMake run
 if(COMMAND project_log)
   project_log(STATUS "Tip: Use --log-level=VERBOSE for installation details, --log-level=DEBUG for all settings")
@@ -53,6 +62,13 @@ endif()
 #     VERSION <version>
 #     COMPATIBILITY <compatibility>
 #     ARCH_INDEPENDENT
+#     FLATTEN_CONFIG
+#     SHARD_BY_COMPONENT
+#     FLATTEN_DEPENDENCIES
+#     BAKE_DEPENDENCY_HINTS
+#     BUILD_TREE_EXPORT
+#     HEADER_COST_REPORT
+#     INSTALL_MANIFEST
 #     EXPORT_NAME <export_name>
 #     CONFIG_TEMPLATE <template_path>
 #     INCLUDE_DESTINATION <include_dest>
@@ -69,6 +85,7 @@ endif()
 #     INCLUDE_ON_FIND_PACKAGE <files...>
 #     COMPONENT_DEPENDENCIES <component> <deps...> [<component> <deps...>]...
 #     CPS
+#     CPS_PRIMARY
 #     CPS_PACKAGE_NAME <package_name>
 #     CPS_PROJECT <project_name>
 #     CPS_NO_PROJECT_METADATA
@@ -111,6 +128,24 @@ endif()
 #   VERSION                      - Version of the package (default: `${PROJECT_VERSION}`).
 #   COMPATIBILITY                - Version compatibility mode (default: "SameMajorVersion").
 #   ARCH_INDEPENDENT             - Disable architecture suitability checks in the generated package version file.
+#   FLATTEN_CONFIG               - Inline the installed <Export>Targets.cmake and its per-configuration files into the
+#                                  installed <Export>Config.cmake, so find_package() reads one file per package.
+#   SHARD_BY_COMPONENT           - Install the imported targets of each COMPONENT to their own file, and load only the
+#                                  components passed to find_package(COMPONENTS) and the components they link to.
+#   FLATTEN_DEPENDENCIES         - Load the whole transitive closure of PUBLIC_DEPENDENCIES from the generated config,
+#                                  leaf first, instead of relying on each dependency's config to load its own.
+#   BAKE_DEPENDENCY_HINTS        - Preset <Dep>_DIR in the generated config for every dependency whose config was found
+#                                  inside CMAKE_INSTALL_PREFIX, relative to the installed config, so consumers of a
+#                                  relocated bundle skip the search. The usual search remains the fallback.
+#   BUILD_TREE_EXPORT            - Also export the targets from the build tree with a config and version file in
+#                                  ${CMAKE_BINARY_DIR}/<CMAKE_CONFIG_DESTINATION>, so consumers can find the package
+#                                  in the build directory and use rebuilt libraries without installing them.
+#   HEADER_COST_REPORT           - Add an <Export>_header_cost target, built by tip_header_cost, that compiles each
+#                                  installed header on its own and reports its frontend time, preprocessed lines and
+#                                  included headers. The target fails when a header is not self-contained.
+#   INSTALL_MANIFEST             - Write <Export>.manifest, or <Export>-<Component>.manifest for a component install,
+#                                  to the config directory with the SHA-256, size, mode and path of every file the
+#                                  install placed, and keep installed files whose content is unchanged on reinstall.
 #   EXPORT_NAME                  - Name of the CMake export file (default: `${TARGET_NAME}`).
 #   CONFIG_TEMPLATE              - Optional path to a CMake config template.
 #                                  Source of truth for resolution order:
@@ -122,7 +157,9 @@ endif()
 #   COMPONENT                    - Optional runtime component name. Development files stay in the shared `Development` component.
 #                                  If omitted, uses default "Runtime" and "Development" components.
 #   DEBUG_POSTFIX                - Debug postfix for library names (default: "d").
-#   ADDITIONAL_FILES             - Additional files to install, relative to source dir.
+#   ADDITIONAL_FILES             - Additional files, directories or file(GLOB) patterns to install, relative to source
+#                                  dir. A directory keeps its subdirectories; with a trailing slash its contents go
+#                                  directly to the destination.
 #   ADDITIONAL_FILES_DESTINATION - Destination for additional files (default: install prefix root).
 #   ADDITIONAL_FILES_COMPONENTS  - Optional install components for additional files. If omitted, files use the development component.
 #   ADDITIONAL_TARGETS           - Additional targets to include in the same export set.
@@ -130,6 +167,8 @@ endif()
 #   INCLUDE_ON_FIND_PACKAGE     - Additional CMake files to include when package is found.
 #   COMPONENT_DEPENDENCIES       - Component-specific dependencies (pairs: component name, dependencies).
 #   CPS                          - Generate Common Package Specification metadata for the whole export with CMake 4.3+.
+#   CPS_PRIMARY                  - Make the .cps file the entry point. The generated config becomes a thin fallback
+#                                  that loads the .cps file on CMake 4.3+ and the targets file before that.
 #   CPS_*                        - Options forwarded to install(PACKAGE_INFO ...). CPS version metadata defaults from VERSION unless CPS_PROJECT inherits it.
 #                                  If CPS_DEFAULT_TARGETS is omitted, only static, shared, and interface library aliases are default CPS targets.
 #                                  This wrapper rejects executables and CMake MODULE_LIBRARY targets for CPS exports.
@@ -152,6 +191,12 @@ endif()
 #   - Supports multi-config builds with automatic debug postfix handling.
 #   - Allows custom installation destinations and component separation.
 #   - Automatically configures RPATH on Unix/Linux/macOS for relocatable installations (skipped for system directories like /usr).
+#   - With TIP_INSTALL_LINK_MODE set to reflink or hardlink, installs binaries, header file sets and additional files as
+#     copy-on-write clones or hardlinks where the filesystem allows it (see cmake/tip_install_links.cmake).
+#   - With LAYOUT content_store, installs like fhs and then replaces each installed file with a hardlink into a
+#     content-addressed store shared by all prefixes (see cmake/tip_content_store.cmake).
+#   - Registers nothing when TIP_SKIP_INSTALL or CMAKE_SKIP_INSTALL_RULES is set, or, with TIP_SKIP_EXCLUDED_FROM_ALL,
+#     when the target is EXCLUDE_FROM_ALL (see _tip_resolve_install_skip).
 #
 # Examples:
 #   # Basic installation
@@ -185,13 +230,7 @@ endif()
 #     DISABLE_RPATH)
 # ~~~
 function(target_install_package TARGET_NAME)
-  # Parse arguments to extract EXPORT_NAME and new multi-config parameters
-  set(options "")
-  set(oneValueArgs EXPORT_NAME DEBUG_POSTFIX)
-  set(multiValueArgs "")
-  cmake_parse_arguments(ARG "${options}" "${oneValueArgs}" "${multiValueArgs}" ${ARGN})
-
-  # Forward all arguments the implementation, target_prepare_package
+  # Forward all arguments to the implementation, target_prepare_package
   target_prepare_package(${TARGET_NAME} ${ARGN})
 
   # ~~~
@@ -201,6 +240,115 @@ function(target_install_package TARGET_NAME)
   # ~~~
 endfunction(target_install_package)
 
+# ~~~
+# Register several targets of one export in a single call.
+#
+# Produces the same install rules as one target_install_package() call per target with the
+# same options, but parses the arguments once and resolves the export-level settings (layout
+# defaults, version, destinations, CPS/SBOM metadata, dependencies) once for the whole list.
+#
+# API:
+#   target_install_packages(
+#     TARGETS <targets...>
+#     EXPORT_NAME <export_name>
+#     [<target_install_package() options except ALIAS_NAME>...]
+#     [TARGET <target>
+#       [ALIAS_NAME <alias_name>]
+#       [COMPONENT <component>]
+#       [LAYOUT <layout>]
+#       [DISABLE_RPATH]
+#       [ADDITIONAL_FILES <files...>]
+#       [ADDITIONAL_FILES_DESTINATION <dest>]
+#       [ADDITIONAL_FILES_COMPONENTS <components...>]
+#       [ADDITIONAL_TARGETS <targets...>]]...)
+#
+# Parameters:
+#   TARGETS     - Targets to install, in registration order.
+#   EXPORT_NAME - Export shared by all targets (required).
+#   TARGET      - Starts the per-target overrides for one target listed in TARGETS. Every option
+#                 before the first TARGET applies to all targets; an override replaces the shared
+#                 value for that target only.
+#
+# Example:
+#   target_install_packages(
+#     TARGETS core utils tool
+#     EXPORT_NAME mypkg
+#     NAMESPACE mypkg::
+#     VERSION 1.2.3
+#     PUBLIC_DEPENDENCIES "fmt 10 REQUIRED"
+#     TARGET tool COMPONENT Tools ALIAS_NAME cli)
+# ~~~
+function(target_install_packages)
+  # Everything before the first TARGET keyword is shared. Each TARGET <target> starts that target's override list.
+  set(_tip_shared_args "")
+  set(_tip_override_targets "")
+  set(_tip_in_target_section FALSE)
+  set(_tip_section_target "")
+  foreach(_tip_arg IN LISTS ARGN)
+    if(_tip_arg STREQUAL "TARGET")
+      if(_tip_in_target_section AND _tip_section_target STREQUAL "")
+        project_log(FATAL_ERROR "target_install_packages(): TARGET requires a target name.")
+      endif()
+      set(_tip_in_target_section TRUE)
+      set(_tip_section_target "")
+    elseif(_tip_in_target_section AND _tip_section_target STREQUAL "")
+      if(_tip_arg IN_LIST _tip_override_targets)
+        project_log(FATAL_ERROR "target_install_packages(): TARGET '${_tip_arg}' is given more than once.")
+      endif()
+      set(_tip_section_target "${_tip_arg}")
+      list(APPEND _tip_override_targets "${_tip_arg}")
+      set(_tip_section_args_${_tip_arg} "")
+    elseif(_tip_in_target_section)
+      list(APPEND _tip_section_args_${_tip_section_target} "${_tip_arg}")
+    else()
+      list(APPEND _tip_shared_args "${_tip_arg}")
+    endif()
+  endforeach()
+  if(_tip_in_target_section AND _tip_section_target STREQUAL "")
+    project_log(FATAL_ERROR "target_install_packages(): TARGET requires a target name.")
+  endif()
+
+  _tip_package_argument_keywords()
+  cmake_parse_arguments(ARG "${_tip_package_options}" "${_tip_package_one_value_args}" "TARGETS;${_tip_package_multi_value_args}" ${_tip_shared_args})
+  if(ARG_UNPARSED_ARGUMENTS)
+    project_log(FATAL_ERROR "Unknown arguments for target_install_packages(): ${ARG_UNPARSED_ARGUMENTS}")
+  endif()
+  if(NOT ARG_TARGETS)
+    project_log(FATAL_ERROR "target_install_packages() requires TARGETS.")
+  endif()
+  if(NOT ARG_EXPORT_NAME)
+    project_log(FATAL_ERROR "target_install_packages() requires EXPORT_NAME.")
+  endif()
+  if(NOT "${ARG_ALIAS_NAME}" STREQUAL "")
+    project_log(FATAL_ERROR "target_install_packages(): ALIAS_NAME names a single target. Use TARGET <target> ALIAS_NAME <alias_name>.")
+  endif()
+  if(ARG_PUBLIC_CMAKE_FILES)
+    project_log(FATAL_ERROR "target_install_packages(): PUBLIC_CMAKE_FILES is not supported. Use INCLUDE_ON_FIND_PACKAGE instead.")
+  endif()
+
+  foreach(_tip_override_target IN LISTS _tip_override_targets)
+    if(NOT _tip_override_target IN_LIST ARG_TARGETS)
+      project_log(FATAL_ERROR "target_install_packages(): TARGET '${_tip_override_target}' is not listed in TARGETS.")
+    endif()
+    cmake_parse_arguments(_tip_target_override "${_tip_package_target_options}" "${_tip_package_target_one_value_args}" "${_tip_package_target_multi_value_args}"
+                          ${_tip_section_args_${_tip_override_target}})
+    if(_tip_target_override_UNPARSED_ARGUMENTS)
+      project_log(FATAL_ERROR "Unknown arguments for target_install_packages() TARGET '${_tip_override_target}': ${_tip_target_override_UNPARSED_ARGUMENTS}. "
+                  "Per-target options: ${_tip_package_target_options} ${_tip_package_target_one_value_args} ${_tip_package_target_multi_value_args}")
+    endif()
+    if(_tip_target_override_DISABLE_RPATH)
+      set(_tip_override_${_tip_override_target}_DISABLE_RPATH TRUE)
+    endif()
+    foreach(_tip_target_keyword IN LISTS _tip_package_target_one_value_args _tip_package_target_multi_value_args)
+      if(DEFINED _tip_target_override_${_tip_target_keyword})
+        set(_tip_override_${_tip_override_target}_${_tip_target_keyword} "${_tip_target_override_${_tip_target_keyword}}")
+      endif()
+    endforeach()
+  endforeach()
+
+  _tip_prepare_package_targets("${ARG_TARGETS}" TRUE)
+endfunction(target_install_packages)
+
 function(_tip_find_target_install_package_resource_file file_name out_var)
   set(_tip_resource_candidates "${CMAKE_CURRENT_FUNCTION_LIST_DIR}/${file_name}" "${CMAKE_CURRENT_FUNCTION_LIST_DIR}/cmake/${file_name}")
   foreach(_tip_resource_candidate IN LISTS _tip_resource_candidates)
@@ -215,6 +363,26 @@ function(_tip_find_target_install_package_resource_file file_name out_var)
   project_log(FATAL_ERROR "Package resource '${file_name}' not found. Checked: ${_tip_resource_candidates}")
 endfunction()
 
+# ~~~
+# Include a feature module (tip_cps, tip_sbom, tip_rpath, tip_flatten_config or tip_component_shards) the first time a
+# call needs it. CPS, SBOM, default RPATH, flattened config and component sharding support are kept out of this file so
+# projects that include it without using those features, such as every subproject of a superbuild, do not pay to parse
+# them.
+#
+# API:
+#   _tip_load_feature_module(<module>)
+# ~~~
+function(_tip_load_feature_module MODULE_NAME)
+  get_property(_tip_module_loaded GLOBAL PROPERTY "_TIP_FEATURE_MODULE_${MODULE_NAME}_LOADED")
+  if(_tip_module_loaded)
+    return()
+  endif()
+  _tip_find_target_install_package_resource_file("${MODULE_NAME}.cmake" _tip_module_file)
+  include("${_tip_module_file}")
+  set_property(GLOBAL PROPERTY "_TIP_FEATURE_MODULE_${MODULE_NAME}_LOADED" TRUE)
+  project_log(DEBUG "Loaded feature module '${_tip_module_file}'")
+endfunction()
+
 function(_tip_resolve_absolute_paths RESULT_VAR BASE_DIR)
   set(_tip_resolved_paths "")
   foreach(_tip_path IN LISTS ARGN)
@@ -238,272 +406,195 @@ function(_tip_resolve_absolute_paths RESULT_VAR BASE_DIR)
       PARENT_SCOPE)
 endfunction()
 
-function(_tip_store_export_property EXPORT_PROPERTY_PREFIX EXPORT_NAME PROPERTY_SUFFIX VALUE DESCRIPTION)
-  get_property(_tip_existing GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_${PROPERTY_SUFFIX}")
-
-  if(NOT DEFINED _tip_existing OR "${_tip_existing}" STREQUAL "")
-    set_property(GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_${PROPERTY_SUFFIX}" "${VALUE}")
-    return()
-  endif()
-
-  if(NOT "${VALUE}" STREQUAL "" AND NOT "${_tip_existing}" STREQUAL "${VALUE}")
-    project_log(FATAL_ERROR "Conflicting ${DESCRIPTION} for export '${EXPORT_NAME}': '${_tip_existing}' vs '${VALUE}'")
-  endif()
-endfunction()
-
-function(_tip_append_export_property_unique EXPORT_PROPERTY_PREFIX PROPERTY_SUFFIX)
-  set(_tip_values ${ARGN})
-  list(LENGTH _tip_values _tip_values_count)
-  if(_tip_values_count EQUAL 0)
-    return()
-  endif()
+# ~~~
+# Packed export registry.
+#
+# Each export keeps its shared settings in a few GLOBAL records instead of one property per setting, where <prefix> is
+# _CMAKE_PACKAGE_EXPORT_<export>:
+#
+#   <prefix>_TARGETS                  Targets of the export, in registration order
+#   <prefix>_RECORD                   Shared settings (_TIP_EXPORT_RECORD_FIELDS)
+#   <prefix>_CPS_RECORD               CPS settings, only written when CPS is used (_TIP_EXPORT_CPS_RECORD_FIELDS)
+#   <prefix>_SBOM_RECORD              SBOM settings, only written when SBOM is used (_TIP_EXPORT_SBOM_RECORD_FIELDS)
+#   <prefix>_TARGET_<target>_RECORD   Per-target settings (_TIP_TARGET_RECORD_FIELDS)
+#
+# A record is a keyword-tagged list ("<FIELD> <values...>" for every field), decoded with one cmake_parse_arguments()
+# call that takes the field list as multi-value keywords:
+#
+#   get_property(_tip_fields GLOBAL PROPERTY _TIP_EXPORT_RECORD_FIELDS)
+#   get_property(_tip_record GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_RECORD")
+#   _tip_decode_record(_tip_export _tip_fields _tip_record)
+#
+# Every element of a non-empty value is stored with a leading `=`, which decoding strips again. A value spelled like a
+# field name is then no keyword, and an empty element inside a value is kept instead of being dropped by
+# cmake_parse_arguments().
+# ~~~
+set_property(
+  GLOBAL
+  PROPERTY _TIP_EXPORT_RECORD_FIELDS
+           NAMESPACE
+           VERSION
+           VERSION_EXPLICIT
+           COMPATIBILITY
+           ARCH_INDEPENDENT
+           FLATTEN_CONFIG
+           SHARD_BY_COMPONENT
+           FLATTEN_DEPENDENCIES
+           BAKE_DEPENDENCY_HINTS
+           BUILD_TREE_EXPORT
+           HEADER_COST_REPORT
+           INSTALL_MANIFEST
+           CONFIG_TEMPLATE
+           INCLUDE_DESTINATION
+           MODULE_DESTINATION
+           SOURCE_DESTINATION
+           CMAKE_CONFIG_DESTINATION
+           DEBUG_POSTFIX
+           CONFIG_DEV_COMPONENT
+           CURRENT_SOURCE_DIR
+           CURRENT_BINARY_DIR
+           PUBLIC_DEPENDENCIES
+           TRANSITIVE_DEPENDENCIES
+           INCLUDE_ON_FIND_PACKAGE
+           COMPONENT_DEPENDENCY_COMPONENTS)
+set_property(
+  GLOBAL
+  PROPERTY _TIP_EXPORT_CPS_RECORD_FIELDS
+           CPS_ENABLED
+           CPS_PRIMARY
+           CPS_PACKAGE_NAME
+           CPS_PROJECT
+           CPS_NO_PROJECT_METADATA
+           CPS_APPENDIX
+           CPS_DESTINATION
+           CPS_LOWER_CASE_FILE
+           CPS_VERSION
+           CPS_VERSION_EXPLICIT
+           CPS_COMPAT_VERSION
+           CPS_VERSION_SCHEMA
+           CPS_DEFAULT_TARGETS
+           CPS_DEFAULT_CONFIGURATIONS
+           CPS_LICENSE
+           CPS_DEFAULT_LICENSE
+           CPS_DESCRIPTION
+           CPS_HOMEPAGE_URL
+           CPS_PERMISSIONS
+           CPS_CONFIGURATIONS
+           CPS_CXX_MODULES_DIRECTORY
+           CPS_COMPONENT
+           CPS_EXCLUDE_FROM_ALL)
+set_property(
+  GLOBAL
+  PROPERTY _TIP_EXPORT_SBOM_RECORD_FIELDS
+           SBOM_ENABLED
+           SBOM_EXPERIMENTAL_VALUE
+           SBOM_METADATA_MODE
+           SBOM_NAME
+           SBOM_PROJECT
+           SBOM_NO_PROJECT_METADATA
+           SBOM_INHERITED_PROJECT_METADATA
+           SBOM_DESTINATION
+           SBOM_VERSION
+           SBOM_VERSION_EXPLICIT
+           SBOM_INHERITED_VERSION
+           SBOM_LICENSE
+           SBOM_INHERITED_LICENSE
+           SBOM_DESCRIPTION
+           SBOM_INHERITED_DESCRIPTION
+           SBOM_HOMEPAGE_URL
+           SBOM_INHERITED_HOMEPAGE_URL
+           SBOM_PACKAGE_URL
+           SBOM_FORMAT)
+set_property(
+  GLOBAL
+  PROPERTY _TIP_TARGET_RECORD_FIELDS
+           RUNTIME_COMPONENT
+           DEVELOPMENT_COMPONENT
+           DEVELOPMENT_COMPONENT_EXPLICIT
+           COMPONENT
+           COMPONENT_EXPLICIT
+           ALIAS_NAME
+           ALIAS_NAME_EXPLICIT
+           ADDITIONAL_FILES
+           ADDITIONAL_FILES_DESTINATION
+           ADDITIONAL_FILES_SOURCE_DIR
+           ADDITIONAL_FILES_COMPONENTS)
 
-  get_property(_tip_existing GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_${PROPERTY_SUFFIX}")
-  set(_tip_updated ${_tip_existing} ${_tip_values})
-  list(REMOVE_DUPLICATES _tip_updated)
-  set_property(GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_${PROPERTY_SUFFIX}" "${_tip_updated}")
+# ~~~
+# Define FUNCTION_NAME(RECORD_PROPERTY IN_PREFIX), which encodes the caller's <IN_PREFIX><FIELD> variables into
+# RECORD_PROPERTY. The field list is expanded into straight-line code once here, so encoding a record runs no loop over
+# its fields. An empty value is stored as no elements at all.
+# ~~~
+function(_tip_define_record_encoder FUNCTION_NAME FIELDS_PROPERTY)
+  get_property(_tip_record_fields GLOBAL PROPERTY "${FIELDS_PROPERTY}")
+  set(_tip_record_code "function(${FUNCTION_NAME} RECORD_PROPERTY IN_PREFIX)\n")
+  set(_tip_record_set "  set(_tip_record")
+  foreach(_tip_record_field IN LISTS _tip_record_fields)
+    string(APPEND _tip_record_code
+      "  set(_tip_record_${_tip_record_field} \"\")\n"
+      "  if(NOT \"\${\${IN_PREFIX}${_tip_record_field}}\" STREQUAL \"\")\n"
+      "    string(REPLACE \";\" \";=\" _tip_record_${_tip_record_field} \"=\${\${IN_PREFIX}${_tip_record_field}}\")\n"
+      "  endif()\n")
+    string(APPEND _tip_record_set " ${_tip_record_field} \${_tip_record_${_tip_record_field}}")
+  endforeach()
+  string(APPEND _tip_record_code "${_tip_record_set})\n  set_property(GLOBAL PROPERTY \"\${RECORD_PROPERTY}\" \"\${_tip_record}\")\nendfunction()\n")
+  cmake_language(EVAL CODE "${_tip_record_code}")
 endfunction()
 
-function(_tip_derive_cps_compat_version OUT_VAR VERSION COMPATIBILITY VERSION_SCHEMA)
-  set(_tip_compat_version "")
-
-  if(NOT "${VERSION_SCHEMA}" STREQUAL "" AND NOT "${VERSION_SCHEMA}" STREQUAL "simple")
-    set(${OUT_VAR}
-        ""
-        PARENT_SCOPE)
-    return()
-  endif()
-
-  if("${COMPATIBILITY}" STREQUAL "ExactVersion"
-     OR "${COMPATIBILITY}" STREQUAL "SamePatchVersion"
-     OR "${COMPATIBILITY}" STREQUAL "SameFullVersion")
-    set(${OUT_VAR}
-        ""
-        PARENT_SCOPE)
-    return()
-  endif()
-
-  if("${COMPATIBILITY}" STREQUAL "AnyNewerVersion")
-    set(_tip_compat_version "0.0.0")
-  elseif("${VERSION}" MATCHES "^([0-9]+)(\\.([0-9]+))?(\\.([0-9]+))?.*$")
-    set(_tip_major "${CMAKE_MATCH_1}")
-    set(_tip_minor "${CMAKE_MATCH_3}")
-    if(_tip_minor STREQUAL "")
-      set(_tip_minor "0")
-    endif()
-
-    if("${COMPATIBILITY}" STREQUAL "SameMajorVersion")
-      set(_tip_compat_version "${_tip_major}.0.0")
-    elseif("${COMPATIBILITY}" STREQUAL "SameMinorVersion")
-      set(_tip_compat_version "${_tip_major}.${_tip_minor}.0")
-    elseif("${COMPATIBILITY}" STREQUAL "SemanticVersion")
-      if(_tip_major EQUAL 0)
-        set(_tip_compat_version "0.${_tip_minor}.0")
-      else()
-        set(_tip_compat_version "${_tip_major}.0.0")
+# ~~~
+# Decode the record in the variable RECORD_VAR into <OUT_PREFIX>_<FIELD> variables, for the fields listed in the
+# variable FIELDS_VAR, and strip the `=` the encoder put in front of every value element. Most records are unescaped
+# with one string(REPLACE) ahead of cmake_parse_arguments(); a record with a value spelled like a field name, or with
+# an empty element inside a non-empty value, is parsed first and unescaped field by field.
+# ~~~
+macro(_tip_decode_record OUT_PREFIX FIELDS_VAR RECORD_VAR)
+  list(JOIN ${FIELDS_VAR} "|" _tip_decode_fields)
+  if("${${RECORD_VAR}}" MATCHES "(^|;)=(${_tip_decode_fields}|)(;|$)")
+    cmake_parse_arguments("${OUT_PREFIX}" "" "" "${${FIELDS_VAR}}" ${${RECORD_VAR}})
+    foreach(_tip_decode_field IN LISTS ${FIELDS_VAR})
+      if(DEFINED "${OUT_PREFIX}_${_tip_decode_field}")
+        list(TRANSFORM "${OUT_PREFIX}_${_tip_decode_field}" REPLACE "^=" "")
       endif()
-    endif()
-  endif()
-
-  set(${OUT_VAR}
-      "${_tip_compat_version}"
-      PARENT_SCOPE)
-endfunction()
-
-function(_tip_is_cmake_boolean_literal OUT_VAR VALUE)
-  string(TOUPPER "${VALUE}" _tip_upper_value)
-
-  if("${_tip_upper_value}" MATCHES "^(0|1|ON|OFF|YES|NO|TRUE|FALSE|Y|N|IGNORE|NOTFOUND)$" OR "${_tip_upper_value}" MATCHES ".*-NOTFOUND$")
-    set(${OUT_VAR}
-        TRUE
-        PARENT_SCOPE)
+    endforeach()
   else()
-    set(${OUT_VAR}
-        FALSE
-        PARENT_SCOPE)
+    string(REPLACE ";=" ";" _tip_decode_record "${${RECORD_VAR}}")
+    cmake_parse_arguments("${OUT_PREFIX}" "" "" "${${FIELDS_VAR}}" ${_tip_decode_record})
   endif()
-endfunction()
+endmacro()
 
-function(_tip_validate_sbom_activation EXPORT_NAME)
-  if(CMAKE_VERSION VERSION_LESS "4.3")
-    project_log(FATAL_ERROR "SBOM metadata requires CMake 4.3 or newer because it uses install(SBOM).")
-  endif()
+_tip_define_record_encoder(_tip_encode_export_record _TIP_EXPORT_RECORD_FIELDS)
+_tip_define_record_encoder(_tip_encode_export_cps_record _TIP_EXPORT_CPS_RECORD_FIELDS)
+_tip_define_record_encoder(_tip_encode_export_sbom_record _TIP_EXPORT_SBOM_RECORD_FIELDS)
+_tip_define_record_encoder(_tip_encode_target_record _TIP_TARGET_RECORD_FIELDS)
 
-  if(NOT DEFINED CMAKE_EXPERIMENTAL_GENERATE_SBOM OR "${CMAKE_EXPERIMENTAL_GENERATE_SBOM}" STREQUAL "")
-    project_log(FATAL_ERROR "SBOM metadata for export '${EXPORT_NAME}' requires CMAKE_EXPERIMENTAL_GENERATE_SBOM to be set to the activation value for this CMake version.")
-  endif()
+# Merge VALUE into the decoded export field <RECORD_PREFIX><FIELD>. An empty value never overrides, and a different non-empty value is a conflict.
+function(_tip_merge_export_field RECORD_PREFIX EXPORT_NAME FIELD VALUE DESCRIPTION)
+  set(_tip_existing "${${RECORD_PREFIX}${FIELD}}")
 
-  _tip_is_cmake_boolean_literal(_tip_sbom_activation_is_boolean "${CMAKE_EXPERIMENTAL_GENERATE_SBOM}")
-  if(_tip_sbom_activation_is_boolean)
-    project_log(FATAL_ERROR "SBOM metadata for export '${EXPORT_NAME}' requires CMAKE_EXPERIMENTAL_GENERATE_SBOM " "to be set to the activation value for this CMake version, not a boolean toggle "
-                "such as '${CMAKE_EXPERIMENTAL_GENERATE_SBOM}'.")
-  endif()
-endfunction()
-
-function(_tip_resolve_sbom_export_metadata EXPORT_NAME OUT_PREFIX)
-  set(_tip_export_property_prefix "_CMAKE_PACKAGE_EXPORT_${EXPORT_NAME}")
-  foreach(
-    _tip_property IN
-    ITEMS VERSION
-          VERSION_EXPLICIT
-          SBOM_NAME
-          SBOM_PROJECT
-          SBOM_DESTINATION
-          SBOM_VERSION
-          SBOM_VERSION_EXPLICIT
-          SBOM_INHERITED_VERSION
-          SBOM_LICENSE
-          SBOM_INHERITED_LICENSE
-          SBOM_DESCRIPTION
-          SBOM_INHERITED_DESCRIPTION
-          SBOM_HOMEPAGE_URL
-          SBOM_INHERITED_HOMEPAGE_URL
-          SBOM_PACKAGE_URL
-          SBOM_FORMAT
-          SBOM_METADATA_MODE
-          SBOM_EXPERIMENTAL_VALUE)
-    get_property(_tip_${_tip_property} GLOBAL PROPERTY "${_tip_export_property_prefix}_${_tip_property}")
-  endforeach()
-
-  if("${_tip_SBOM_NAME}" STREQUAL "")
-    set(_tip_SBOM_NAME "${EXPORT_NAME}")
-  endif()
-
-  set(_tip_effective_version "")
-  if(_tip_SBOM_VERSION_EXPLICIT)
-    set(_tip_effective_version "${_tip_SBOM_VERSION}")
-  elseif(_tip_VERSION_EXPLICIT)
-    set(_tip_effective_version "${_tip_VERSION}")
-  elseif(NOT "${_tip_SBOM_INHERITED_VERSION}" STREQUAL "")
-    set(_tip_effective_version "${_tip_SBOM_INHERITED_VERSION}")
-  elseif("${_tip_SBOM_PROJECT}" STREQUAL "")
-    set(_tip_effective_version "${_tip_VERSION}")
-  endif()
-
-  set(_tip_effective_license "${_tip_SBOM_LICENSE}")
-  if("${_tip_effective_license}" STREQUAL "")
-    set(_tip_effective_license "${_tip_SBOM_INHERITED_LICENSE}")
-  endif()
-
-  set(_tip_effective_description "${_tip_SBOM_DESCRIPTION}")
-  if("${_tip_effective_description}" STREQUAL "")
-    set(_tip_effective_description "${_tip_SBOM_INHERITED_DESCRIPTION}")
+  if("${_tip_existing}" STREQUAL "")
+    set(${RECORD_PREFIX}${FIELD}
+        "${VALUE}"
+        PARENT_SCOPE)
+    return()
   endif()
 
-  set(_tip_effective_homepage_url "${_tip_SBOM_HOMEPAGE_URL}")
-  if("${_tip_effective_homepage_url}" STREQUAL "")
-    set(_tip_effective_homepage_url "${_tip_SBOM_INHERITED_HOMEPAGE_URL}")
+  if(NOT "${VALUE}" STREQUAL "" AND NOT "${_tip_existing}" STREQUAL "${VALUE}")
+    project_log(FATAL_ERROR "Conflicting ${DESCRIPTION} for export '${EXPORT_NAME}': '${_tip_existing}' vs '${VALUE}'")
   endif()
-
-  set(${OUT_PREFIX}_NAME
-      "${_tip_SBOM_NAME}"
-      PARENT_SCOPE)
-  set(${OUT_PREFIX}_DESTINATION
-      "${_tip_SBOM_DESTINATION}"
-      PARENT_SCOPE)
-  set(${OUT_PREFIX}_VERSION
-      "${_tip_effective_version}"
-      PARENT_SCOPE)
-  set(${OUT_PREFIX}_LICENSE
-      "${_tip_effective_license}"
-      PARENT_SCOPE)
-  set(${OUT_PREFIX}_DESCRIPTION
-      "${_tip_effective_description}"
-      PARENT_SCOPE)
-  set(${OUT_PREFIX}_HOMEPAGE_URL
-      "${_tip_effective_homepage_url}"
-      PARENT_SCOPE)
-  set(${OUT_PREFIX}_PACKAGE_URL
-      "${_tip_SBOM_PACKAGE_URL}"
-      PARENT_SCOPE)
-  set(${OUT_PREFIX}_FORMAT
-      "${_tip_SBOM_FORMAT}"
-      PARENT_SCOPE)
-  set(${OUT_PREFIX}_METADATA_MODE
-      "${_tip_SBOM_METADATA_MODE}"
-      PARENT_SCOPE)
-  set(${OUT_PREFIX}_EXPERIMENTAL_VALUE
-      "${_tip_SBOM_EXPERIMENTAL_VALUE}"
-      PARENT_SCOPE)
 endfunction()
 
-function(_tip_finalize_all_sboms)
-  get_property(_tip_sboms_finalized GLOBAL PROPERTY "_TIP_SBOMS_FINALIZED")
-  if(_tip_sboms_finalized)
+function(_tip_append_export_field_unique RECORD_PREFIX FIELD)
+  set(_tip_values ${ARGN})
+  list(LENGTH _tip_values _tip_values_count)
+  if(_tip_values_count EQUAL 0)
     return()
   endif()
 
-  get_property(_tip_sbom_group_hashes GLOBAL PROPERTY "_TIP_SBOM_GROUP_HASHES")
-  foreach(_tip_sbom_group_hash IN LISTS _tip_sbom_group_hashes)
-    get_property(_tip_sbom_name GLOBAL PROPERTY "_TIP_SBOM_GROUP_${_tip_sbom_group_hash}_NAME")
-    get_property(_tip_sbom_exports GLOBAL PROPERTY "_TIP_SBOM_GROUP_${_tip_sbom_group_hash}_EXPORTS")
-    list(REMOVE_DUPLICATES _tip_sbom_exports)
-
-    foreach(_tip_sbom_export IN LISTS _tip_sbom_exports)
-      get_property(_tip_export_finalized GLOBAL PROPERTY "_CMAKE_PACKAGE_EXPORT_${_tip_sbom_export}_FINALIZED")
-      if(NOT _tip_export_finalized)
-        finalize_package(EXPORT_NAME "${_tip_sbom_export}")
-      endif()
-    endforeach()
-
-    list(GET _tip_sbom_exports 0 _tip_reference_export)
-    _tip_resolve_sbom_export_metadata("${_tip_reference_export}" _tip_reference)
-
-    foreach(_tip_sbom_export IN LISTS _tip_sbom_exports)
-      _tip_resolve_sbom_export_metadata("${_tip_sbom_export}" _tip_candidate)
-      foreach(
-        _tip_field IN
-        ITEMS NAME
-              DESTINATION
-              VERSION
-              LICENSE
-              DESCRIPTION
-              HOMEPAGE_URL
-              PACKAGE_URL
-              FORMAT
-              METADATA_MODE
-              EXPERIMENTAL_VALUE)
-        if(NOT "${_tip_candidate_${_tip_field}}" STREQUAL "${_tip_reference_${_tip_field}}")
-          string(REPLACE "_" " " _tip_field_description "${_tip_field}")
-          string(TOLOWER "${_tip_field_description}" _tip_field_description)
-          project_log(
-            FATAL_ERROR
-            "Conflicting SBOM ${_tip_field_description} for SBOM '${_tip_sbom_name}' across exports '${_tip_reference_export}' and '${_tip_sbom_export}': '${_tip_reference_${_tip_field}}' vs '${_tip_candidate_${_tip_field}}'."
-          )
-        endif()
-      endforeach()
-    endforeach()
-
-    set(CMAKE_EXPERIMENTAL_GENERATE_SBOM "${_tip_reference_EXPERIMENTAL_VALUE}")
-    _tip_validate_sbom_activation("${_tip_reference_export}")
-
-    if(CMAKE_VERSION VERSION_GREATER_EQUAL "4.4")
-      set(_tip_sbom_args SBOM "${_tip_sbom_name}" EXPORTS ${_tip_sbom_exports})
-    else()
-      list(GET _tip_sbom_exports 0 _tip_sbom_export)
-      set(_tip_sbom_args SBOM "${_tip_sbom_name}" EXPORT "${_tip_sbom_export}")
-    endif()
-    list(APPEND _tip_sbom_args NO_PROJECT_METADATA)
-
-    foreach(
-      _tip_field IN
-      ITEMS DESTINATION
-            VERSION
-            LICENSE
-            DESCRIPTION
-            HOMEPAGE_URL
-            PACKAGE_URL
-            FORMAT)
-      if(NOT "${_tip_reference_${_tip_field}}" STREQUAL "")
-        list(APPEND _tip_sbom_args "${_tip_field}" "${_tip_reference_${_tip_field}}")
-      endif()
-    endforeach()
-
-    install(${_tip_sbom_args})
-    project_log(STATUS "SBOM '${_tip_sbom_name}' is ready for exports: [${_tip_sbom_exports}]")
-  endforeach()
-
-  set_property(GLOBAL PROPERTY "_TIP_SBOMS_FINALIZED" TRUE)
+  set(_tip_updated ${${RECORD_PREFIX}${FIELD}} ${_tip_values})
+  list(REMOVE_DUPLICATES _tip_updated)
+  set(${RECORD_PREFIX}${FIELD}
+      "${_tip_updated}"
+      PARENT_SCOPE)
 endfunction()
 
 function(_tip_component_dependency_property_name OUT_VAR EXPORT_PROPERTY_PREFIX COMPONENT_NAME)
@@ -532,12 +623,44 @@ function(_tip_append_cpack_component_dependencies COMPONENT_NAME)
     return()
   endif()
 
+  # Append-only: a marker property per (component, dependency) pair keeps the list unique without rereading it
   _tip_cpack_component_dependency_property_name(_tip_component_dependency_property "${COMPONENT_NAME}")
-  get_property(_tip_existing_dependencies GLOBAL PROPERTY "${_tip_component_dependency_property}")
-  set(_tip_updated_dependencies ${_tip_existing_dependencies} ${_tip_dependencies})
-  list(REMOVE_ITEM _tip_updated_dependencies "${COMPONENT_NAME}")
-  list(REMOVE_DUPLICATES _tip_updated_dependencies)
-  set_property(GLOBAL PROPERTY "${_tip_component_dependency_property}" "${_tip_updated_dependencies}")
+  foreach(_tip_dependency IN LISTS _tip_dependencies)
+    get_property(_tip_dependency_known GLOBAL PROPERTY "${_tip_component_dependency_property}/${_tip_dependency}" SET)
+    if(NOT _tip_dependency_known)
+      set_property(GLOBAL PROPERTY "${_tip_component_dependency_property}/${_tip_dependency}" TRUE)
+      set_property(GLOBAL APPEND PROPERTY "${_tip_component_dependency_property}" "${_tip_dependency}")
+    endif()
+  endforeach()
+endfunction()
+
+# ~~~
+# Add components to the CPack auto-detection registry PROPERTY_NAME (_TIP_DETECTED_COMPONENTS or
+# _TIP_DETECTED_RUNTIME_COMPONENTS), keeping first-registration order. A marker property per registered component
+# makes each addition a keyed lookup plus an append instead of a scan of the whole list.
+# ~~~
+function(_tip_register_detected_components PROPERTY_NAME)
+  foreach(_tip_component ${ARGN})
+    get_property(_tip_component_known GLOBAL PROPERTY "${PROPERTY_NAME}/${_tip_component}" SET)
+    if(NOT _tip_component_known)
+      set_property(GLOBAL PROPERTY "${PROPERTY_NAME}/${_tip_component}" TRUE)
+      set_property(GLOBAL APPEND PROPERTY "${PROPERTY_NAME}" "${_tip_component}")
+    endif()
+  endforeach()
+endfunction()
+
+# ~~~
+# Record that the components in ARGN install the same files, so the parallel install driver of
+# cmake/tip_parallel_install.cmake runs them one after another. Nothing is recorded for a single component.
+# ~~~
+function(_tip_register_shared_install_components)
+  set(_tip_components ${ARGN})
+  list(REMOVE_DUPLICATES _tip_components)
+  list(LENGTH _tip_components _tip_component_count)
+  if(_tip_component_count GREATER 1)
+    list(JOIN _tip_components "|" _tip_shared_components)
+    set_property(GLOBAL APPEND PROPERTY "_TIP_SHARED_INSTALL_COMPONENTS" "${_tip_shared_components}")
+  endif()
 endfunction()
 
 function(_tip_find_package_expression_without_required OUT_VAR DEPENDENCY_EXPRESSION)
@@ -567,89 +690,138 @@ function(_tip_find_package_expression_package_name OUT_VAR DEPENDENCY_EXPRESSION
 endfunction()
 
 # ~~~
-# Register one target for deferred package finalization.
-#
-# This legacy implementation entry point validates and stores target metadata for
-# target_install_package(). It is not public API.
-#
-# Internal signature:
-#   target_prepare_package(TARGET_NAME
-#     NAMESPACE <namespace>
-#     ALIAS_NAME <alias_name>
-#     VERSION <version>
-#     COMPATIBILITY <compatibility>
-#     ARCH_INDEPENDENT
-#     EXPORT_NAME <export_name>
-#     CONFIG_TEMPLATE <template_path>
-#     INCLUDE_DESTINATION <include_dest>
-#     MODULE_DESTINATION <module_dest>
-#     SOURCE_DESTINATION <source_dest>
-#     CMAKE_CONFIG_DESTINATION <config_dest>
-#     COMPONENT <component>
-#     DEBUG_POSTFIX <postfix>
-#     ADDITIONAL_FILES <files...>
-#     ADDITIONAL_FILES_DESTINATION <dest>
-#     ADDITIONAL_TARGETS <targets...>
-#     PUBLIC_DEPENDENCIES <deps...>
-#     INCLUDE_ON_FIND_PACKAGE <files...>
-#     COMPONENT_DEPENDENCIES <component> <deps...> [<component> <deps...>]...
-#     CPS
-#     CPS_PACKAGE_NAME <package_name>
-#     CPS_PROJECT <project_name>
-#     CPS_NO_PROJECT_METADATA
-#     CPS_APPENDIX <appendix_name>
-#     CPS_DESTINATION <destination>
-#     CPS_LOWER_CASE_FILE
-#     CPS_VERSION <version>
-#     CPS_COMPAT_VERSION <version>
-#     CPS_VERSION_SCHEMA <schema>
-#     CPS_DEFAULT_TARGETS <targets...>
-#     CPS_DEFAULT_CONFIGURATIONS <configs...>
-#     CPS_LICENSE <license>
-#     CPS_DEFAULT_LICENSE <license>
-#     CPS_DESCRIPTION <description>
-#     CPS_HOMEPAGE_URL <url>
-#     CPS_PERMISSIONS <permissions...>
-#     CPS_CONFIGURATIONS <configs...>
-#     CPS_CXX_MODULES_DIRECTORY <directory>
-#     CPS_COMPONENT <component>
-#     CPS_EXCLUDE_FROM_ALL
-#     SBOM
-#     SBOM_NAME <sbom_name>
-#     SBOM_PROJECT <project_name>
-#     SBOM_NO_PROJECT_METADATA
-#     SBOM_DESTINATION <destination>
-#     SBOM_VERSION <version>
-#     SBOM_LICENSE <license>
-#     SBOM_DESCRIPTION <description>
-#     SBOM_HOMEPAGE_URL <url>
-#     SBOM_PACKAGE_URL <url>
-#     SBOM_FORMAT <format>)
-#
-# SBOM requires CMAKE_EXPERIMENTAL_GENERATE_SBOM.
-#
-# See target_install_package() for parameter descriptions.
-# CONFIG_TEMPLATE resolution source of truth:
-# docs/template_resolution.md#source-of-truth
+# Set OUT_VAR to the if() condition a generated config tests before loading DEPENDENCY_EXPRESSION: true unless the
+# package is already found in the consumer's scope at a version the expression accepts. Without a version, any found
+# package is accepted; with one, only a found version VERSION_EQUAL to it. Which other versions the dependency
+# accepts is decided by its own version file (SameMinorVersion rejects 1.5 for 1.2, for example), so anything else is
+# left to find_dependency(). OUT_VAR is empty when a found package cannot be checked against the expression (version
+# ranges, COMPONENTS), so the dependency is always loaded.
 # ~~~
-function(target_prepare_package TARGET_NAME)
-  # Check for deprecated parameters BEFORE parsing
-  if("RUNTIME_COMPONENT" IN_LIST ARGN OR "DEVELOPMENT_COMPONENT" IN_LIST ARGN)
-    message(FATAL_ERROR "RUNTIME_COMPONENT and DEVELOPMENT_COMPONENT parameters are deprecated. "
-                        "Use COMPONENT instead to name runtime files. Development files are installed in the shared Development component.")
+function(_tip_find_dependency_guard OUT_VAR DEPENDENCY_EXPRESSION)
+  separate_arguments(_tip_dependency_args UNIX_COMMAND "${DEPENDENCY_EXPRESSION}")
+  list(GET _tip_dependency_args 0 _tip_dependency_package_name)
+  set(_tip_dependency_version "")
+  list(LENGTH _tip_dependency_args _tip_dependency_arg_count)
+  if(_tip_dependency_arg_count GREATER 1)
+    list(GET _tip_dependency_args 1 _tip_dependency_version)
+    if(NOT _tip_dependency_version MATCHES "^[0-9]")
+      set(_tip_dependency_version "")
+    endif()
   endif()
 
-  # Parse function arguments
-  set(options
+  foreach(_tip_dependency_arg IN LISTS _tip_dependency_args)
+    string(TOUPPER "${_tip_dependency_arg}" _tip_dependency_arg_upper)
+    if(_tip_dependency_arg_upper MATCHES "^(OPTIONAL_)?COMPONENTS$" OR _tip_dependency_version MATCHES "\\.\\.\\.")
+      set(${OUT_VAR}
+          ""
+          PARENT_SCOPE)
+      return()
+    endif()
+  endforeach()
+
+  set(_tip_guard "NOT ${_tip_dependency_package_name}_FOUND")
+  if(_tip_dependency_version)
+    string(APPEND _tip_guard " OR NOT \"\${${_tip_dependency_package_name}_VERSION}\" VERSION_EQUAL \"${_tip_dependency_version}\"")
+  endif()
+  set(${OUT_VAR}
+      "${_tip_guard}"
+      PARENT_SCOPE)
+endfunction()
+
+# ~~~
+# Set OUT_VAR to the generated config lines, indented by INDENT, that preset <Package>_DIR for DEPENDENCY_EXPRESSION
+# before it is loaded, for BAKE_DEPENDENCY_HINTS. The directory is the one the producer found the package config in,
+# written relative to the installed config at CONFIG_DESTINATION so it follows the install prefix when it is moved.
+# OUT_VAR is empty when the package was not found through a config or the config lies outside CMAKE_INSTALL_PREFIX.
+# An absolute CONFIG_DESTINATION is a build-tree config, which never moves, so the directory is baked as it is. A
+# preset the consumer already made wins, and find_package() ignores a <Package>_DIR without a config in it, so the
+# usual search stays the fallback.
+# ~~~
+function(_tip_dependency_dir_hint OUT_VAR DEPENDENCY_EXPRESSION CONFIG_DESTINATION INDENT)
+  set(${OUT_VAR}
+      ""
+      PARENT_SCOPE)
+  _tip_find_package_expression_package_name(_tip_dependency_package_name "${DEPENDENCY_EXPRESSION}")
+  # finalize_package() runs deferred in the top-level directory, so a package found in a subdirectory is only visible
+  # through the cache entry find_package() writes.
+  set(_tip_dependency_dir "${${_tip_dependency_package_name}_DIR}")
+  if(NOT _tip_dependency_dir)
+    set(_tip_dependency_dir "$CACHE{${_tip_dependency_package_name}_DIR}")
+  endif()
+  if(NOT _tip_dependency_dir)
+    return()
+  endif()
+
+  get_filename_component(_tip_dependency_dir "${_tip_dependency_dir}" ABSOLUTE)
+  if(IS_ABSOLUTE "${CONFIG_DESTINATION}")
+    set(${OUT_VAR}
+        "${INDENT}if(NOT ${_tip_dependency_package_name}_DIR)\n${INDENT}  set(${_tip_dependency_package_name}_DIR \"${_tip_dependency_dir}\")\n${INDENT}endif()\n"
+        PARENT_SCOPE)
+    return()
+  endif()
+  get_filename_component(_tip_install_prefix "${CMAKE_INSTALL_PREFIX}" ABSOLUTE)
+  cmake_path(IS_PREFIX _tip_install_prefix "${_tip_dependency_dir}" NORMALIZE _tip_dependency_in_prefix)
+  if(NOT _tip_dependency_in_prefix)
+    return()
+  endif()
+
+  file(RELATIVE_PATH _tip_dependency_dir "${_tip_install_prefix}" "${_tip_dependency_dir}")
+  file(RELATIVE_PATH _tip_dependency_dir "/${CONFIG_DESTINATION}" "/${_tip_dependency_dir}")
+  set(${OUT_VAR}
+      "${INDENT}if(NOT ${_tip_dependency_package_name}_DIR)\n${INDENT}  get_filename_component(${_tip_dependency_package_name}_DIR \"\${CMAKE_CURRENT_LIST_DIR}/${_tip_dependency_dir}\" ABSOLUTE)\n${INDENT}endif()\n"
+      PARENT_SCOPE)
+endfunction()
+
+# ~~~
+# Set OUT_VAR to CODE, a block of generated config lines indented by INDENT, wrapped in a TIP_PROFILE_FIND_PACKAGE
+# span named SPAN_NAME and attributed to the package EXPORT_NAME. SPAN_KEY makes the span's begin variable unique within
+# the config. The helpers are defined by
+# the generic config template of the first package loaded with profiling on, so configs from custom templates are only
+# profiled after such a package.
+# ~~~
+function(_tip_find_package_profile_wrap OUT_VAR EXPORT_NAME INDENT SPAN_KEY SPAN_NAME CODE)
+  string(MAKE_C_IDENTIFIER "${SPAN_KEY}" _tip_span_key)
+  set(_tip_span_var "_tip_find_package_profile_${EXPORT_NAME}_${_tip_span_key}")
+  string(REPLACE "\"" "\\\"" _tip_span_name "${SPAN_NAME}")
+  string(
+    CONCAT
+    _tip_wrapped
+    "${INDENT}if(TIP_PROFILE_FIND_PACKAGE AND COMMAND _tip_find_package_profile_begin)\n"
+    "${INDENT}  _tip_find_package_profile_begin(${_tip_span_var})\n"
+    "${INDENT}endif()\n"
+    "${CODE}"
+    "${INDENT}if(TIP_PROFILE_FIND_PACKAGE AND COMMAND _tip_find_package_profile_end)\n"
+    "${INDENT}  _tip_find_package_profile_end(${_tip_span_var} ${EXPORT_NAME} \"${_tip_span_name}\")\n"
+    "${INDENT}endif()\n")
+  set(${OUT_VAR}
+      "${_tip_wrapped}"
+      PARENT_SCOPE)
+endfunction()
+
+# ~~~
+# Define the keyword lists accepted by target_prepare_package() in the calling scope:
+# _tip_package_options, _tip_package_one_value_args and _tip_package_multi_value_args.
+# The _tip_package_target_* lists name the subset that target_install_packages() accepts per target.
+# ~~~
+macro(_tip_package_argument_keywords)
+  set(_tip_package_options
       DISABLE_RPATH
       ARCH_INDEPENDENT
+      FLATTEN_CONFIG
+      SHARD_BY_COMPONENT
+      FLATTEN_DEPENDENCIES
+      BAKE_DEPENDENCY_HINTS
+      BUILD_TREE_EXPORT
+      HEADER_COST_REPORT
+      INSTALL_MANIFEST
       CPS
+      CPS_PRIMARY
       CPS_NO_PROJECT_METADATA
       CPS_LOWER_CASE_FILE
       CPS_EXCLUDE_FROM_ALL
       SBOM
       SBOM_NO_PROJECT_METADATA)
-  set(oneValueArgs
+  set(_tip_package_one_value_args
       NAMESPACE
       ALIAS_NAME
       VERSION
@@ -686,7 +858,7 @@ function(target_prepare_package TARGET_NAME)
       SBOM_HOMEPAGE_URL
       SBOM_PACKAGE_URL
       SBOM_FORMAT)
-  set(multiValueArgs
+  set(_tip_package_multi_value_args
       ADDITIONAL_FILES
       ADDITIONAL_FILES_COMPONENTS
       ADDITIONAL_TARGETS
@@ -698,14 +870,179 @@ function(target_prepare_package TARGET_NAME)
       CPS_DEFAULT_CONFIGURATIONS
       CPS_PERMISSIONS
       CPS_CONFIGURATIONS)
-  cmake_parse_arguments(ARG "${options}" "${oneValueArgs}" "${multiValueArgs}" ${ARGN})
+  set(_tip_package_target_options DISABLE_RPATH)
+  set(_tip_package_target_one_value_args ALIAS_NAME COMPONENT LAYOUT ADDITIONAL_FILES_DESTINATION)
+  set(_tip_package_target_multi_value_args ADDITIONAL_FILES ADDITIONAL_FILES_COMPONENTS ADDITIONAL_TARGETS)
+endmacro()
+
+# ~~~
+# Register one target for deferred package finalization.
+#
+# This legacy implementation entry point validates and stores target metadata for
+# target_install_package(). It is not public API.
+#
+# Internal signature:
+#   target_prepare_package(TARGET_NAME
+#     NAMESPACE <namespace>
+#     ALIAS_NAME <alias_name>
+#     VERSION <version>
+#     COMPATIBILITY <compatibility>
+#     ARCH_INDEPENDENT
+#     FLATTEN_CONFIG
+#     SHARD_BY_COMPONENT
+#     FLATTEN_DEPENDENCIES
+#     BAKE_DEPENDENCY_HINTS
+#     BUILD_TREE_EXPORT
+#     HEADER_COST_REPORT
+#     INSTALL_MANIFEST
+#     EXPORT_NAME <export_name>
+#     CONFIG_TEMPLATE <template_path>
+#     INCLUDE_DESTINATION <include_dest>
+#     MODULE_DESTINATION <module_dest>
+#     SOURCE_DESTINATION <source_dest>
+#     CMAKE_CONFIG_DESTINATION <config_dest>
+#     COMPONENT <component>
+#     DEBUG_POSTFIX <postfix>
+#     ADDITIONAL_FILES <files...>
+#     ADDITIONAL_FILES_DESTINATION <dest>
+#     ADDITIONAL_TARGETS <targets...>
+#     PUBLIC_DEPENDENCIES <deps...>
+#     INCLUDE_ON_FIND_PACKAGE <files...>
+#     COMPONENT_DEPENDENCIES <component> <deps...> [<component> <deps...>]...
+#     CPS
+#     CPS_PRIMARY
+#     CPS_PACKAGE_NAME <package_name>
+#     CPS_PROJECT <project_name>
+#     CPS_NO_PROJECT_METADATA
+#     CPS_APPENDIX <appendix_name>
+#     CPS_DESTINATION <destination>
+#     CPS_LOWER_CASE_FILE
+#     CPS_VERSION <version>
+#     CPS_COMPAT_VERSION <version>
+#     CPS_VERSION_SCHEMA <schema>
+#     CPS_DEFAULT_TARGETS <targets...>
+#     CPS_DEFAULT_CONFIGURATIONS <configs...>
+#     CPS_LICENSE <license>
+#     CPS_DEFAULT_LICENSE <license>
+#     CPS_DESCRIPTION <description>
+#     CPS_HOMEPAGE_URL <url>
+#     CPS_PERMISSIONS <permissions...>
+#     CPS_CONFIGURATIONS <configs...>
+#     CPS_CXX_MODULES_DIRECTORY <directory>
+#     CPS_COMPONENT <component>
+#     CPS_EXCLUDE_FROM_ALL
+#     SBOM
+#     SBOM_NAME <sbom_name>
+#     SBOM_PROJECT <project_name>
+#     SBOM_NO_PROJECT_METADATA
+#     SBOM_DESTINATION <destination>
+#     SBOM_VERSION <version>
+#     SBOM_LICENSE <license>
+#     SBOM_DESCRIPTION <description>
+#     SBOM_HOMEPAGE_URL <url>
+#     SBOM_PACKAGE_URL <url>
+#     SBOM_FORMAT <format>)
+#
+# SBOM requires CMAKE_EXPERIMENTAL_GENERATE_SBOM.
+#
+# See target_install_package() for parameter descriptions.
+# CONFIG_TEMPLATE resolution source of truth:
+# docs/template_resolution.md#source-of-truth
+# ~~~
+function(target_prepare_package TARGET_NAME)
+  # Check for deprecated parameters BEFORE parsing
+  if("RUNTIME_COMPONENT" IN_LIST ARGN OR "DEVELOPMENT_COMPONENT" IN_LIST ARGN)
+    message(FATAL_ERROR "RUNTIME_COMPONENT and DEVELOPMENT_COMPONENT parameters are deprecated. "
+                        "Use COMPONENT instead to name runtime files. Development files are installed in the shared Development component.")
+  endif()
+
+  # Parse function arguments
+  _tip_package_argument_keywords()
+  cmake_parse_arguments(ARG "${_tip_package_options}" "${_tip_package_one_value_args}" "${_tip_package_multi_value_args}" ${ARGN})
   if(ARG_UNPARSED_ARGUMENTS)
     project_log(FATAL_ERROR "Unknown arguments for target_install_package('${TARGET_NAME}'): ${ARG_UNPARSED_ARGUMENTS}")
   endif()
 
-  # Store DISABLE_RPATH as a target property for later use
-  if(ARG_DISABLE_RPATH)
-    set_target_properties(${TARGET_NAME} PROPERTIES TARGET_INSTALL_PACKAGE_DISABLE_RPATH TRUE)
+  # EXPORT_NAME defaults to target name
+  if(NOT ARG_EXPORT_NAME)
+    set(ARG_EXPORT_NAME "${TARGET_NAME}")
+    project_log(DEBUG "  Export name not provided, using target name: ${ARG_EXPORT_NAME}")
+  endif()
+
+  _tip_prepare_package_targets("${TARGET_NAME}" FALSE)
+endfunction(target_prepare_package)
+
+# ~~~
+# Decide whether a registration should be skipped because its targets will never be installed. Sets OUT_VAR to the
+# reason, or to an empty string when the targets must be registered.
+#
+# A registration is skipped when:
+#   - TIP_SKIP_INSTALL is true. It is an ordinary variable, so setting it before add_subdirectory() or
+#     FetchContent_MakeAvailable() covers that whole subtree; a cache entry covers the whole project.
+#   - CMAKE_SKIP_INSTALL_RULES is true, so CMake generates no install rules anyway.
+#   - TIP_SKIP_EXCLUDED_FROM_ALL is true and every target is EXCLUDE_FROM_ALL, either through its own property or
+#     because its directory or a parent directory was added with add_subdirectory(... EXCLUDE_FROM_ALL).
+# ~~~
+function(_tip_resolve_install_skip OUT_VAR TARGET_NAMES)
+  set(_tip_skip_reason "")
+  if(TIP_SKIP_INSTALL)
+    set(_tip_skip_reason "TIP_SKIP_INSTALL is set")
+  elseif(CMAKE_SKIP_INSTALL_RULES)
+    set(_tip_skip_reason "CMAKE_SKIP_INSTALL_RULES is set")
+  elseif(TIP_SKIP_EXCLUDED_FROM_ALL)
+    set(_tip_skip_reason "TIP_SKIP_EXCLUDED_FROM_ALL is set and every target is EXCLUDE_FROM_ALL")
+    foreach(_tip_target_name IN LISTS TARGET_NAMES)
+      if(NOT TARGET ${_tip_target_name})
+        set(_tip_skip_reason "")
+        break()
+      endif()
+      get_target_property(_tip_target_excluded ${_tip_target_name} EXCLUDE_FROM_ALL)
+      if(_tip_target_excluded STREQUAL "_tip_target_excluded-NOTFOUND")
+        # Only the directory passed to add_subdirectory(EXCLUDE_FROM_ALL) carries the property; walk up to it.
+        get_target_property(_tip_directory ${_tip_target_name} SOURCE_DIR)
+        set(_tip_target_excluded FALSE)
+        while(_tip_directory)
+          get_property(_tip_directory_excluded DIRECTORY "${_tip_directory}" PROPERTY EXCLUDE_FROM_ALL)
+          if(_tip_directory_excluded)
+            set(_tip_target_excluded TRUE)
+            break()
+          endif()
+          get_property(_tip_directory DIRECTORY "${_tip_directory}" PROPERTY PARENT_DIRECTORY)
+        endwhile()
+      endif()
+      if(NOT _tip_target_excluded)
+        set(_tip_skip_reason "")
+        break()
+      endif()
+    endforeach()
+  endif()
+  set(${OUT_VAR}
+      "${_tip_skip_reason}"
+      PARENT_SCOPE)
+endfunction()
+
+# ~~~
+# Register TARGET_NAMES in export ARG_EXPORT_NAME.
+#
+# Reads the ARG_* variables and keyword lists parsed by the calling entry point. Export-level options are resolved,
+# validated and merged into the export record once; only the per-target keywords (_tip_package_target_*) are
+# evaluated for every target. With WITH_OVERRIDES, a target's values come from _tip_override_<target>_<keyword> when
+# defined, otherwise from the shared ARG_<keyword>; without it, ARG_* is used as parsed.
+# ~~~
+function(_tip_prepare_package_targets TARGET_NAMES WITH_OVERRIDES)
+  string(REPLACE ";" "', '" _tip_targets_label "${TARGET_NAMES}")
+  _tip_resolve_install_skip(_tip_skip_reason "${TARGET_NAMES}")
+  if(_tip_skip_reason)
+    set_property(GLOBAL PROPERTY "_CMAKE_PACKAGE_EXPORT_${ARG_EXPORT_NAME}_SKIPPED" TRUE)
+    project_log(VERBOSE "Skipping installation of '${_tip_targets_label}' in export '${ARG_EXPORT_NAME}': ${_tip_skip_reason}")
+    return()
+  endif()
+  if(TIP_PROFILE)
+    if(WITH_OVERRIDES)
+      _tip_profile_begin("target_install_packages(${ARG_EXPORT_NAME})" export "${ARG_EXPORT_NAME}" targets "${TARGET_NAMES}")
+    else()
+      _tip_profile_begin("target_prepare_package(${TARGET_NAMES})" export "${ARG_EXPORT_NAME}" target "${TARGET_NAMES}")
+    endif()
   endif()
 
   # Handle backward compatibility: PUBLIC_CMAKE_FILES -> INCLUDE_ON_FIND_PACKAGE
@@ -717,35 +1054,12 @@ function(target_prepare_package TARGET_NAME)
     project_log(DEBUG "  Using deprecated PUBLIC_CMAKE_FILES parameter. Consider migrating to INCLUDE_ON_FIND_PACKAGE.")
   endif()
 
-  # Check if target exists
-  if(NOT TARGET ${TARGET_NAME})
-    project_log(FATAL_ERROR "Target '${TARGET_NAME}' does not exist.")
-  endif()
-
-  # Validate additional targets
-  if(ARG_ADDITIONAL_TARGETS)
-    foreach(ADD_TARGET ${ARG_ADDITIONAL_TARGETS})
-      if(NOT TARGET ${ADD_TARGET})
-        project_log(FATAL_ERROR "Additional target '${ADD_TARGET}' does not exist.")
-      endif()
-    endforeach()
-    project_log(DEBUG "  Including additional targets in export: ${ARG_ADDITIONAL_TARGETS}")
-  endif()
-
-  project_log(DEBUG "Preparing installation for '${TARGET_NAME}'...")
-
-  # Resolve install layout for this target Priority: per-target LAYOUT > global TIP_INSTALL_LAYOUT (cache) > Filesystem Hierarchy Standard (FHS, system package conventions)
-  set(_tip_layout "")
-  if(ARG_LAYOUT)
-    set(_tip_layout "${ARG_LAYOUT}")
-  elseif(DEFINED TIP_INSTALL_LAYOUT)
-    set(_tip_layout "${TIP_INSTALL_LAYOUT}")
-  else()
-    set(_tip_layout "fhs")
-  endif()
-  string(TOLOWER "${_tip_layout}" _tip_layout)
-  set_target_properties(${TARGET_NAME} PROPERTIES TARGET_INSTALL_PACKAGE_LAYOUT "${_tip_layout}")
-  project_log(DEBUG "  Install layout for '${TARGET_NAME}': ${_tip_layout}")
+  # Check if targets exist
+  foreach(_tip_target_name IN LISTS TARGET_NAMES)
+    if(NOT TARGET ${_tip_target_name})
+      project_log(FATAL_ERROR "Target '${_tip_target_name}' does not exist.")
+    endif()
+  endforeach()
 
   set(_tip_version_explicit FALSE)
   if(NOT "${ARG_VERSION}" STREQUAL "")
@@ -771,33 +1085,6 @@ function(target_prepare_package TARGET_NAME)
     endif()
   endif()
 
-  # EXPORT_NAME defaults to target name
-  if(NOT ARG_EXPORT_NAME)
-    set(ARG_EXPORT_NAME "${TARGET_NAME}")
-    project_log(DEBUG "  Export name not provided, using target name: ${ARG_EXPORT_NAME}")
-  endif()
-
-  set(_tip_alias_name_explicit FALSE)
-  if(NOT "${ARG_ALIAS_NAME}" STREQUAL "")
-    set(_tip_alias_name_explicit TRUE)
-  endif()
-  set(_tip_component_explicit FALSE)
-  if(NOT "${ARG_COMPONENT}" STREQUAL "")
-    set(_tip_component_explicit TRUE)
-  endif()
-
-  # ALIAS_NAME defaults to target name. If the target already has EXPORT_NAME, preserve that as the effective installed name.
-  if(NOT ARG_ALIAS_NAME)
-    get_target_property(_tip_existing_target_export_name ${TARGET_NAME} EXPORT_NAME)
-    if(_tip_existing_target_export_name AND NOT _tip_existing_target_export_name MATCHES "-NOTFOUND$")
-      set(ARG_ALIAS_NAME "${_tip_existing_target_export_name}")
-      project_log(DEBUG "  Alias name not provided, using existing EXPORT_NAME: ${ARG_ALIAS_NAME}")
-    else()
-      set(ARG_ALIAS_NAME "${TARGET_NAME}")
-      project_log(DEBUG "  Alias name not provided, using target name: ${ARG_ALIAS_NAME}")
-    endif()
-  endif()
-
   # NAMESPACE defaults to EXPORT_NAME::
   if(NOT ARG_NAMESPACE)
     set(ARG_NAMESPACE "${ARG_EXPORT_NAME}::")
@@ -821,14 +1108,6 @@ function(target_prepare_package TARGET_NAME)
     project_log(DEBUG "  Source destination not provided, using default: ${ARG_SOURCE_DESTINATION}")
   endif()
 
-  # BREAKING CHANGE: Validate against deprecated component names Users should use COMPONENT instead for cleaner naming
-  if(ARG_COMPONENT AND (ARG_COMPONENT STREQUAL "Runtime" OR ARG_COMPONENT STREQUAL "Development"))
-    message(
-      FATAL_ERROR
-        "COMPONENT name '${ARG_COMPONENT}' is deprecated. " "The purpose of COMPONENT is to create meaningful component groups that differ from the default 'Runtime'/'Development'. "
-        "Use COMPONENT with a descriptive name (e.g., 'Core', 'Graphics', 'Network') to separate components logically. " "If you want default behavior, simply omit the COMPONENT parameter entirely.")
-  endif()
-
   # Handle DEBUG_POSTFIX default value
   if(NOT ARG_DEBUG_POSTFIX)
     set(ARG_DEBUG_POSTFIX "d")
@@ -893,48 +1172,20 @@ function(target_prepare_package TARGET_NAME)
       set(_tip_cps_specific_requested TRUE)
     endif()
   endforeach()
-  if(ARG_CPS_NO_PROJECT_METADATA
+  if(ARG_CPS_PRIMARY
+     OR ARG_CPS_NO_PROJECT_METADATA
      OR ARG_CPS_LOWER_CASE_FILE
      OR ARG_CPS_EXCLUDE_FROM_ALL)
     set(_tip_cps_specific_requested TRUE)
   endif()
 
   if(_tip_cps_specific_requested AND NOT ARG_CPS)
-    project_log(FATAL_ERROR "CPS-specific options require the CPS flag for target '${TARGET_NAME}'.")
+    project_log(FATAL_ERROR "CPS-specific options require the CPS flag for target '${_tip_targets_label}'.")
   endif()
 
   if(ARG_CPS)
-    if(CMAKE_VERSION VERSION_LESS "4.3")
-      project_log(FATAL_ERROR "CPS package metadata requires CMake 4.3 or newer because it uses install(PACKAGE_INFO).")
-    endif()
-
-    if(NOT "${ARG_CPS_PROJECT}" STREQUAL "" AND ARG_CPS_NO_PROJECT_METADATA)
-      project_log(FATAL_ERROR "CPS_PROJECT and CPS_NO_PROJECT_METADATA cannot be used together.")
-    endif()
-
-    if(NOT "${ARG_CPS_APPENDIX}" STREQUAL "")
-      set(_tip_cps_appendix_forbidden "")
-      foreach(
-        _tip_cps_appendix_arg IN
-        ITEMS ARG_CPS_PROJECT
-              ARG_CPS_VERSION
-              ARG_CPS_COMPAT_VERSION
-              ARG_CPS_VERSION_SCHEMA
-              ARG_CPS_DEFAULT_TARGETS
-              ARG_CPS_DEFAULT_CONFIGURATIONS
-              ARG_CPS_LICENSE
-              ARG_CPS_DESCRIPTION
-              ARG_CPS_HOMEPAGE_URL)
-        if(DEFINED ${_tip_cps_appendix_arg} AND NOT "${${_tip_cps_appendix_arg}}" STREQUAL "")
-          string(REGEX REPLACE "^ARG_" "" _tip_cps_appendix_name "${_tip_cps_appendix_arg}")
-          list(APPEND _tip_cps_appendix_forbidden "${_tip_cps_appendix_name}")
-        endif()
-      endforeach()
-
-      if(_tip_cps_appendix_forbidden)
-        project_log(FATAL_ERROR "CPS_APPENDIX cannot be combined with: ${_tip_cps_appendix_forbidden}")
-      endif()
-    endif()
+    _tip_load_feature_module(tip_cps)
+    _tip_validate_cps_arguments()
   endif()
 
   set(_tip_sbom_specific_requested FALSE)
@@ -958,57 +1209,27 @@ function(target_prepare_package TARGET_NAME)
   endif()
 
   if(_tip_sbom_specific_requested AND NOT ARG_SBOM)
-    project_log(FATAL_ERROR "SBOM-specific options require the SBOM flag for target '${TARGET_NAME}'.")
+    project_log(FATAL_ERROR "SBOM-specific options require the SBOM flag for target '${_tip_targets_label}'.")
   endif()
 
   if(ARG_SBOM)
-    _tip_validate_sbom_activation("${ARG_EXPORT_NAME}")
-
-    if(NOT "${ARG_SBOM_PACKAGE_URL}" STREQUAL "" AND CMAKE_VERSION VERSION_LESS "4.4")
-      project_log(FATAL_ERROR "SBOM_PACKAGE_URL requires CMake 4.4 or newer because CMake 4.3 does not accept PACKAGE_URL in install(SBOM).")
-    endif()
-
-    set(_tip_effective_sbom_name "${ARG_SBOM_NAME}")
-    if("${_tip_effective_sbom_name}" STREQUAL "")
-      set(_tip_effective_sbom_name "${ARG_EXPORT_NAME}")
-    endif()
-
-    if(NOT "${ARG_SBOM_PROJECT}" STREQUAL "" AND ARG_SBOM_NO_PROJECT_METADATA)
-      project_log(FATAL_ERROR "SBOM_PROJECT and SBOM_NO_PROJECT_METADATA cannot be used together.")
-    endif()
-
-    set(_tip_sbom_metadata_project "")
-    if(NOT ARG_SBOM_NO_PROJECT_METADATA)
-      if(NOT "${ARG_SBOM_PROJECT}" STREQUAL "")
-        set(_tip_sbom_metadata_project "${ARG_SBOM_PROJECT}")
-        set(_tip_sbom_project_source_var "${ARG_SBOM_PROJECT}_SOURCE_DIR")
-        if(NOT DEFINED ${_tip_sbom_project_source_var})
-          project_log(FATAL_ERROR "SBOM_PROJECT '${ARG_SBOM_PROJECT}' is not visible from target '${TARGET_NAME}'.")
-        endif()
-      else()
-        if("${_tip_effective_sbom_name}" STREQUAL "${PROJECT_NAME}")
-          set(_tip_sbom_metadata_project "${PROJECT_NAME}")
-        endif()
-      endif()
-    endif()
-
-    if(ARG_SBOM_NO_PROJECT_METADATA)
-      set(_tip_sbom_metadata_mode "none")
-    elseif(NOT "${_tip_sbom_metadata_project}" STREQUAL "")
-      set(_tip_sbom_metadata_mode "project:${_tip_sbom_metadata_project}")
-    else()
-      set(_tip_sbom_metadata_mode "explicit")
-    endif()
+    _tip_load_feature_module(tip_sbom)
+    _tip_validate_sbom_arguments()
   endif()
 
-  # Store configuration in global properties for finalize_package
+  # Store configuration in the packed export registry for finalize_package
   set(EXPORT_PROPERTY_PREFIX "_CMAKE_PACKAGE_EXPORT_${ARG_EXPORT_NAME}")
 
   get_property(_tip_export_finalized GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_FINALIZED")
   if(_tip_export_finalized)
-    project_log(FATAL_ERROR "Export '${ARG_EXPORT_NAME}' has already been finalized. Target '${TARGET_NAME}' cannot be added after finalize_package().")
+    project_log(FATAL_ERROR "Export '${ARG_EXPORT_NAME}' has already been finalized. Target '${_tip_targets_label}' cannot be added after finalize_package().")
   endif()
 
+  # Decode the export and target records once; the fields are updated as variables and encoded again below.
+  get_property(_tip_export_record_fields GLOBAL PROPERTY _TIP_EXPORT_RECORD_FIELDS)
+  get_property(_tip_export_record GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_RECORD")
+  _tip_decode_record(_tip_export _tip_export_record_fields _tip_export_record)
+
   if(ARG_CONFIG_TEMPLATE)
     _tip_resolve_absolute_paths(ARG_CONFIG_TEMPLATE "${CMAKE_CURRENT_SOURCE_DIR}" "${ARG_CONFIG_TEMPLATE}")
     list(GET ARG_CONFIG_TEMPLATE 0 ARG_CONFIG_TEMPLATE)
@@ -1018,306 +1239,260 @@ function(target_prepare_package TARGET_NAME)
     _tip_resolve_absolute_paths(ARG_INCLUDE_ON_FIND_PACKAGE "${CMAKE_CURRENT_SOURCE_DIR}" ${ARG_INCLUDE_ON_FIND_PACKAGE})
   endif()
 
-  # Get existing targets for this export (if any)
-  get_property(EXISTING_TARGETS GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_TARGETS")
-  if(EXISTING_TARGETS)
-    list(APPEND EXISTING_TARGETS ${TARGET_NAME} ${ARG_ADDITIONAL_TARGETS})
-  else()
-    set(EXISTING_TARGETS ${TARGET_NAME} ${ARG_ADDITIONAL_TARGETS})
-  endif()
-  list(REMOVE_DUPLICATES EXISTING_TARGETS)
-
-  # Store per-target component configuration. COMPONENT names runtime files only; SDK files are always part of the shared Development component.
-  get_property(
-    _tip_existing_alias_name_set GLOBAL
-    PROPERTY "${EXPORT_PROPERTY_PREFIX}_TARGET_${TARGET_NAME}_ALIAS_NAME"
-    SET)
-  if(_tip_existing_alias_name_set)
-    get_property(_tip_existing_alias_name GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_TARGET_${TARGET_NAME}_ALIAS_NAME")
-    get_property(_tip_existing_alias_name_explicit GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_TARGET_${TARGET_NAME}_ALIAS_NAME_EXPLICIT")
-    if(_tip_alias_name_explicit)
-      if(_tip_existing_alias_name_explicit AND NOT "${_tip_existing_alias_name}" STREQUAL "${ARG_ALIAS_NAME}")
-        project_log(FATAL_ERROR "Conflicting ALIAS_NAME for target '${TARGET_NAME}' in export '${ARG_EXPORT_NAME}': '${_tip_existing_alias_name}' vs '${ARG_ALIAS_NAME}'")
-      endif()
-    elseif(NOT "${_tip_existing_alias_name}" STREQUAL "")
-      set(ARG_ALIAS_NAME "${_tip_existing_alias_name}")
-      if(_tip_existing_alias_name_explicit)
-        set(_tip_alias_name_explicit TRUE)
-      endif()
-    endif()
-  endif()
-
-  get_property(
-    _tip_existing_component_set GLOBAL
-    PROPERTY "${EXPORT_PROPERTY_PREFIX}_TARGET_${TARGET_NAME}_COMPONENT"
-    SET)
-  if(_tip_existing_component_set)
-    get_property(_tip_existing_component GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_TARGET_${TARGET_NAME}_COMPONENT")
-    get_property(_tip_existing_component_explicit GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_TARGET_${TARGET_NAME}_COMPONENT_EXPLICIT")
-    if(_tip_component_explicit)
-      if(_tip_existing_component_explicit AND NOT "${_tip_existing_component}" STREQUAL "${ARG_COMPONENT}")
-        project_log(FATAL_ERROR "Conflicting COMPONENT for target '${TARGET_NAME}' in export '${ARG_EXPORT_NAME}': '${_tip_existing_component}' vs '${ARG_COMPONENT}'")
-      endif()
-    elseif(NOT "${_tip_existing_component}" STREQUAL "")
-      set(ARG_COMPONENT "${_tip_existing_component}")
-      if(_tip_existing_component_explicit)
-        set(_tip_component_explicit TRUE)
-      endif()
-    endif()
-  endif()
-
-  if(ARG_COMPONENT)
-    set(RUNTIME_COMPONENT_NAME "${ARG_COMPONENT}")
-  else()
-    set(RUNTIME_COMPONENT_NAME "Runtime")
+  set(_tip_target_keywords "")
+  if(WITH_OVERRIDES)
+    set(_tip_target_keywords ${_tip_package_target_options} ${_tip_package_target_one_value_args} ${_tip_package_target_multi_value_args})
   endif()
-  set(DEVELOPMENT_COMPONENT_NAME "Development")
-
-  set_property(GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_TARGET_${TARGET_NAME}_RUNTIME_COMPONENT" "${RUNTIME_COMPONENT_NAME}")
-  set_property(GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_TARGET_${TARGET_NAME}_DEVELOPMENT_COMPONENT" "${DEVELOPMENT_COMPONENT_NAME}")
-  set_property(GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_TARGET_${TARGET_NAME}_COMPONENT" "${ARG_COMPONENT}")
-  set_property(GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_TARGET_${TARGET_NAME}_COMPONENT_EXPLICIT" "${_tip_component_explicit}")
-  set_property(GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_TARGET_${TARGET_NAME}_ALIAS_NAME" "${ARG_ALIAS_NAME}")
-  set_property(GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_TARGET_${TARGET_NAME}_ALIAS_NAME_EXPLICIT" "${_tip_alias_name_explicit}")
+  foreach(_tip_target_keyword IN LISTS _tip_target_keywords)
+    set(_tip_shared_${_tip_target_keyword} "${ARG_${_tip_target_keyword}}")
+  endforeach()
 
-  foreach(_tip_additional_target IN LISTS ARG_ADDITIONAL_TARGETS)
-    get_property(
-      _tip_additional_target_component_set GLOBAL
-      PROPERTY "${EXPORT_PROPERTY_PREFIX}_TARGET_${_tip_additional_target}_RUNTIME_COMPONENT"
-      SET)
-    if(NOT _tip_additional_target_component_set)
-      set_property(GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_TARGET_${_tip_additional_target}_RUNTIME_COMPONENT" "${RUNTIME_COMPONENT_NAME}")
-      set_property(GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_TARGET_${_tip_additional_target}_DEVELOPMENT_COMPONENT" "${DEVELOPMENT_COMPONENT_NAME}")
-      set_property(GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_TARGET_${_tip_additional_target}_COMPONENT" "${ARG_COMPONENT}")
-      set_property(GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_TARGET_${_tip_additional_target}_COMPONENT_EXPLICIT" FALSE)
-
-      get_target_property(_tip_additional_target_export_name ${_tip_additional_target} EXPORT_NAME)
-      if(_tip_additional_target_export_name AND NOT _tip_additional_target_export_name MATCHES "-NOTFOUND$")
-        set(_tip_additional_target_alias_name "${_tip_additional_target_export_name}")
+  # Targets without a record are new to this export; they are appended to <prefix>_TARGETS below.
+  set(_tip_new_export_targets "")
+  get_property(_tip_target_record_fields GLOBAL PROPERTY _TIP_TARGET_RECORD_FIELDS)
+  foreach(TARGET_NAME IN LISTS TARGET_NAMES)
+    foreach(_tip_target_keyword IN LISTS _tip_target_keywords)
+      if(DEFINED _tip_override_${TARGET_NAME}_${_tip_target_keyword})
+        set(ARG_${_tip_target_keyword} "${_tip_override_${TARGET_NAME}_${_tip_target_keyword}}")
       else()
-        set(_tip_additional_target_alias_name "${_tip_additional_target}")
+        set(ARG_${_tip_target_keyword} "${_tip_shared_${_tip_target_keyword}}")
       endif()
-      set_property(GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_TARGET_${_tip_additional_target}_ALIAS_NAME" "${_tip_additional_target_alias_name}")
-      set_property(GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_TARGET_${_tip_additional_target}_ALIAS_NAME_EXPLICIT" FALSE)
-      set_property(GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_TARGET_${_tip_additional_target}_DEVELOPMENT_COMPONENT_EXPLICIT" FALSE)
-    endif()
+    endforeach()
 
-    get_target_property(_tip_additional_target_layout ${_tip_additional_target} TARGET_INSTALL_PACKAGE_LAYOUT)
-    if(NOT _tip_additional_target_layout)
-      set_target_properties(${_tip_additional_target} PROPERTIES TARGET_INSTALL_PACKAGE_LAYOUT "${_tip_layout}")
+    # Store DISABLE_RPATH as a target property for later use
+    if(ARG_DISABLE_RPATH)
+      set_target_properties(${TARGET_NAME} PROPERTIES TARGET_INSTALL_PACKAGE_DISABLE_RPATH TRUE)
     endif()
-  endforeach()
-
-  # Store whether DEVELOPMENT_COMPONENT was explicitly specified (Always false now since we only use COMPONENT parameter)
-  set_property(GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_TARGET_${TARGET_NAME}_DEVELOPMENT_COMPONENT_EXPLICIT" FALSE)
-  project_log(DEBUG "  DEVELOPMENT_COMPONENT_EXPLICIT for '${TARGET_NAME}': FALSE")
 
-  # Store export-level configuration (shared settings)
-  set_property(GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_TARGETS" "${EXISTING_TARGETS}")
-  if(_tip_version_explicit)
-    set_property(GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_VERSION_EXPLICIT" TRUE)
-  endif()
-  _tip_store_export_property("${EXPORT_PROPERTY_PREFIX}" "${ARG_EXPORT_NAME}" "NAMESPACE" "${ARG_NAMESPACE}" "namespace")
-  _tip_store_export_property("${EXPORT_PROPERTY_PREFIX}" "${ARG_EXPORT_NAME}" "VERSION" "${ARG_VERSION}" "version")
-  _tip_store_export_property("${EXPORT_PROPERTY_PREFIX}" "${ARG_EXPORT_NAME}" "COMPATIBILITY" "${ARG_COMPATIBILITY}" "compatibility")
-  _tip_store_export_property("${EXPORT_PROPERTY_PREFIX}" "${ARG_EXPORT_NAME}" "ARCH_INDEPENDENT" "${ARG_ARCH_INDEPENDENT}" "architecture independence")
-  _tip_store_export_property("${EXPORT_PROPERTY_PREFIX}" "${ARG_EXPORT_NAME}" "CONFIG_TEMPLATE" "${ARG_CONFIG_TEMPLATE}" "config template")
-  _tip_store_export_property("${EXPORT_PROPERTY_PREFIX}" "${ARG_EXPORT_NAME}" "INCLUDE_DESTINATION" "${ARG_INCLUDE_DESTINATION}" "include destination")
-  _tip_store_export_property("${EXPORT_PROPERTY_PREFIX}" "${ARG_EXPORT_NAME}" "MODULE_DESTINATION" "${ARG_MODULE_DESTINATION}" "module destination")
-  _tip_store_export_property("${EXPORT_PROPERTY_PREFIX}" "${ARG_EXPORT_NAME}" "SOURCE_DESTINATION" "${ARG_SOURCE_DESTINATION}" "source destination")
-  _tip_store_export_property("${EXPORT_PROPERTY_PREFIX}" "${ARG_EXPORT_NAME}" "CMAKE_CONFIG_DESTINATION" "${ARG_CMAKE_CONFIG_DESTINATION}" "CMake config destination")
-  _tip_store_export_property("${EXPORT_PROPERTY_PREFIX}" "${ARG_EXPORT_NAME}" "DEBUG_POSTFIX" "${ARG_DEBUG_POSTFIX}" "debug postfix")
-
-  if(ARG_CPS)
-    set_property(GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_CPS" TRUE)
-    if(_tip_cps_version_explicit)
-      set_property(GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_CPS_VERSION_EXPLICIT" TRUE)
-    endif()
-
-    foreach(
-      _tip_cps_one_value IN
-      ITEMS CPS_PACKAGE_NAME
-            CPS_PROJECT
-            CPS_APPENDIX
-            CPS_DESTINATION
-            CPS_VERSION
-            CPS_COMPAT_VERSION
-            CPS_VERSION_SCHEMA
-            CPS_LICENSE
-            CPS_DEFAULT_LICENSE
-            CPS_DESCRIPTION
-            CPS_HOMEPAGE_URL
-            CPS_CXX_MODULES_DIRECTORY
-            CPS_COMPONENT)
-      set(_tip_cps_arg_var "ARG_${_tip_cps_one_value}")
-      if(DEFINED ${_tip_cps_arg_var} AND NOT "${${_tip_cps_arg_var}}" STREQUAL "")
-        string(REPLACE "_" " " _tip_cps_description "${_tip_cps_one_value}")
-        string(TOLOWER "${_tip_cps_description}" _tip_cps_description)
-        _tip_store_export_property("${EXPORT_PROPERTY_PREFIX}" "${ARG_EXPORT_NAME}" "${_tip_cps_one_value}" "${${_tip_cps_arg_var}}" "${_tip_cps_description}")
-      endif()
-    endforeach()
+    # Validate additional targets
+    if(ARG_ADDITIONAL_TARGETS)
+      foreach(ADD_TARGET ${ARG_ADDITIONAL_TARGETS})
+        if(NOT TARGET ${ADD_TARGET})
+          project_log(FATAL_ERROR "Additional target '${ADD_TARGET}' does not exist.")
+        endif()
+      endforeach()
+      project_log(DEBUG "  Including additional targets in export: ${ARG_ADDITIONAL_TARGETS}")
+    endif()
 
-    foreach(_tip_cps_multi_value IN ITEMS CPS_DEFAULT_TARGETS CPS_DEFAULT_CONFIGURATIONS CPS_PERMISSIONS CPS_CONFIGURATIONS)
-      set(_tip_cps_arg_var "ARG_${_tip_cps_multi_value}")
-      if(DEFINED ${_tip_cps_arg_var} AND NOT "${${_tip_cps_arg_var}}" STREQUAL "")
-        _tip_append_export_property_unique("${EXPORT_PROPERTY_PREFIX}" "${_tip_cps_multi_value}" ${${_tip_cps_arg_var}})
-      endif()
-    endforeach()
+    project_log(DEBUG "Preparing installation for '${TARGET_NAME}'...")
 
-    if(ARG_CPS_NO_PROJECT_METADATA)
-      set_property(GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_CPS_NO_PROJECT_METADATA" TRUE)
+    # Resolve install layout for this target Priority: per-target LAYOUT > global TIP_INSTALL_LAYOUT (cache) > Filesystem Hierarchy Standard (FHS, system package conventions)
+    set(_tip_layout "")
+    if(ARG_LAYOUT)
+      set(_tip_layout "${ARG_LAYOUT}")
+    elseif(DEFINED TIP_INSTALL_LAYOUT)
+      set(_tip_layout "${TIP_INSTALL_LAYOUT}")
+    else()
+      set(_tip_layout "fhs")
     endif()
-    if(ARG_CPS_LOWER_CASE_FILE)
-      set_property(GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_CPS_LOWER_CASE_FILE" TRUE)
+    string(TOLOWER "${_tip_layout}" _tip_layout)
+    set_target_properties(${TARGET_NAME} PROPERTIES TARGET_INSTALL_PACKAGE_LAYOUT "${_tip_layout}")
+    project_log(DEBUG "  Install layout for '${TARGET_NAME}': ${_tip_layout}")
+
+    set(_tip_alias_name_explicit FALSE)
+    if(NOT "${ARG_ALIAS_NAME}" STREQUAL "")
+      set(_tip_alias_name_explicit TRUE)
     endif()
-    if(ARG_CPS_EXCLUDE_FROM_ALL)
-      set_property(GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_CPS_EXCLUDE_FROM_ALL" TRUE)
+    set(_tip_component_explicit FALSE)
+    if(NOT "${ARG_COMPONENT}" STREQUAL "")
+      set(_tip_component_explicit TRUE)
     endif()
-  endif()
 
-  if(ARG_SBOM)
-    set_property(GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_SBOM" TRUE)
-    _tip_store_export_property("${EXPORT_PROPERTY_PREFIX}" "${ARG_EXPORT_NAME}" "SBOM_METADATA_MODE" "${_tip_sbom_metadata_mode}" "SBOM metadata inheritance mode")
-    _tip_store_export_property("${EXPORT_PROPERTY_PREFIX}" "${ARG_EXPORT_NAME}" "SBOM_EXPERIMENTAL_VALUE" "${CMAKE_EXPERIMENTAL_GENERATE_SBOM}" "SBOM experimental activation value")
-    if(_tip_sbom_version_explicit)
-      set_property(GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_SBOM_VERSION_EXPLICIT" TRUE)
-    endif()
-
-    foreach(
-      _tip_sbom_one_value IN
-      ITEMS SBOM_NAME
-            SBOM_PROJECT
-            SBOM_DESTINATION
-            SBOM_VERSION
-            SBOM_LICENSE
-            SBOM_DESCRIPTION
-            SBOM_HOMEPAGE_URL
-            SBOM_PACKAGE_URL
-            SBOM_FORMAT)
-      set(_tip_sbom_arg_var "ARG_${_tip_sbom_one_value}")
-      if(DEFINED ${_tip_sbom_arg_var} AND NOT "${${_tip_sbom_arg_var}}" STREQUAL "")
-        string(REPLACE "_" " " _tip_sbom_description "${_tip_sbom_one_value}")
-        string(TOLOWER "${_tip_sbom_description}" _tip_sbom_description)
-        _tip_store_export_property("${EXPORT_PROPERTY_PREFIX}" "${ARG_EXPORT_NAME}" "${_tip_sbom_one_value}" "${${_tip_sbom_arg_var}}" "${_tip_sbom_description}")
+    # ALIAS_NAME defaults to target name. If the target already has EXPORT_NAME, preserve that as the effective installed name.
+    if(NOT ARG_ALIAS_NAME)
+      get_target_property(_tip_existing_target_export_name ${TARGET_NAME} EXPORT_NAME)
+      if(_tip_existing_target_export_name AND NOT _tip_existing_target_export_name MATCHES "-NOTFOUND$")
+        set(ARG_ALIAS_NAME "${_tip_existing_target_export_name}")
+        project_log(DEBUG "  Alias name not provided, using existing EXPORT_NAME: ${ARG_ALIAS_NAME}")
+      else()
+        set(ARG_ALIAS_NAME "${TARGET_NAME}")
+        project_log(DEBUG "  Alias name not provided, using target name: ${ARG_ALIAS_NAME}")
       endif()
-    endforeach()
+    endif()
 
-    if(ARG_SBOM_NO_PROJECT_METADATA)
-      set_property(GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_SBOM_NO_PROJECT_METADATA" TRUE)
+    # BREAKING CHANGE: Validate against deprecated component names Users should use COMPONENT instead for cleaner naming
+    if(ARG_COMPONENT AND (ARG_COMPONENT STREQUAL "Runtime" OR ARG_COMPONENT STREQUAL "Development"))
+      message(
+        FATAL_ERROR
+          "COMPONENT name '${ARG_COMPONENT}' is deprecated. " "The purpose of COMPONENT is to create meaningful component groups that differ from the default 'Runtime'/'Development'. "
+          "Use COMPONENT with a descriptive name (e.g., 'Core', 'Graphics', 'Network') to separate components logically. " "If you want default behavior, simply omit the COMPONENT parameter entirely.")
     endif()
 
-    if(NOT "${_tip_sbom_metadata_project}" STREQUAL "")
-      set_property(GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_SBOM_INHERITED_PROJECT_METADATA" TRUE)
+    get_property(
+      _tip_target_record_set GLOBAL
+      PROPERTY "${EXPORT_PROPERTY_PREFIX}_TARGET_${TARGET_NAME}_RECORD"
+      SET)
+    get_property(_tip_target_record GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_TARGET_${TARGET_NAME}_RECORD")
+    _tip_decode_record(_tip_target _tip_target_record_fields _tip_target_record)
 
-      set(_tip_sbom_project_version_var "${_tip_sbom_metadata_project}_VERSION")
-      if(NOT _tip_sbom_version_explicit
-         AND NOT _tip_version_explicit
-         AND DEFINED ${_tip_sbom_project_version_var}
-         AND NOT "${${_tip_sbom_project_version_var}}" STREQUAL "")
-        _tip_store_export_property("${EXPORT_PROPERTY_PREFIX}" "${ARG_EXPORT_NAME}" "SBOM_INHERITED_VERSION" "${${_tip_sbom_project_version_var}}" "SBOM inherited project version")
-      endif()
+    if(NOT _tip_target_record_set)
+      list(APPEND _tip_new_export_targets "${TARGET_NAME}")
+    endif()
 
-      set(_tip_sbom_project_license_var "${_tip_sbom_metadata_project}_SPDX_LICENSE")
-      if("${ARG_SBOM_LICENSE}" STREQUAL ""
-         AND DEFINED ${_tip_sbom_project_license_var}
-         AND NOT "${${_tip_sbom_project_license_var}}" STREQUAL "")
-        _tip_store_export_property("${EXPORT_PROPERTY_PREFIX}" "${ARG_EXPORT_NAME}" "SBOM_INHERITED_LICENSE" "${${_tip_sbom_project_license_var}}" "SBOM inherited project license")
+    # Store per-target component configuration. COMPONENT names runtime files only; SDK files are always part of the shared Development component.
+    if(_tip_target_record_set)
+      set(_tip_existing_alias_name "${_tip_target_ALIAS_NAME}")
+      set(_tip_existing_alias_name_explicit "${_tip_target_ALIAS_NAME_EXPLICIT}")
+      if(_tip_alias_name_explicit)
+        if(_tip_existing_alias_name_explicit AND NOT "${_tip_existing_alias_name}" STREQUAL "${ARG_ALIAS_NAME}")
+          project_log(FATAL_ERROR "Conflicting ALIAS_NAME for target '${TARGET_NAME}' in export '${ARG_EXPORT_NAME}': '${_tip_existing_alias_name}' vs '${ARG_ALIAS_NAME}'")
+        endif()
+      elseif(NOT "${_tip_existing_alias_name}" STREQUAL "")
+        set(ARG_ALIAS_NAME "${_tip_existing_alias_name}")
+        if(_tip_existing_alias_name_explicit)
+          set(_tip_alias_name_explicit TRUE)
+        endif()
       endif()
 
-      set(_tip_sbom_project_description_var "${_tip_sbom_metadata_project}_DESCRIPTION")
-      if("${ARG_SBOM_DESCRIPTION}" STREQUAL ""
-         AND DEFINED ${_tip_sbom_project_description_var}
-         AND NOT "${${_tip_sbom_project_description_var}}" STREQUAL "")
-        _tip_store_export_property("${EXPORT_PROPERTY_PREFIX}" "${ARG_EXPORT_NAME}" "SBOM_INHERITED_DESCRIPTION" "${${_tip_sbom_project_description_var}}" "SBOM inherited project description")
+      set(_tip_existing_component "${_tip_target_COMPONENT}")
+      set(_tip_existing_component_explicit "${_tip_target_COMPONENT_EXPLICIT}")
+      if(_tip_component_explicit)
+        if(_tip_existing_component_explicit AND NOT "${_tip_existing_component}" STREQUAL "${ARG_COMPONENT}")
+          project_log(FATAL_ERROR "Conflicting COMPONENT for target '${TARGET_NAME}' in export '${ARG_EXPORT_NAME}': '${_tip_existing_component}' vs '${ARG_COMPONENT}'")
+        endif()
+      elseif(NOT "${_tip_existing_component}" STREQUAL "")
+        set(ARG_COMPONENT "${_tip_existing_component}")
+        if(_tip_existing_component_explicit)
+          set(_tip_component_explicit TRUE)
+        endif()
       endif()
+    endif()
+
+    if(ARG_COMPONENT)
+      set(RUNTIME_COMPONENT_NAME "${ARG_COMPONENT}")
+    else()
+      set(RUNTIME_COMPONENT_NAME "Runtime")
+    endif()
+    set(DEVELOPMENT_COMPONENT_NAME "Development")
+
+    set(_tip_target_RUNTIME_COMPONENT "${RUNTIME_COMPONENT_NAME}")
+    set(_tip_target_DEVELOPMENT_COMPONENT "${DEVELOPMENT_COMPONENT_NAME}")
+    set(_tip_target_COMPONENT "${ARG_COMPONENT}")
+    set(_tip_target_COMPONENT_EXPLICIT "${_tip_component_explicit}")
+    set(_tip_target_ALIAS_NAME "${ARG_ALIAS_NAME}")
+    set(_tip_target_ALIAS_NAME_EXPLICIT "${_tip_alias_name_explicit}")
+
+    foreach(_tip_additional_target IN LISTS ARG_ADDITIONAL_TARGETS)
+      get_property(
+        _tip_additional_target_record_set GLOBAL
+        PROPERTY "${EXPORT_PROPERTY_PREFIX}_TARGET_${_tip_additional_target}_RECORD"
+        SET)
+      if(NOT _tip_additional_target_record_set AND NOT _tip_additional_target STREQUAL TARGET_NAME)
+        list(APPEND _tip_new_export_targets "${_tip_additional_target}")
+        get_target_property(_tip_additional_target_export_name ${_tip_additional_target} EXPORT_NAME)
+        if(_tip_additional_target_export_name AND NOT _tip_additional_target_export_name MATCHES "-NOTFOUND$")
+          set(_tip_additional_target_alias_name "${_tip_additional_target_export_name}")
+        else()
+          set(_tip_additional_target_alias_name "${_tip_additional_target}")
+        endif()
 
-      set(_tip_sbom_project_homepage_var "${_tip_sbom_metadata_project}_HOMEPAGE_URL")
-      if("${ARG_SBOM_HOMEPAGE_URL}" STREQUAL ""
-         AND DEFINED ${_tip_sbom_project_homepage_var}
-         AND NOT "${${_tip_sbom_project_homepage_var}}" STREQUAL "")
-        _tip_store_export_property("${EXPORT_PROPERTY_PREFIX}" "${ARG_EXPORT_NAME}" "SBOM_INHERITED_HOMEPAGE_URL" "${${_tip_sbom_project_homepage_var}}" "SBOM inherited project homepage URL")
+        set(_tip_additional_record_RUNTIME_COMPONENT "${RUNTIME_COMPONENT_NAME}")
+        set(_tip_additional_record_DEVELOPMENT_COMPONENT "${DEVELOPMENT_COMPONENT_NAME}")
+        set(_tip_additional_record_DEVELOPMENT_COMPONENT_EXPLICIT FALSE)
+        set(_tip_additional_record_COMPONENT "${ARG_COMPONENT}")
+        set(_tip_additional_record_COMPONENT_EXPLICIT FALSE)
+        set(_tip_additional_record_ALIAS_NAME "${_tip_additional_target_alias_name}")
+        set(_tip_additional_record_ALIAS_NAME_EXPLICIT FALSE)
+        _tip_encode_target_record("${EXPORT_PROPERTY_PREFIX}_TARGET_${_tip_additional_target}_RECORD" _tip_additional_record_)
       endif()
-    endif()
 
-    string(SHA256 _tip_sbom_group_hash "${_tip_effective_sbom_name}")
-    get_property(_tip_sbom_group_name GLOBAL PROPERTY "_TIP_SBOM_GROUP_${_tip_sbom_group_hash}_NAME")
-    if(NOT "${_tip_sbom_group_name}" STREQUAL "" AND NOT "${_tip_sbom_group_name}" STREQUAL "${_tip_effective_sbom_name}")
-      project_log(FATAL_ERROR "Internal SBOM name hash collision between '${_tip_sbom_group_name}' and '${_tip_effective_sbom_name}'.")
-    endif()
-    set_property(GLOBAL PROPERTY "_TIP_SBOM_GROUP_${_tip_sbom_group_hash}_NAME" "${_tip_effective_sbom_name}")
+      get_target_property(_tip_additional_target_layout ${_tip_additional_target} TARGET_INSTALL_PACKAGE_LAYOUT)
+      if(NOT _tip_additional_target_layout)
+        set_target_properties(${_tip_additional_target} PROPERTIES TARGET_INSTALL_PACKAGE_LAYOUT "${_tip_layout}")
+      endif()
+    endforeach()
 
-    get_property(_tip_sbom_group_exports GLOBAL PROPERTY "_TIP_SBOM_GROUP_${_tip_sbom_group_hash}_EXPORTS")
-    if(CMAKE_VERSION VERSION_LESS "4.4"
-       AND _tip_sbom_group_exports
-       AND NOT ARG_EXPORT_NAME IN_LIST _tip_sbom_group_exports)
-      project_log(FATAL_ERROR
-                  "SBOM_NAME '${_tip_effective_sbom_name}' is already registered for export '${_tip_sbom_group_exports}'. Aggregating multiple export sets into one SBOM requires CMake 4.4 or newer.")
+    # Store whether DEVELOPMENT_COMPONENT was explicitly specified (Always false now since we only use COMPONENT parameter)
+    set(_tip_target_DEVELOPMENT_COMPONENT_EXPLICIT FALSE)
+    project_log(DEBUG "  DEVELOPMENT_COMPONENT_EXPLICIT for '${TARGET_NAME}': FALSE")
+
+    # Store lists
+    if(ARG_ADDITIONAL_FILES)
+      set(_tip_target_ADDITIONAL_FILES "${ARG_ADDITIONAL_FILES}")
+      set(_tip_target_ADDITIONAL_FILES_DESTINATION "${ARG_ADDITIONAL_FILES_DESTINATION}")
+      set(_tip_target_ADDITIONAL_FILES_SOURCE_DIR "${CMAKE_CURRENT_SOURCE_DIR}")
+      if(ARG_ADDITIONAL_FILES_COMPONENTS)
+        set(_tip_target_ADDITIONAL_FILES_COMPONENTS "${ARG_ADDITIONAL_FILES_COMPONENTS}")
+      endif()
+    elseif(ARG_ADDITIONAL_FILES_COMPONENTS)
+      project_log(FATAL_ERROR "ADDITIONAL_FILES_COMPONENTS requires ADDITIONAL_FILES for target '${TARGET_NAME}'.")
     endif()
-    list(APPEND _tip_sbom_group_exports "${ARG_EXPORT_NAME}")
-    list(REMOVE_DUPLICATES _tip_sbom_group_exports)
-    set_property(GLOBAL PROPERTY "_TIP_SBOM_GROUP_${_tip_sbom_group_hash}_EXPORTS" "${_tip_sbom_group_exports}")
+    _tip_encode_target_record("${EXPORT_PROPERTY_PREFIX}_TARGET_${TARGET_NAME}_RECORD" _tip_target_)
+  endforeach()
 
-    get_property(_tip_sbom_group_hashes GLOBAL PROPERTY "_TIP_SBOM_GROUP_HASHES")
-    list(APPEND _tip_sbom_group_hashes "${_tip_sbom_group_hash}")
-    list(REMOVE_DUPLICATES _tip_sbom_group_hashes)
-    set_property(GLOBAL PROPERTY "_TIP_SBOM_GROUP_HASHES" "${_tip_sbom_group_hashes}")
+  # Store export-level configuration (shared settings)
+  if(_tip_new_export_targets)
+    set_property(GLOBAL APPEND PROPERTY "${EXPORT_PROPERTY_PREFIX}_TARGETS" ${_tip_new_export_targets})
   endif()
+  if(_tip_version_explicit)
+    set(_tip_export_VERSION_EXPLICIT TRUE)
+  endif()
+  _tip_merge_export_field(_tip_export_ "${ARG_EXPORT_NAME}" "NAMESPACE" "${ARG_NAMESPACE}" "namespace")
+  _tip_merge_export_field(_tip_export_ "${ARG_EXPORT_NAME}" "VERSION" "${ARG_VERSION}" "version")
+  _tip_merge_export_field(_tip_export_ "${ARG_EXPORT_NAME}" "COMPATIBILITY" "${ARG_COMPATIBILITY}" "compatibility")
+  _tip_merge_export_field(_tip_export_ "${ARG_EXPORT_NAME}" "ARCH_INDEPENDENT" "${ARG_ARCH_INDEPENDENT}" "architecture independence")
+  _tip_merge_export_field(_tip_export_ "${ARG_EXPORT_NAME}" "FLATTEN_CONFIG" "${ARG_FLATTEN_CONFIG}" "flattened config")
+  _tip_merge_export_field(_tip_export_ "${ARG_EXPORT_NAME}" "SHARD_BY_COMPONENT" "${ARG_SHARD_BY_COMPONENT}" "component sharding")
+  _tip_merge_export_field(_tip_export_ "${ARG_EXPORT_NAME}" "FLATTEN_DEPENDENCIES" "${ARG_FLATTEN_DEPENDENCIES}" "flattened dependencies")
+  _tip_merge_export_field(_tip_export_ "${ARG_EXPORT_NAME}" "BAKE_DEPENDENCY_HINTS" "${ARG_BAKE_DEPENDENCY_HINTS}" "baked dependency hints")
+  _tip_merge_export_field(_tip_export_ "${ARG_EXPORT_NAME}" "BUILD_TREE_EXPORT" "${ARG_BUILD_TREE_EXPORT}" "build-tree export")
+  _tip_merge_export_field(_tip_export_ "${ARG_EXPORT_NAME}" "HEADER_COST_REPORT" "${ARG_HEADER_COST_REPORT}" "header cost report")
+  _tip_merge_export_field(_tip_export_ "${ARG_EXPORT_NAME}" "INSTALL_MANIFEST" "${ARG_INSTALL_MANIFEST}" "install manifest")
+  _tip_merge_export_field(_tip_export_ "${ARG_EXPORT_NAME}" "CONFIG_TEMPLATE" "${ARG_CONFIG_TEMPLATE}" "config template")
+  _tip_merge_export_field(_tip_export_ "${ARG_EXPORT_NAME}" "INCLUDE_DESTINATION" "${ARG_INCLUDE_DESTINATION}" "include destination")
+  _tip_merge_export_field(_tip_export_ "${ARG_EXPORT_NAME}" "MODULE_DESTINATION" "${ARG_MODULE_DESTINATION}" "module destination")
+  _tip_merge_export_field(_tip_export_ "${ARG_EXPORT_NAME}" "SOURCE_DESTINATION" "${ARG_SOURCE_DESTINATION}" "source destination")
+  _tip_merge_export_field(_tip_export_ "${ARG_EXPORT_NAME}" "CMAKE_CONFIG_DESTINATION" "${ARG_CMAKE_CONFIG_DESTINATION}" "CMake config destination")
+  _tip_merge_export_field(_tip_export_ "${ARG_EXPORT_NAME}" "DEBUG_POSTFIX" "${ARG_DEBUG_POSTFIX}" "debug postfix")
 
-  get_property(
-    _tip_current_source_dir_set GLOBAL
-    PROPERTY "${EXPORT_PROPERTY_PREFIX}_CURRENT_SOURCE_DIR"
-    SET)
-  if(NOT _tip_current_source_dir_set)
-    set_property(GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_CURRENT_SOURCE_DIR" "${CMAKE_CURRENT_SOURCE_DIR}")
+  if(ARG_CPS)
+    _tip_merge_cps_export_record()
   endif()
 
-  get_property(
-    _tip_current_binary_dir_set GLOBAL
-    PROPERTY "${EXPORT_PROPERTY_PREFIX}_CURRENT_BINARY_DIR"
-    SET)
-  if(NOT _tip_current_binary_dir_set)
-    set_property(GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_CURRENT_BINARY_DIR" "${CMAKE_CURRENT_BINARY_DIR}")
+  if(ARG_SBOM)
+    _tip_merge_sbom_export_record()
   endif()
 
-  # For config files, use the shared development component for the export.
-  get_property(EXISTING_CONFIG_COMPONENT GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_CONFIG_DEVELOPMENT_COMPONENT")
-  if(NOT EXISTING_CONFIG_COMPONENT)
-    set_property(GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_CONFIG_DEVELOPMENT_COMPONENT" "${DEVELOPMENT_COMPONENT_NAME}")
+  if("${_tip_export_CURRENT_SOURCE_DIR}" STREQUAL "")
+    set(_tip_export_CURRENT_SOURCE_DIR "${CMAKE_CURRENT_SOURCE_DIR}")
+  endif()
+  if("${_tip_export_CURRENT_BINARY_DIR}" STREQUAL "")
+    set(_tip_export_CURRENT_BINARY_DIR "${CMAKE_CURRENT_BINARY_DIR}")
   endif()
 
-  # Store lists
-  if(ARG_ADDITIONAL_FILES)
-    set_property(GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_TARGET_${TARGET_NAME}_ADDITIONAL_FILES" "${ARG_ADDITIONAL_FILES}")
-    set_property(GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_TARGET_${TARGET_NAME}_ADDITIONAL_FILES_DESTINATION" "${ARG_ADDITIONAL_FILES_DESTINATION}")
-    set_property(GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_TARGET_${TARGET_NAME}_ADDITIONAL_FILES_SOURCE_DIR" "${CMAKE_CURRENT_SOURCE_DIR}")
-    if(ARG_ADDITIONAL_FILES_COMPONENTS)
-      set_property(GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_TARGET_${TARGET_NAME}_ADDITIONAL_FILES_COMPONENTS" "${ARG_ADDITIONAL_FILES_COMPONENTS}")
-    endif()
-  elseif(ARG_ADDITIONAL_FILES_COMPONENTS)
-    project_log(FATAL_ERROR "ADDITIONAL_FILES_COMPONENTS requires ADDITIONAL_FILES for target '${TARGET_NAME}'.")
+  # For config files, use the shared development component for the export.
+  if(NOT _tip_export_CONFIG_DEV_COMPONENT)
+    set(_tip_export_CONFIG_DEV_COMPONENT "${DEVELOPMENT_COMPONENT_NAME}")
   endif()
 
   # Append to existing dependencies and CMake files
   if(ARG_PUBLIC_DEPENDENCIES)
-    get_property(EXISTING_DEPS GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_PUBLIC_DEPENDENCIES")
+    set(EXISTING_DEPS ${_tip_export_PUBLIC_DEPENDENCIES})
     if(EXISTING_DEPS)
       list(APPEND EXISTING_DEPS ${ARG_PUBLIC_DEPENDENCIES})
       list(REMOVE_DUPLICATES EXISTING_DEPS)
     else()
       set(EXISTING_DEPS ${ARG_PUBLIC_DEPENDENCIES})
     endif()
-    set_property(GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_PUBLIC_DEPENDENCIES" "${EXISTING_DEPS}")
+    set(_tip_export_PUBLIC_DEPENDENCIES "${EXISTING_DEPS}")
+
+    # Packages generated by this module publish their closure as <Package>_TRANSITIVE_DEPENDENCIES when found, so the
+    # closure of this export is theirs followed by the dependency itself, leaf first.
+    foreach(_tip_dependency IN LISTS ARG_PUBLIC_DEPENDENCIES)
+      _tip_find_package_expression_package_name(_tip_dependency_package_name "${_tip_dependency}")
+      _tip_append_export_field_unique(_tip_export_ TRANSITIVE_DEPENDENCIES ${${_tip_dependency_package_name}_TRANSITIVE_DEPENDENCIES} "${_tip_dependency}")
+    endforeach()
   endif()
 
   if(ARG_INCLUDE_ON_FIND_PACKAGE)
-    get_property(EXISTING_CMAKE_FILES GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_INCLUDE_ON_FIND_PACKAGE")
+    set(EXISTING_CMAKE_FILES ${_tip_export_INCLUDE_ON_FIND_PACKAGE})
     if(EXISTING_CMAKE_FILES)
       list(APPEND EXISTING_CMAKE_FILES ${ARG_INCLUDE_ON_FIND_PACKAGE})
       list(REMOVE_DUPLICATES EXISTING_CMAKE_FILES)
     else()
       set(EXISTING_CMAKE_FILES ${ARG_INCLUDE_ON_FIND_PACKAGE})
     endif()
-    set_property(GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_INCLUDE_ON_FIND_PACKAGE" "${EXISTING_CMAKE_FILES}")
+    set(_tip_export_INCLUDE_ON_FIND_PACKAGE "${EXISTING_CMAKE_FILES}")
   endif()
 
   # Handle component-dependent dependencies
@@ -1363,10 +1538,7 @@ function(target_prepare_package TARGET_NAME)
       math(EXPR _tip_index "${_tip_index} + 2")
     endwhile()
 
-    get_property(_tip_component_names GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_COMPONENT_DEPENDENCY_COMPONENTS")
-    if(NOT _tip_component_names)
-      set(_tip_component_names "")
-    endif()
+    set(_tip_component_names ${_tip_export_COMPONENT_DEPENDENCY_COMPONENTS})
 
     list(LENGTH _tip_normalized_component_deps _tip_norm_count)
     set(_tip_norm_index 0)
@@ -1395,7 +1567,7 @@ function(target_prepare_package TARGET_NAME)
 
     if(_tip_component_names)
       list(REMOVE_DUPLICATES _tip_component_names)
-      set_property(GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_COMPONENT_DEPENDENCY_COMPONENTS" "${_tip_component_names}")
+      set(_tip_export_COMPONENT_DEPENDENCY_COMPONENTS "${_tip_component_names}")
     endif()
 
     set(_tip_component_dep_pairs "")
@@ -1407,27 +1579,30 @@ function(target_prepare_package TARGET_NAME)
     project_log(DEBUG "  Component dependencies for export '${ARG_EXPORT_NAME}': ${_tip_component_dep_pairs}")
   endif()
 
+  _tip_encode_export_record("${EXPORT_PROPERTY_PREFIX}_RECORD" _tip_export_)
+
   # Track this export for auto-finalization
   get_property(REGISTERED_EXPORTS GLOBAL PROPERTY "_CMAKE_PACKAGE_REGISTERED_EXPORTS")
   if(NOT ARG_EXPORT_NAME IN_LIST REGISTERED_EXPORTS)
     list(APPEND REGISTERED_EXPORTS ${ARG_EXPORT_NAME})
     set_property(GLOBAL PROPERTY "_CMAKE_PACKAGE_REGISTERED_EXPORTS" ${REGISTERED_EXPORTS})
-
-    # Schedule automatic finalization for this export at the end of configuration
-    project_log(DEBUG "  Scheduling automatic finalization for export '${ARG_EXPORT_NAME}' at end of configuration")
-    cmake_language(EVAL CODE "cmake_language(DEFER DIRECTORY \"${CMAKE_SOURCE_DIR}\" CALL _auto_finalize_single_export \"${ARG_EXPORT_NAME}\")")
   endif()
 
-  if(ARG_SBOM)
-    get_property(_tip_sbom_finalization_scheduled GLOBAL PROPERTY "_TIP_SBOM_FINALIZATION_SCHEDULED")
-    if(NOT _tip_sbom_finalization_scheduled)
-      set_property(GLOBAL PROPERTY "_TIP_SBOM_FINALIZATION_SCHEDULED" TRUE)
-      cmake_language(EVAL CODE "cmake_language(DEFER DIRECTORY \"${CMAKE_SOURCE_DIR}\" CALL _tip_finalize_all_sboms)")
-    endif()
+  # One deferred driver finalizes every registered export (and the SBOMs) at the end of configuration
+  get_property(_tip_finalization_scheduled GLOBAL PROPERTY "_TIP_FINALIZATION_SCHEDULED")
+  if(NOT _tip_finalization_scheduled)
+    set_property(GLOBAL PROPERTY "_TIP_FINALIZATION_SCHEDULED" TRUE)
+    project_log(DEBUG "  Scheduling automatic finalization of registered exports at end of configuration")
+    cmake_language(DEFER DIRECTORY "${CMAKE_SOURCE_DIR}" CALL _tip_finalize_registered_exports)
   endif()
 
-  project_log(VERBOSE "Target '${TARGET_NAME}' configured successfully for export '${ARG_EXPORT_NAME}'")
-endfunction(target_prepare_package)
+  foreach(TARGET_NAME IN LISTS TARGET_NAMES)
+    project_log(VERBOSE "Target '${TARGET_NAME}' configured successfully for export '${ARG_EXPORT_NAME}'")
+  endforeach()
+  if(TIP_PROFILE)
+    _tip_profile_end()
+  endif()
+endfunction()
 
 # ~~~
 # Helper: Determine whether a target contributes runtime payload through this wrapper.
@@ -1458,6 +1633,7 @@ endfunction()
 # This internal helper function gathers component assignments across all targets
 # in an export for logging and debugging purposes. It abstracts the complex
 # component collection logic from the main finalize_package() flow.
+# It reads the _tip_target_<target>_* variables decoded by finalize_package().
 #
 # Returns via parent scope variables:
 #   ALL_RUNTIME_COMPONENTS - List of unique runtime components
@@ -1465,15 +1641,15 @@ endfunction()
 #   ALL_COMPONENTS - List of unique other components
 #   COMPONENT_TARGET_MAP - List of "component:target" mappings for debugging
 # ~~~
-function(_collect_export_components EXPORT_PROPERTY_PREFIX TARGETS)
+function(_collect_export_components TARGETS)
   set(ALL_RUNTIME_COMPONENTS "")
   set(ALL_DEVELOPMENT_COMPONENTS "")
   set(ALL_COMPONENTS "")
   set(COMPONENT_TARGET_MAP "")
 
   foreach(TARGET_NAME ${TARGETS})
-    get_property(TARGET_RUNTIME_COMP GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_TARGET_${TARGET_NAME}_RUNTIME_COMPONENT")
-    get_property(TARGET_DEV_COMP GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_TARGET_${TARGET_NAME}_DEVELOPMENT_COMPONENT")
+    set(TARGET_RUNTIME_COMP "${_tip_target_${TARGET_NAME}_RUNTIME_COMPONENT}")
+    set(TARGET_DEV_COMP "${_tip_target_${TARGET_NAME}_DEVELOPMENT_COMPONENT}")
 
     if(TARGET_DEV_COMP)
       set(DEV_COMPONENT_NAME "${TARGET_DEV_COMP}")
@@ -1558,63 +1734,142 @@ function(_build_component_args VAR_PREFIX COMPONENT_PREFIX COMPONENT_TYPE)
 endfunction()
 
 # ~~~
-# Compute the path from one install destination to another using a dummy prefix so
-# results stay generator-agnostic. Returns an empty string if either destination
-# contains generator expressions that cannot be resolved at configure time.
+# Install the ADDITIONAL_FILES of TARGET_NAME. Entries are files, directories or file(GLOB) patterns (containing `*`,
+# `?` or `[` and naming no existing path, so `notes[v2].txt` stays the file it names), relative to the source directory. A file is installed to the destination; a directory installs the files
+# below it to <destination>/<name>, or to the destination itself when written with a trailing slash, keeping their
+# subdirectories. Directories and patterns are globbed with CONFIGURE_DEPENDS, so added files trigger a reconfigure.
+# Files that share a destination directory are installed by one install(FILES) rule per component, and the lists are
+# built with whole-list operations, so configure time follows the number of files and the rule count the number of
+# directories. Called by finalize_package() for each target, and reads its TARGET_ADDITIONAL_FILES* and
+# TARGET_DEV_COMPONENT_ARGS variables.
 # ~~~
-function(_tip_compute_relative_install_path RESULT_VAR FROM_DESTINATION TO_DESTINATION)
-  set(${RESULT_VAR}
-      ""
-      PARENT_SCOPE)
-
-  if("${TO_DESTINATION}" STREQUAL "")
-    return()
-  endif()
-
-  if("${TO_DESTINATION}" MATCHES "\\$<" OR "${FROM_DESTINATION}" MATCHES "\\$<")
-    project_log(DEBUG "Skipping relative path computation for generator expression destinations: from='${FROM_DESTINATION}' to='${TO_DESTINATION}'")
-    return()
-  endif()
-
-  cmake_path(IS_ABSOLUTE TO_DESTINATION TO_IS_ABSOLUTE)
-  if(TO_IS_ABSOLUTE)
-    set(${RESULT_VAR}
-        "${TO_DESTINATION}"
-        PARENT_SCOPE)
-    return()
-  endif()
-
-  set(_tip_dummy_prefix "/target_install_package_prefix")
-
-  if("${FROM_DESTINATION}" STREQUAL "")
-    set(_tip_from ".")
+function(_tip_install_additional_files TARGET_NAME)
+  if(TARGET_ADDITIONAL_FILES_COMPONENTS)
+    set(_tip_additional_file_components ${TARGET_ADDITIONAL_FILES_COMPONENTS})
   else()
-    set(_tip_from "${FROM_DESTINATION}")
+    list(GET TARGET_DEV_COMPONENT_ARGS 1 _tip_additional_file_components)
+  endif()
+  _tip_register_shared_install_components(${_tip_additional_file_components})
+
+  # Entries that are not absolute like IS_ABSOLUTE decides, ^(/|[A-Za-z]:[/\\]), are below the source directory
+  set(_tip_entries ${TARGET_ADDITIONAL_FILES})
+  list(TRANSFORM _tip_entries PREPEND "${TARGET_ADDITIONAL_FILES_SOURCE_DIR}/" REGEX "^([^/A-Za-z]|[A-Za-z]($|[^:]|:($|[^/\\])))")
+  # Only entries with `.` or `..` components or repeated separators need normalizing
+  set(_tip_unnormalized ${_tip_entries})
+  list(FILTER _tip_unnormalized INCLUDE REGEX "/\\.\\.?(/|$)|.//")
+  foreach(_tip_entry IN LISTS _tip_unnormalized)
+    cmake_path(NORMAL_PATH _tip_entry)
+    list(APPEND _tip_entries "${_tip_entry}")
+  endforeach()
+  if(_tip_unnormalized)
+    list(REMOVE_ITEM _tip_entries ${_tip_unnormalized})
   endif()
+  set(_tip_patterns ${_tip_entries})
+  list(FILTER _tip_patterns INCLUDE REGEX "[*?[]")
+  list(FILTER _tip_entries EXCLUDE REGEX "[*?[]")
+  foreach(_tip_pattern IN LISTS _tip_patterns)
+    if(EXISTS "${_tip_pattern}")
+      list(APPEND _tip_entries "${_tip_pattern}")
+      list(REMOVE_ITEM _tip_patterns "${_tip_pattern}")
+    endif()
+  endforeach()
 
-  cmake_path(IS_ABSOLUTE _tip_from FROM_IS_ABSOLUTE)
-  if(FROM_IS_ABSOLUTE)
-    set(_from_abs "${_tip_from}")
-  else()
-    set(_from_abs "${_tip_dummy_prefix}")
-    cmake_path(APPEND _from_abs "${_tip_from}")
+  set(_tip_directories "")
+  foreach(_tip_entry IN LISTS _tip_entries)
+    if(IS_DIRECTORY "${_tip_entry}")
+      list(APPEND _tip_directories "${_tip_entry}")
+    elseif(NOT EXISTS "${_tip_entry}")
+      project_log(FATAL_ERROR "  Additional file to install not found for '${TARGET_NAME}': ${_tip_entry}")
+    endif()
+  endforeach()
+  set(_tip_files ${_tip_entries})
+  if(_tip_directories)
+    list(REMOVE_ITEM _tip_files ${_tip_directories})
+  endif()
+
+  foreach(_tip_pattern IN LISTS _tip_patterns)
+    file(GLOB _tip_matches CONFIGURE_DEPENDS LIST_DIRECTORIES true "${_tip_pattern}")
+    if(NOT _tip_matches)
+      project_log(FATAL_ERROR "  Additional files pattern matched nothing for '${TARGET_NAME}': ${_tip_pattern}")
+    endif()
+    file(GLOB _tip_matched_files CONFIGURE_DEPENDS LIST_DIRECTORIES false "${_tip_pattern}")
+    list(APPEND _tip_files ${_tip_matched_files})
+    list(LENGTH _tip_matches _tip_match_count)
+    list(LENGTH _tip_matched_files _tip_matched_file_count)
+    if(NOT _tip_match_count EQUAL _tip_matched_file_count)
+      foreach(_tip_match IN LISTS _tip_matches)
+        if(IS_DIRECTORY "${_tip_match}")
+          list(APPEND _tip_directories "${_tip_match}")
+        endif()
+      endforeach()
+    endif()
+  endforeach()
+
+  # Files are grouped by destination directory; each group appends whole lists, once per directory
+  set(_tip_group_destinations "")
+  if(_tip_files)
+    list(APPEND _tip_group_destinations "${TARGET_ADDITIONAL_FILES_DESTINATION}")
+    set("_tip_group_files_${TARGET_ADDITIONAL_FILES_DESTINATION}" ${_tip_files})
   endif()
-  cmake_path(NORMAL_PATH _from_abs)
 
-  set(_to_abs "${_tip_dummy_prefix}")
-  cmake_path(APPEND _to_abs "${TO_DESTINATION}")
-  cmake_path(NORMAL_PATH _to_abs)
+  foreach(_tip_directory IN LISTS _tip_directories)
+    string(REGEX REPLACE "/+$" "" _tip_root "${_tip_directory}")
+    set(_tip_root_destination "${TARGET_ADDITIONAL_FILES_DESTINATION}")
+    if(NOT _tip_directory MATCHES "/$")
+      cmake_path(GET _tip_root FILENAME _tip_root_name)
+      string(APPEND _tip_root_destination "/${_tip_root_name}")
+    endif()
+    # Glob characters in directory names match themselves
+    string(REGEX REPLACE "([[*?])" "[\\1]" _tip_root_pattern "${_tip_root}")
 
-  file(RELATIVE_PATH _relative "${_from_abs}" "${_to_abs}")
-  if(_relative STREQUAL "")
-    set(_relative ".")
-  endif()
+    # One glob for the whole tree gives the subdirectories that hold files, then one glob per subdirectory its files
+    file(GLOB_RECURSE _tip_subdirectories CONFIGURE_DEPENDS LIST_DIRECTORIES false RELATIVE "${_tip_root}" "${_tip_root_pattern}/*")
+    if(NOT _tip_subdirectories)
+      project_log(WARNING "Additional files directory for '${TARGET_NAME}' has no files: ${_tip_root}")
+      continue()
+    endif()
+    list(TRANSFORM _tip_subdirectories PREPEND "./")
+    list(TRANSFORM _tip_subdirectories REPLACE "/[^/]*$" "")
+    list(REMOVE_DUPLICATES _tip_subdirectories)
+    foreach(_tip_subdirectory IN LISTS _tip_subdirectories)
+      string(REGEX REPLACE "^\\.(/|$)" "" _tip_subdirectory "${_tip_subdirectory}")
+      set(_tip_group_pattern "${_tip_root_pattern}")
+      set(_tip_group_destination "${_tip_root_destination}")
+      if(_tip_subdirectory)
+        string(REGEX REPLACE "([[*?])" "[\\1]" _tip_subdirectory_pattern "${_tip_subdirectory}")
+        string(APPEND _tip_group_pattern "/${_tip_subdirectory_pattern}")
+        string(APPEND _tip_group_destination "/${_tip_subdirectory}")
+      endif()
+      file(GLOB _tip_group_files LIST_DIRECTORIES false "${_tip_group_pattern}/*")
+      if(NOT "${_tip_group_destination}" IN_LIST _tip_group_destinations)
+        list(APPEND _tip_group_destinations "${_tip_group_destination}")
+      endif()
+      list(APPEND "_tip_group_files_${_tip_group_destination}" ${_tip_group_files})
+    endforeach()
+  endforeach()
 
-  cmake_path(NORMAL_PATH _relative OUTPUT_VARIABLE _relative)
+  foreach(_tip_group_destination IN LISTS _tip_group_destinations)
+    set(_tip_group_files_variable "_tip_group_files_${_tip_group_destination}")
+    _tip_install_additional_file_group("${_tip_group_destination}" ${${_tip_group_files_variable}})
+  endforeach()
+endfunction()
 
-  set(${RESULT_VAR}
-      "${_relative}"
-      PARENT_SCOPE)
+# ~~~
+# Add the install(FILES) rule, and with TIP_INSTALL_LINK_MODE or INSTALL_MANIFEST the rule ahead of it, for the files of
+# _tip_install_additional_files() installed to DESTINATION, once per component in _tip_additional_file_components.
+# ~~~
+function(_tip_install_additional_file_group DESTINATION)
+  foreach(_tip_additional_file_component IN LISTS _tip_additional_file_components)
+    if(_tip_install_link_mode OR INSTALL_MANIFEST)
+      _tip_add_pre_install_rule(DESTINATION "${DESTINATION}" COMPONENT "${_tip_additional_file_component}" FILES ${ARGN})
+    endif()
+    install(
+      FILES ${ARGN}
+      DESTINATION "${DESTINATION}"
+      COMPONENT "${_tip_additional_file_component}")
+  endforeach()
+  list(LENGTH ARGN _tip_file_count)
+  project_log(DEBUG "  Installing ${_tip_file_count} additional files for '${TARGET_NAME}' -> ${DESTINATION}")
 endfunction()
 
 # Helper to setup CPack component relationships
@@ -1654,76 +1909,83 @@ function(finalize_package)
     project_log(DEBUG "Export '${ARG_EXPORT_NAME}' has already been finalized, skipping")
     return()
   endif()
+  if(TIP_PROFILE)
+    _tip_profile_begin("finalize_package(${ARG_EXPORT_NAME})" export "${ARG_EXPORT_NAME}")
+  endif()
 
   # Retrieve stored configuration
   set(EXPORT_PROPERTY_PREFIX "_CMAKE_PACKAGE_EXPORT_${ARG_EXPORT_NAME}")
 
   get_property(TARGETS GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_TARGETS")
+  foreach(_tip_export_record_name IN ITEMS RECORD CPS_RECORD SBOM_RECORD)
+    get_property(_tip_export_record_fields GLOBAL PROPERTY "_TIP_EXPORT_${_tip_export_record_name}_FIELDS")
+    get_property(_tip_export_record GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_${_tip_export_record_name}")
+    _tip_decode_record(_tip_export _tip_export_record_fields _tip_export_record)
+    foreach(_tip_export_field IN LISTS _tip_export_record_fields)
+      set(${_tip_export_field} "${_tip_export_${_tip_export_field}}")
+    endforeach()
+  endforeach()
   if(NOT TARGETS)
+    get_property(_tip_export_skipped GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_SKIPPED")
+    if(_tip_export_skipped)
+      project_log(VERBOSE "Export '${ARG_EXPORT_NAME}' has no installable targets, skipping finalization")
+      if(TIP_PROFILE)
+        _tip_profile_end()
+      endif()
+      return()
+    endif()
     project_log(FATAL_ERROR "No targets prepared for export '${ARG_EXPORT_NAME}'")
   endif()
 
-  # Get all stored properties
-  get_property(NAMESPACE GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_NAMESPACE")
-  get_property(VERSION GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_VERSION")
-  get_property(COMPATIBILITY GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_COMPATIBILITY")
-  get_property(ARCH_INDEPENDENT GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_ARCH_INDEPENDENT")
-  get_property(CONFIG_TEMPLATE GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_CONFIG_TEMPLATE")
-  get_property(INCLUDE_DESTINATION GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_INCLUDE_DESTINATION")
-  get_property(MODULE_DESTINATION GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_MODULE_DESTINATION")
-  get_property(SOURCE_DESTINATION GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_SOURCE_DESTINATION")
-  get_property(CMAKE_CONFIG_DESTINATION GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_CMAKE_CONFIG_DESTINATION")
-  get_property(CONFIG_DEV_COMPONENT GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_CONFIG_DEVELOPMENT_COMPONENT")
-  get_property(CURRENT_SOURCE_DIR GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_CURRENT_SOURCE_DIR")
-  get_property(CURRENT_BINARY_DIR GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_CURRENT_BINARY_DIR")
-  get_property(PUBLIC_DEPENDENCIES GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_PUBLIC_DEPENDENCIES")
-  get_property(INCLUDE_ON_FIND_PACKAGE GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_INCLUDE_ON_FIND_PACKAGE")
-  get_property(COMPONENT_DEPENDENCY_COMPONENTS GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_COMPONENT_DEPENDENCY_COMPONENTS")
-  get_property(DEBUG_POSTFIX GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_DEBUG_POSTFIX")
-  get_property(CPS_ENABLED GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_CPS")
-  get_property(CPS_PACKAGE_NAME GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_CPS_PACKAGE_NAME")
-  get_property(CPS_PROJECT GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_CPS_PROJECT")
-  get_property(CPS_NO_PROJECT_METADATA GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_CPS_NO_PROJECT_METADATA")
-  get_property(CPS_APPENDIX GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_CPS_APPENDIX")
-  get_property(CPS_DESTINATION GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_CPS_DESTINATION")
-  get_property(CPS_LOWER_CASE_FILE GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_CPS_LOWER_CASE_FILE")
-  get_property(CPS_VERSION GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_CPS_VERSION")
-  get_property(CPS_VERSION_EXPLICIT GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_CPS_VERSION_EXPLICIT")
-  get_property(CPS_COMPAT_VERSION GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_CPS_COMPAT_VERSION")
-  get_property(CPS_VERSION_SCHEMA GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_CPS_VERSION_SCHEMA")
-  get_property(CPS_DEFAULT_TARGETS GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_CPS_DEFAULT_TARGETS")
-  get_property(CPS_DEFAULT_CONFIGURATIONS GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_CPS_DEFAULT_CONFIGURATIONS")
-  get_property(CPS_LICENSE GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_CPS_LICENSE")
-  get_property(CPS_DEFAULT_LICENSE GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_CPS_DEFAULT_LICENSE")
-  get_property(CPS_DESCRIPTION GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_CPS_DESCRIPTION")
-  get_property(CPS_HOMEPAGE_URL GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_CPS_HOMEPAGE_URL")
-  get_property(CPS_PERMISSIONS GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_CPS_PERMISSIONS")
-  get_property(CPS_CONFIGURATIONS GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_CPS_CONFIGURATIONS")
-  get_property(CPS_CXX_MODULES_DIRECTORY GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_CPS_CXX_MODULES_DIRECTORY")
-  get_property(CPS_COMPONENT GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_CPS_COMPONENT")
-  get_property(CPS_EXCLUDE_FROM_ALL GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_CPS_EXCLUDE_FROM_ALL")
-  get_property(SBOM_ENABLED GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_SBOM")
-  get_property(SBOM_EXPERIMENTAL_VALUE GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_SBOM_EXPERIMENTAL_VALUE")
-  get_property(SBOM_METADATA_MODE GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_SBOM_METADATA_MODE")
-  get_property(SBOM_NAME GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_SBOM_NAME")
-  get_property(SBOM_PROJECT GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_SBOM_PROJECT")
-  get_property(SBOM_NO_PROJECT_METADATA GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_SBOM_NO_PROJECT_METADATA")
-  get_property(SBOM_INHERITED_PROJECT_METADATA GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_SBOM_INHERITED_PROJECT_METADATA")
-  get_property(SBOM_DESTINATION GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_SBOM_DESTINATION")
-  get_property(SBOM_VERSION GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_SBOM_VERSION")
-  get_property(SBOM_VERSION_EXPLICIT GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_SBOM_VERSION_EXPLICIT")
-  get_property(SBOM_INHERITED_VERSION GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_SBOM_INHERITED_VERSION")
-  get_property(SBOM_LICENSE GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_SBOM_LICENSE")
-  get_property(SBOM_INHERITED_LICENSE GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_SBOM_INHERITED_LICENSE")
-  get_property(SBOM_DESCRIPTION GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_SBOM_DESCRIPTION")
-  get_property(SBOM_INHERITED_DESCRIPTION GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_SBOM_INHERITED_DESCRIPTION")
-  get_property(SBOM_HOMEPAGE_URL GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_SBOM_HOMEPAGE_URL")
-  get_property(SBOM_INHERITED_HOMEPAGE_URL GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_SBOM_INHERITED_HOMEPAGE_URL")
-  get_property(SBOM_FORMAT GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_SBOM_FORMAT")
-  get_property(VERSION_EXPLICIT GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_VERSION_EXPLICIT")
+  # Decode every target record once; the helpers and loops below read the _tip_target_<target>_<FIELD> variables.
+  get_property(_tip_target_record_fields GLOBAL PROPERTY _TIP_TARGET_RECORD_FIELDS)
+  foreach(TARGET_NAME IN LISTS TARGETS)
+    get_property(_tip_target_record GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_TARGET_${TARGET_NAME}_RECORD")
+    _tip_decode_record("_tip_target_${TARGET_NAME}" _tip_target_record_fields _tip_target_record)
+  endforeach()
+
+  if(SHARD_BY_COMPONENT)
+    if(CPS_ENABLED OR SBOM_ENABLED OR FLATTEN_CONFIG)
+      project_log(FATAL_ERROR "SHARD_BY_COMPONENT for export '${ARG_EXPORT_NAME}' cannot be combined with CPS, SBOM or FLATTEN_CONFIG, which need all targets in one export set")
+    endif()
+    _tip_load_feature_module(tip_component_shards)
+    _tip_plan_component_shards("${ARG_EXPORT_NAME}")
+  endif()
+
+  # TIP_INSTALL_LINK_MODE adds install rules that place reflinks or hardlinks ahead of the copies
+  set(_tip_install_link_mode "")
+  if(TIP_INSTALL_LINK_MODE)
+    string(TOLOWER "${TIP_INSTALL_LINK_MODE}" _tip_install_link_mode)
+    if(NOT _tip_install_link_mode MATCHES "^(copy|reflink|hardlink)$")
+      project_log(FATAL_ERROR "Invalid TIP_INSTALL_LINK_MODE '${TIP_INSTALL_LINK_MODE}'. Valid values: copy, reflink, hardlink")
+    endif()
+    if(_tip_install_link_mode STREQUAL "copy")
+      set(_tip_install_link_mode "")
+    endif()
+  endif()
+  if(_tip_install_link_mode OR INSTALL_MANIFEST)
+    _tip_load_feature_module(tip_install_links)
+  endif()
+
+  # LAYOUT content_store moves the files of the whole export into one store once they are installed
+  set(_tip_content_store FALSE)
+  set(_tip_content_store_targets "")
+  foreach(TARGET_NAME IN LISTS TARGETS)
+    get_target_property(_tip_target_layout ${TARGET_NAME} TARGET_INSTALL_PACKAGE_LAYOUT)
+    if(_tip_target_layout STREQUAL "content_store")
+      list(APPEND _tip_content_store_targets ${TARGET_NAME})
+    endif()
+  endforeach()
+  if(_tip_content_store_targets)
+    if(NOT _tip_content_store_targets STREQUAL TARGETS)
+      project_log(FATAL_ERROR "LAYOUT content_store applies to all targets of export '${ARG_EXPORT_NAME}', but only [${_tip_content_store_targets}] of [${TARGETS}] use it")
+    endif()
+    set(_tip_content_store TRUE)
+    _tip_load_feature_module(tip_content_store)
+  endif()
 
   # Collect component information for logging and debugging
-  _collect_export_components("${EXPORT_PROPERTY_PREFIX}" "${TARGETS}")
+  _collect_export_components("${TARGETS}")
 
   list(LENGTH TARGETS target_count)
   if(target_count EQUAL 1)
@@ -1744,8 +2006,8 @@ function(finalize_package)
     list(APPEND ALL_UNIQUE_COMPONENTS ${ALL_COMPONENTS})
   endif()
   foreach(TARGET_NAME ${TARGETS})
-    get_property(TARGET_ADDITIONAL_FILES GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_TARGET_${TARGET_NAME}_ADDITIONAL_FILES")
-    get_property(TARGET_ADDITIONAL_FILES_COMPONENTS GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_TARGET_${TARGET_NAME}_ADDITIONAL_FILES_COMPONENTS")
+    set(TARGET_ADDITIONAL_FILES ${_tip_target_${TARGET_NAME}_ADDITIONAL_FILES})
+    set(TARGET_ADDITIONAL_FILES_COMPONENTS ${_tip_target_${TARGET_NAME}_ADDITIONAL_FILES_COMPONENTS})
     if(TARGET_ADDITIONAL_FILES AND TARGET_ADDITIONAL_FILES_COMPONENTS)
       list(APPEND ALL_UNIQUE_COMPONENTS ${TARGET_ADDITIONAL_FILES_COMPONENTS})
     endif()
@@ -1755,34 +2017,10 @@ function(finalize_package)
   if(ALL_UNIQUE_COMPONENTS)
     list(REMOVE_DUPLICATES ALL_UNIQUE_COMPONENTS)
     project_log(VERBOSE "Export '${ARG_EXPORT_NAME}' finalizing ${target_count} ${target_label}: [${TARGETS}] with components: [${ALL_UNIQUE_COMPONENTS}]")
-
-    # Component registration for CPack auto-detection Components are registered directly in the global property for export_cpack to consume
-    get_property(detected_components GLOBAL PROPERTY "_TIP_DETECTED_COMPONENTS")
-
-    # Add all unique components from this export
-    foreach(component ${ALL_UNIQUE_COMPONENTS})
-      if(NOT component IN_LIST detected_components)
-        list(APPEND detected_components "${component}")
-      endif()
-    endforeach()
-
-    if(detected_components)
-      list(REMOVE_DUPLICATES detected_components)
-      set_property(GLOBAL PROPERTY "_TIP_DETECTED_COMPONENTS" "${detected_components}")
-    endif()
-
-    if(ALL_RUNTIME_COMPONENTS)
-      get_property(_tip_detected_runtime_components GLOBAL PROPERTY "_TIP_DETECTED_RUNTIME_COMPONENTS")
-      foreach(component ${ALL_RUNTIME_COMPONENTS})
-        if(NOT component IN_LIST _tip_detected_runtime_components)
-          list(APPEND _tip_detected_runtime_components "${component}")
-        endif()
-      endforeach()
-      if(_tip_detected_runtime_components)
-        list(REMOVE_DUPLICATES _tip_detected_runtime_components)
-        set_property(GLOBAL PROPERTY "_TIP_DETECTED_RUNTIME_COMPONENTS" "${_tip_detected_runtime_components}")
-      endif()
-    endif()
+
+    # Components are registered in global properties for export_cpack to consume
+    _tip_register_detected_components(_TIP_DETECTED_COMPONENTS ${ALL_UNIQUE_COMPONENTS})
+    _tip_register_detected_components(_TIP_DETECTED_RUNTIME_COMPONENTS ${ALL_RUNTIME_COMPONENTS})
   else()
     project_log(VERBOSE "Export '${ARG_EXPORT_NAME}' finalizing ${target_count} ${target_label}: [${TARGETS}]")
   endif()
@@ -1812,13 +2050,28 @@ function(finalize_package)
   set(_tip_cps_unsupported_target_types EXECUTABLE MODULE_LIBRARY)
   set(_tip_exported_alias_names "")
 
+  # INSTALL_MANIFEST and LAYOUT content_store take the files installed between this marker and the rules after the config
+  # files
+  if(INSTALL_MANIFEST OR _tip_content_store)
+    _tip_find_target_install_package_resource_file("tip_install_manifest.cmake" _tip_manifest_script)
+    string(
+      CONCAT _tip_manifest_include
+             "if(NOT COMMAND _tip_write_install_manifest)\n"
+             "  include([==[${_tip_manifest_script}]==])\n"
+             "endif()\n")
+    install(CODE "${_tip_manifest_include}_tip_begin_install_manifest([==[${ARG_EXPORT_NAME}]==])\n" ALL_COMPONENTS)
+  endif()
+
   # Install each target separately with its own components
   set(_tip_export_has_source_sets FALSE)
   foreach(TARGET_NAME ${TARGETS})
-    get_property(TARGET_RUNTIME_COMP GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_TARGET_${TARGET_NAME}_RUNTIME_COMPONENT")
-    get_property(TARGET_DEV_COMP GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_TARGET_${TARGET_NAME}_DEVELOPMENT_COMPONENT")
-    get_property(TARGET_ALIAS_NAME GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_TARGET_${TARGET_NAME}_ALIAS_NAME")
-    get_property(TARGET_ALIAS_NAME_EXPLICIT GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_TARGET_${TARGET_NAME}_ALIAS_NAME_EXPLICIT")
+    if(TIP_PROFILE)
+      _tip_profile_begin("install(${ARG_EXPORT_NAME}/${TARGET_NAME})" export "${ARG_EXPORT_NAME}" target "${TARGET_NAME}")
+    endif()
+    set(TARGET_RUNTIME_COMP "${_tip_target_${TARGET_NAME}_RUNTIME_COMPONENT}")
+    set(TARGET_DEV_COMP "${_tip_target_${TARGET_NAME}_DEVELOPMENT_COMPONENT}")
+    set(TARGET_ALIAS_NAME "${_tip_target_${TARGET_NAME}_ALIAS_NAME}")
+    set(TARGET_ALIAS_NAME_EXPLICIT "${_tip_target_${TARGET_NAME}_ALIAS_NAME_EXPLICIT}")
 
     if(NOT TARGET_ALIAS_NAME_EXPLICIT)
       get_target_property(_tip_existing_target_export_name ${TARGET_NAME} EXPORT_NAME)
@@ -1873,7 +2126,11 @@ function(finalize_package)
     endif()
 
     # Primary install with export (to base components)
-    set(INSTALL_ARGS TARGETS ${TARGET_NAME} EXPORT ${ARG_EXPORT_NAME})
+    if(SHARD_BY_COMPONENT)
+      set(INSTALL_ARGS TARGETS ${TARGET_NAME} EXPORT ${_tip_shard_export_set_${TARGET_NAME}})
+    else()
+      set(INSTALL_ARGS TARGETS ${TARGET_NAME} EXPORT ${ARG_EXPORT_NAME})
+    endif()
 
     # ~~~
     # Add destination and component for each target type
@@ -1885,21 +2142,21 @@ function(finalize_package)
     #   (Import .lib files are development artifacts, not runtime)
     # ~~~
     # Determine configuration subdirectory policy based on layout. Layout options: - fhs:           no config subdir (standard system layout) - split_debug:   Debug under debug/, others no subdir -
-    # split_all: all configs under lower-cased $<CONFIG>/ (guarded for empty)
+    # split_all: all configs under lower-cased $<CONFIG>/ (guarded for empty) - content_store: fhs, with files hardlinked into a store
     get_target_property(_tip_target_layout ${TARGET_NAME} TARGET_INSTALL_PACKAGE_LAYOUT)
     if(NOT _tip_target_layout)
       set(_tip_target_layout "fhs")
     endif()
     set(_tip_cfgdir "")
 
-    if(_tip_target_layout STREQUAL "fhs")
+    if(_tip_target_layout STREQUAL "fhs" OR _tip_target_layout STREQUAL "content_store")
       set(_tip_cfgdir "")
     elseif(_tip_target_layout STREQUAL "split_debug")
       set(_tip_cfgdir "$<$<CONFIG:Debug>:debug/>")
     elseif(_tip_target_layout STREQUAL "split_all")
       set(_tip_cfgdir "$<$<BOOL:$<CONFIG>>:$<LOWER_CASE:$<CONFIG>>/>")
     else()
-      project_log(FATAL_ERROR "Invalid LAYOUT '${_tip_target_layout}'. Valid values: fhs, split_debug, split_all")
+      project_log(FATAL_ERROR "Invalid LAYOUT '${_tip_target_layout}'. Valid values: fhs, split_debug, split_all, content_store")
     endif()
 
     list(
@@ -2002,71 +2259,8 @@ function(finalize_package)
 
         # Only set defaults if NO RPATH is configured anywhere
         if(NOT TARGET_RPATH AND NOT CMAKE_INSTALL_RPATH)
-          set(DEFAULT_RPATHS)
-
-          set(_tip_runtime_destination "${CMAKE_INSTALL_BINDIR}")
-          if(NOT _tip_runtime_destination)
-            set(_tip_runtime_destination "bin")
-          endif()
-
-          set(_tip_library_destination "${CMAKE_INSTALL_LIBDIR}")
-          if(NOT _tip_library_destination)
-            set(_tip_library_destination "lib")
-          endif()
-
-          if(APPLE)
-            if(TARGET_TYPE STREQUAL "EXECUTABLE")
-              set(_tip_rel_path "")
-              _tip_compute_relative_install_path(_tip_rel_path "${_tip_runtime_destination}" "${_tip_library_destination}")
-
-              if(_tip_rel_path)
-                cmake_path(IS_ABSOLUTE _tip_rel_path _tip_rel_abs)
-                if(_tip_rel_abs)
-                  list(APPEND DEFAULT_RPATHS "${_tip_rel_path}")
-                elseif(_tip_rel_path STREQUAL "." OR _tip_rel_path STREQUAL "./")
-                  list(APPEND DEFAULT_RPATHS "@executable_path")
-                else()
-                  string(REGEX REPLACE "^\\./" "" _tip_rel_path_clean "${_tip_rel_path}")
-                  string(REPLACE "\\" "/" _tip_rel_path_clean "${_tip_rel_path_clean}")
-                  list(APPEND DEFAULT_RPATHS "@executable_path/${_tip_rel_path_clean}")
-                endif()
-              else()
-                list(APPEND DEFAULT_RPATHS "@executable_path/../lib" "@executable_path/../lib64")
-              endif()
-
-              # Always allow colocated runtime resolution for custom layouts
-              list(APPEND DEFAULT_RPATHS "@executable_path")
-            else()
-              list(APPEND DEFAULT_RPATHS "@loader_path")
-            endif()
-          else() # Linux/Unix
-            if(TARGET_TYPE STREQUAL "EXECUTABLE")
-              set(_tip_rel_path "")
-              _tip_compute_relative_install_path(_tip_rel_path "${_tip_runtime_destination}" "${_tip_library_destination}")
-
-              if(_tip_rel_path)
-                cmake_path(IS_ABSOLUTE _tip_rel_path _tip_rel_abs)
-                if(_tip_rel_abs)
-                  list(APPEND DEFAULT_RPATHS "${_tip_rel_path}")
-                elseif(_tip_rel_path STREQUAL "." OR _tip_rel_path STREQUAL "./")
-                  list(APPEND DEFAULT_RPATHS "\$ORIGIN")
-                else()
-                  string(REGEX REPLACE "^\\./" "" _tip_rel_path_clean "${_tip_rel_path}")
-                  list(APPEND DEFAULT_RPATHS "\$ORIGIN/${_tip_rel_path_clean}")
-                endif()
-              else()
-                list(APPEND DEFAULT_RPATHS "\$ORIGIN/../lib" "\$ORIGIN/../lib64")
-              endif()
-
-              # Allow executables to resolve libraries placed alongside them (plugins, tests, etc.)
-              list(APPEND DEFAULT_RPATHS "\$ORIGIN")
-            else()
-              list(APPEND DEFAULT_RPATHS "\$ORIGIN")
-            endif()
-          endif()
-
-          list(FILTER DEFAULT_RPATHS EXCLUDE REGEX "^$")
-          list(REMOVE_DUPLICATES DEFAULT_RPATHS)
+          _tip_load_feature_module(tip_rpath)
+          _tip_compute_default_install_rpaths(DEFAULT_RPATHS "${TARGET_TYPE}")
 
           if(DEFAULT_RPATHS)
             set_target_properties(${TARGET_NAME} PROPERTIES INSTALL_RPATH "${DEFAULT_RPATHS}")
@@ -2085,15 +2279,19 @@ function(finalize_package)
       endif()
     endif()
 
+    if(_tip_install_link_mode OR INSTALL_MANIFEST)
+      _tip_add_target_pre_install_rules(${TARGET_NAME})
+    endif()
+
     # Execute single install with prefix-based component names
     install(${INSTALL_ARGS})
 
     # Install additional files associated with this target
-    get_property(TARGET_ADDITIONAL_FILES GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_TARGET_${TARGET_NAME}_ADDITIONAL_FILES")
+    set(TARGET_ADDITIONAL_FILES ${_tip_target_${TARGET_NAME}_ADDITIONAL_FILES})
     if(TARGET_ADDITIONAL_FILES)
-      get_property(TARGET_ADDITIONAL_FILES_DESTINATION GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_TARGET_${TARGET_NAME}_ADDITIONAL_FILES_DESTINATION")
-      get_property(TARGET_ADDITIONAL_FILES_SOURCE_DIR GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_TARGET_${TARGET_NAME}_ADDITIONAL_FILES_SOURCE_DIR")
-      get_property(TARGET_ADDITIONAL_FILES_COMPONENTS GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_TARGET_${TARGET_NAME}_ADDITIONAL_FILES_COMPONENTS")
+      set(TARGET_ADDITIONAL_FILES_DESTINATION "${_tip_target_${TARGET_NAME}_ADDITIONAL_FILES_DESTINATION}")
+      set(TARGET_ADDITIONAL_FILES_SOURCE_DIR "${_tip_target_${TARGET_NAME}_ADDITIONAL_FILES_SOURCE_DIR}")
+      set(TARGET_ADDITIONAL_FILES_COMPONENTS ${_tip_target_${TARGET_NAME}_ADDITIONAL_FILES_COMPONENTS})
 
       if(NOT TARGET_ADDITIONAL_FILES_DESTINATION)
         # Install to the install prefix root by default Using '.' ensures DESTINATION resolves to ${CMAKE_INSTALL_PREFIX}
@@ -2106,37 +2304,10 @@ function(finalize_package)
         endif()
       endif()
 
-      foreach(FILE_PATH IN LISTS TARGET_ADDITIONAL_FILES)
-        cmake_path(
-          ABSOLUTE_PATH
-          FILE_PATH
-          BASE_DIRECTORY
-          "${TARGET_ADDITIONAL_FILES_SOURCE_DIR}"
-          NORMALIZE
-          OUTPUT_VARIABLE
-          SRC_FILE_PATH)
-
-        if(NOT EXISTS "${SRC_FILE_PATH}")
-          project_log(FATAL_ERROR "  Additional file to install not found for '${TARGET_NAME}': ${SRC_FILE_PATH}")
-        endif()
-
-        set(TARGET_ADDITIONAL_FILES_DEST_PATH "${TARGET_ADDITIONAL_FILES_DESTINATION}")
-
-        if(TARGET_ADDITIONAL_FILES_COMPONENTS)
-          foreach(_tip_additional_file_component IN LISTS TARGET_ADDITIONAL_FILES_COMPONENTS)
-            install(
-              FILES "${SRC_FILE_PATH}"
-              DESTINATION "${TARGET_ADDITIONAL_FILES_DEST_PATH}"
-              COMPONENT "${_tip_additional_file_component}")
-          endforeach()
-        else()
-          install(
-            FILES "${SRC_FILE_PATH}"
-            DESTINATION "${TARGET_ADDITIONAL_FILES_DEST_PATH}"
-            ${TARGET_DEV_COMPONENT_ARGS})
-        endif()
-        project_log(DEBUG "  Installing additional file for '${TARGET_NAME}': ${SRC_FILE_PATH} -> ${TARGET_ADDITIONAL_FILES_DEST_PATH}")
-      endforeach()
+      _tip_install_additional_files(${TARGET_NAME})
+    endif()
+    if(TIP_PROFILE)
+      _tip_profile_end()
     endif()
   endforeach()
 
@@ -2149,244 +2320,44 @@ function(finalize_package)
   endif()
   list(REMOVE_DUPLICATES CONFIG_COMPONENTS)
   list(GET CONFIG_COMPONENTS 0 FIRST_CONFIG_COMPONENT)
+  _tip_register_shared_install_components(${CONFIG_COMPONENTS})
   set(CONFIG_COMPONENT_ARGS COMPONENT ${FIRST_CONFIG_COMPONENT})
 
   # Install targets export file with config component CMake automatically handles configuration-specific exports
-  foreach(_tip_config_component IN LISTS CONFIG_COMPONENTS)
-    install(
-      EXPORT ${ARG_EXPORT_NAME}
-      FILE ${ARG_EXPORT_NAME}Targets.cmake
-      NAMESPACE ${NAMESPACE}
-      DESTINATION ${CMAKE_CONFIG_DESTINATION}
-      COMPONENT "${_tip_config_component}")
-  endforeach()
-
-  if(CPS_ENABLED)
-    if(CMAKE_VERSION VERSION_LESS "4.3")
-      project_log(FATAL_ERROR "CPS package metadata requires CMake 4.3 or newer because it uses install(PACKAGE_INFO).")
-    endif()
-
-    set(_tip_cps_explicit_version "")
-    if(CPS_VERSION_EXPLICIT)
-      set(_tip_cps_explicit_version "${CPS_VERSION}")
-    endif()
-
-    if("${CPS_PACKAGE_NAME}" STREQUAL "")
-      set(CPS_PACKAGE_NAME "${ARG_EXPORT_NAME}")
-    endif()
-
-    set(_tip_cps_effective_version "${CPS_VERSION}")
-    if("${_tip_cps_effective_version}" STREQUAL "")
-      if(VERSION_EXPLICIT OR "${CPS_PROJECT}" STREQUAL "")
-        set(_tip_cps_effective_version "${VERSION}")
-      elseif(NOT "${CPS_COMPAT_VERSION}" STREQUAL "" OR NOT "${CPS_VERSION_SCHEMA}" STREQUAL "")
-        set(_tip_cps_project_version_var "${CPS_PROJECT}_VERSION")
-        if(DEFINED ${_tip_cps_project_version_var} AND NOT "${${_tip_cps_project_version_var}}" STREQUAL "")
-          set(_tip_cps_effective_version "${${_tip_cps_project_version_var}}")
-        else()
-          project_log(FATAL_ERROR "CPS_COMPAT_VERSION or CPS_VERSION_SCHEMA for export '${ARG_EXPORT_NAME}' requires explicit CPS_VERSION/VERSION or a CPS_PROJECT with version metadata.")
-        endif()
-      endif()
-    endif()
-
-    if(NOT "${CPS_PROJECT}" STREQUAL "" AND CPS_NO_PROJECT_METADATA)
-      project_log(FATAL_ERROR "CPS_PROJECT and CPS_NO_PROJECT_METADATA cannot be used together for export '${ARG_EXPORT_NAME}'.")
-    endif()
-
-    if(NOT "${CPS_APPENDIX}" STREQUAL "")
-      set(_tip_cps_appendix_forbidden "")
-      foreach(
-        _tip_cps_appendix_option IN
-        ITEMS CPS_PROJECT
-              CPS_VERSION
-              CPS_COMPAT_VERSION
-              CPS_VERSION_SCHEMA
-              CPS_DEFAULT_TARGETS
-              CPS_DEFAULT_CONFIGURATIONS
-              CPS_LICENSE
-              CPS_DESCRIPTION
-              CPS_HOMEPAGE_URL)
-        set(_tip_cps_appendix_value "${${_tip_cps_appendix_option}}")
-
-        if(NOT "${_tip_cps_appendix_value}" STREQUAL "")
-          list(APPEND _tip_cps_appendix_forbidden "${_tip_cps_appendix_option}")
-        endif()
+  if(SHARD_BY_COMPONENT)
+    foreach(_tip_shard_export_set IN LISTS _tip_shard_order)
+      _tip_component_shard_file(_tip_shard_file "${ARG_EXPORT_NAME}" "${_tip_shard_export_set}")
+      foreach(_tip_config_component IN LISTS CONFIG_COMPONENTS)
+        install(
+          EXPORT ${_tip_shard_export_set}
+          FILE ${_tip_shard_file}
+          NAMESPACE ${NAMESPACE}
+          DESTINATION ${CMAKE_CONFIG_DESTINATION}
+          COMPONENT "${_tip_config_component}")
       endforeach()
-
-      if(_tip_cps_appendix_forbidden)
-        project_log(FATAL_ERROR "CPS_APPENDIX cannot be combined with export-level CPS options for export '${ARG_EXPORT_NAME}': ${_tip_cps_appendix_forbidden}")
-      endif()
-    endif()
-
-    set(_tip_cps_args PACKAGE_INFO "${CPS_PACKAGE_NAME}" EXPORT "${ARG_EXPORT_NAME}")
-
-    if(NOT "${CPS_PROJECT}" STREQUAL "")
-      list(APPEND _tip_cps_args PROJECT "${CPS_PROJECT}")
-    elseif(CPS_NO_PROJECT_METADATA)
-      list(APPEND _tip_cps_args NO_PROJECT_METADATA)
-    endif()
-
-    if(NOT "${CPS_APPENDIX}" STREQUAL "")
-      list(APPEND _tip_cps_args APPENDIX "${CPS_APPENDIX}")
-    endif()
-    if(NOT "${CPS_DESTINATION}" STREQUAL "")
-      list(APPEND _tip_cps_args DESTINATION "${CPS_DESTINATION}")
-    endif()
-    if(CPS_LOWER_CASE_FILE)
-      list(APPEND _tip_cps_args LOWER_CASE_FILE)
-    endif()
-
-    if("${CPS_APPENDIX}" STREQUAL "")
-      if(NOT "${_tip_cps_effective_version}" STREQUAL "")
-        list(APPEND _tip_cps_args VERSION "${_tip_cps_effective_version}")
-
-        set(_tip_cps_effective_compat_version "${CPS_COMPAT_VERSION}")
-        if("${_tip_cps_effective_compat_version}" STREQUAL "")
-          _tip_derive_cps_compat_version(_tip_cps_effective_compat_version "${_tip_cps_effective_version}" "${COMPATIBILITY}" "${CPS_VERSION_SCHEMA}")
-          if(COMPATIBILITY STREQUAL "SamePatchVersion" OR COMPATIBILITY STREQUAL "ExactVersion")
-            project_log(
-              WARNING
-              "CPS cannot represent COMPATIBILITY '${COMPATIBILITY}' exactly for export '${ARG_EXPORT_NAME}'. Omitting COMPAT_VERSION makes CPS require the package version. Set CPS_COMPAT_VERSION explicitly to override this stricter behavior."
-            )
-          endif()
-        endif()
-        if(NOT "${_tip_cps_effective_compat_version}" STREQUAL "")
-          list(APPEND _tip_cps_args COMPAT_VERSION "${_tip_cps_effective_compat_version}")
-        endif()
-
-        if(NOT "${CPS_VERSION_SCHEMA}" STREQUAL "")
-          list(APPEND _tip_cps_args VERSION_SCHEMA "${CPS_VERSION_SCHEMA}")
-        endif()
-      endif()
-
-      set(_tip_cps_effective_default_targets ${CPS_DEFAULT_TARGETS})
-      list(LENGTH _tip_cps_effective_default_targets _tip_cps_effective_default_target_count)
-      if(_tip_cps_effective_default_target_count EQUAL 0)
-        set(_tip_cps_effective_default_targets ${_tip_cps_default_target_names})
-        list(REMOVE_DUPLICATES _tip_cps_effective_default_targets)
-        list(LENGTH _tip_cps_effective_default_targets _tip_cps_effective_default_target_count)
-      endif()
-      if(_tip_cps_effective_default_target_count GREATER 0)
-        foreach(_tip_cps_default_target IN LISTS _tip_cps_effective_default_targets)
-          if(NOT _tip_cps_default_target IN_LIST _tip_cps_exported_target_names)
-            project_log(FATAL_ERROR "CPS_DEFAULT_TARGETS entry '${_tip_cps_default_target}' is not an exported target name for export '${ARG_EXPORT_NAME}'.")
-          endif()
-        endforeach()
-        list(APPEND _tip_cps_args DEFAULT_TARGETS ${_tip_cps_effective_default_targets})
-      endif()
-
-      if(NOT "${CPS_DEFAULT_CONFIGURATIONS}" STREQUAL "")
-        list(APPEND _tip_cps_args DEFAULT_CONFIGURATIONS ${CPS_DEFAULT_CONFIGURATIONS})
-      endif()
-    endif()
-
-    if(NOT "${CPS_LICENSE}" STREQUAL "")
-      list(APPEND _tip_cps_args LICENSE "${CPS_LICENSE}")
-    endif()
-    if(NOT "${CPS_DEFAULT_LICENSE}" STREQUAL "")
-      list(APPEND _tip_cps_args DEFAULT_LICENSE "${CPS_DEFAULT_LICENSE}")
-    endif()
-    if(NOT "${CPS_DESCRIPTION}" STREQUAL "")
-      list(APPEND _tip_cps_args DESCRIPTION "${CPS_DESCRIPTION}")
-    endif()
-    if(NOT "${CPS_HOMEPAGE_URL}" STREQUAL "")
-      list(APPEND _tip_cps_args HOMEPAGE_URL "${CPS_HOMEPAGE_URL}")
-    endif()
-    if(NOT "${CPS_PERMISSIONS}" STREQUAL "")
-      list(APPEND _tip_cps_args PERMISSIONS ${CPS_PERMISSIONS})
-    endif()
-    if(NOT "${CPS_CONFIGURATIONS}" STREQUAL "")
-      list(APPEND _tip_cps_args CONFIGURATIONS ${CPS_CONFIGURATIONS})
-    endif()
-    if(NOT "${CPS_CXX_MODULES_DIRECTORY}" STREQUAL "")
-      list(APPEND _tip_cps_args CXX_MODULES_DIRECTORY "${CPS_CXX_MODULES_DIRECTORY}")
-    endif()
-    if(NOT "${CPS_COMPONENT}" STREQUAL "")
-      list(APPEND _tip_cps_args COMPONENT "${CPS_COMPONENT}")
-    else()
-      list(APPEND _tip_cps_args ${CONFIG_COMPONENT_ARGS})
-    endif()
-    if(CPS_EXCLUDE_FROM_ALL)
-      list(APPEND _tip_cps_args EXCLUDE_FROM_ALL)
-    endif()
-
-    install(${_tip_cps_args})
-    project_log(STATUS "CPS package '${CPS_PACKAGE_NAME}' is ready for export '${ARG_EXPORT_NAME}'")
-  endif()
-
-  # Create package version file using CMake's canonical ConfigVersion naming. Keep the historical -config-version alias for compatibility with existing installs/tests.
-  set(VERSION_FILENAME "${ARG_EXPORT_NAME}ConfigVersion.cmake")
-  set(VERSION_FILE_PATH "${CURRENT_BINARY_DIR}/${VERSION_FILENAME}")
-  set(LEGACY_VERSION_FILENAME "${ARG_EXPORT_NAME}-config-version.cmake")
-  set(LEGACY_VERSION_FILE_PATH "${CURRENT_BINARY_DIR}/${LEGACY_VERSION_FILENAME}")
-
-  set(_tip_version_file_args "${VERSION_FILE_PATH}" VERSION ${VERSION} COMPATIBILITY ${COMPATIBILITY})
-  if(ARCH_INDEPENDENT)
-    list(APPEND _tip_version_file_args ARCH_INDEPENDENT)
-  endif()
-  write_basic_package_version_file(${_tip_version_file_args})
-
-  if(NOT VERSION_FILENAME STREQUAL LEGACY_VERSION_FILENAME)
-    configure_file("${VERSION_FILE_PATH}" "${LEGACY_VERSION_FILE_PATH}" COPYONLY)
-  endif()
-
-  # Prepare public dependencies content
-  set(PACKAGE_PUBLIC_DEPENDENCIES_CONTENT "")
-  set(_tip_package_public_content_required FALSE)
-  if(_tip_export_has_source_sets)
-    set(_tip_package_public_content_required TRUE)
-    string(APPEND PACKAGE_PUBLIC_DEPENDENCIES_CONTENT
-           "if(CMAKE_VERSION VERSION_LESS \"4.4\")\n  message(FATAL_ERROR \"Package '${ARG_EXPORT_NAME}' contains SOURCES file sets and requires CMake 4.4 or newer.\")\nendif()\n")
-  endif()
-  if(PUBLIC_DEPENDENCIES)
-    set(_tip_package_public_content_required TRUE)
-    foreach(dep ${PUBLIC_DEPENDENCIES})
-      string(APPEND PACKAGE_PUBLIC_DEPENDENCIES_CONTENT "find_dependency(${dep})\n")
     endforeach()
-    project_log(VERBOSE "Public dependencies for export '${ARG_EXPORT_NAME}':\n${PACKAGE_PUBLIC_DEPENDENCIES_CONTENT}")
-  endif()
-
-  # Prepare component dependencies content for template substitution
-  set(PACKAGE_COMPONENT_DEPENDENCIES_CONTENT "")
-  set(_tip_find_package_components ${ALL_UNIQUE_COMPONENTS} ${COMPONENT_DEPENDENCY_COMPONENTS})
-  foreach(TARGET_NAME IN LISTS TARGETS)
-    get_property(_tip_target_component_explicit GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_TARGET_${TARGET_NAME}_COMPONENT_EXPLICIT")
-    if(_tip_target_component_explicit)
-      get_property(_tip_target_runtime_component GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_TARGET_${TARGET_NAME}_RUNTIME_COMPONENT")
-      list(APPEND _tip_find_package_components "${_tip_target_runtime_component}")
-    endif()
-  endforeach()
-  if(_tip_find_package_components)
-    list(REMOVE_DUPLICATES _tip_find_package_components)
-    set(_tip_known_find_components "")
-    foreach(component_name ${_tip_find_package_components})
-      _tip_component_dependency_property_name(_tip_component_property "${EXPORT_PROPERTY_PREFIX}" "${component_name}")
-      get_property(component_deps GLOBAL PROPERTY "${_tip_component_property}")
-      list(APPEND _tip_known_find_components "${component_name}")
-      string(APPEND PACKAGE_COMPONENT_DEPENDENCIES_CONTENT "if(\"${component_name}\" IN_LIST ${ARG_EXPORT_NAME}_FIND_COMPONENTS)\n")
-      string(APPEND PACKAGE_COMPONENT_DEPENDENCIES_CONTENT "  set(${ARG_EXPORT_NAME}_${component_name}_FOUND TRUE)\n")
-
-      set(_tip_component_dep_list ${component_deps})
-      foreach(component_dep IN LISTS _tip_component_dep_list)
-        _tip_find_package_expression_package_name(_tip_component_dep_package_name "${component_dep}")
-        _tip_find_package_expression_without_required(_tip_component_dep_optional_expression "${component_dep}")
-        string(APPEND PACKAGE_COMPONENT_DEPENDENCIES_CONTENT "  if(${ARG_EXPORT_NAME}_FIND_REQUIRED_${component_name})\n")
-        string(APPEND PACKAGE_COMPONENT_DEPENDENCIES_CONTENT "    find_dependency(${component_dep})\n")
-        string(APPEND PACKAGE_COMPONENT_DEPENDENCIES_CONTENT "  else()\n")
-        string(APPEND PACKAGE_COMPONENT_DEPENDENCIES_CONTENT "    find_package(${_tip_component_dep_optional_expression} QUIET)\n")
-        string(APPEND PACKAGE_COMPONENT_DEPENDENCIES_CONTENT "    if(NOT ${_tip_component_dep_package_name}_FOUND)\n")
-        string(APPEND PACKAGE_COMPONENT_DEPENDENCIES_CONTENT "      set(${ARG_EXPORT_NAME}_${component_name}_FOUND FALSE)\n")
-        string(APPEND PACKAGE_COMPONENT_DEPENDENCIES_CONTENT "    endif()\n")
-        string(APPEND PACKAGE_COMPONENT_DEPENDENCIES_CONTENT "  endif()\n")
-      endforeach()
-
-      string(APPEND PACKAGE_COMPONENT_DEPENDENCIES_CONTENT "endif()\n")
+    # <Export>Targets.cmake becomes the loader that picks the shards for the requested components
+    _tip_write_component_shard_loader("${CURRENT_BINARY_DIR}/${ARG_EXPORT_NAME}Targets.cmake" "${ARG_EXPORT_NAME}")
+    foreach(_tip_config_component IN LISTS CONFIG_COMPONENTS)
+      install(
+        FILES "${CURRENT_BINARY_DIR}/${ARG_EXPORT_NAME}Targets.cmake"
+        DESTINATION ${CMAKE_CONFIG_DESTINATION}
+        COMPONENT "${_tip_config_component}")
+    endforeach()
+  else()
+    foreach(_tip_config_component IN LISTS CONFIG_COMPONENTS)
+      install(
+        EXPORT ${ARG_EXPORT_NAME}
+        FILE ${ARG_EXPORT_NAME}Targets.cmake
+        NAMESPACE ${NAMESPACE}
+        DESTINATION ${CMAKE_CONFIG_DESTINATION}
+        COMPONENT "${_tip_config_component}")
     endforeach()
+  endif()
 
-    if(_tip_known_find_components)
-      list(REMOVE_DUPLICATES _tip_known_find_components)
-      project_log(VERBOSE "Component dependencies for export '${ARG_EXPORT_NAME}' apply to find_package components: ${_tip_known_find_components}")
-    endif()
+  if(CPS_ENABLED)
+    _tip_load_feature_module(tip_cps)
+    _tip_install_cps_package_info()
   endif()
 
   # Store component information for config template
@@ -2409,7 +2380,11 @@ function(finalize_package)
     endif()
   endif()
 
-  # Fallback to the packaged generic template.
+  # CPS_PRIMARY exports get the thin config that defers to the .cps file, the others the packaged generic template.
+  if(NOT CONFIG_TEMPLATE_TO_USE AND CPS_ENABLED AND CPS_PRIMARY)
+    _tip_find_target_install_package_resource_file("cps-primary-config.cmake.in" CONFIG_TEMPLATE_TO_USE)
+    project_log(DEBUG "  Using CPS primary config template: ${CONFIG_TEMPLATE_TO_USE}")
+  endif()
   if(NOT CONFIG_TEMPLATE_TO_USE)
     _tip_find_target_install_package_resource_file("generic-config.cmake.in" CONFIG_TEMPLATE_TO_USE)
     project_log(DEBUG "  Using generic config template: ${CONFIG_TEMPLATE_TO_USE}")
@@ -2417,6 +2392,7 @@ function(finalize_package)
 
   # Prepare CMake files to include on find_package
   set(PACKAGE_INCLUDE_ON_FIND_PACKAGE "")
+  set(_tip_include_on_find_package_files "")
   if(INCLUDE_ON_FIND_PACKAGE)
     project_log(DEBUG "Processing CMake files to include on find_package for export '${ARG_EXPORT_NAME}':")
     foreach(cmake_file ${INCLUDE_ON_FIND_PACKAGE})
@@ -2432,6 +2408,7 @@ function(finalize_package)
       endif()
 
       get_filename_component(file_name "${cmake_file}" NAME)
+      list(APPEND _tip_include_on_find_package_files "${SRC_CMAKE_FILE}")
 
       foreach(_tip_config_component IN LISTS CONFIG_COMPONENTS)
         install(
@@ -2440,29 +2417,122 @@ function(finalize_package)
           COMPONENT "${_tip_config_component}")
       endforeach()
 
-      string(APPEND PACKAGE_INCLUDE_ON_FIND_PACKAGE "include(\"\${CMAKE_CURRENT_LIST_DIR}/${file_name}\")\n")
+      _tip_find_package_profile_wrap(_tip_include_call "${ARG_EXPORT_NAME}" "" "include_${file_name}" "include(${file_name})" "include(\"\${CMAKE_CURRENT_LIST_DIR}/${file_name}\")\n")
+      string(APPEND PACKAGE_INCLUDE_ON_FIND_PACKAGE "${_tip_include_call}")
     endforeach()
   endif()
 
-  # Validate template contains required placeholders for provided parameters
-  _validate_config_template_placeholders("${CONFIG_TEMPLATE_TO_USE}" "${ARG_EXPORT_NAME}" "${INCLUDE_ON_FIND_PACKAGE}" "${_tip_package_public_content_required}" "${_tip_find_package_components}")
+  # Package version file using CMake's canonical ConfigVersion naming. Keep the historical -config-version alias for compatibility with existing installs/tests.
+  set(VERSION_FILENAME "${ARG_EXPORT_NAME}ConfigVersion.cmake")
+  set(VERSION_FILE_PATH "${CURRENT_BINARY_DIR}/${VERSION_FILENAME}")
+  set(LEGACY_VERSION_FILENAME "${ARG_EXPORT_NAME}-config-version.cmake")
+  set(LEGACY_VERSION_FILE_PATH "${CURRENT_BINARY_DIR}/${LEGACY_VERSION_FILENAME}")
 
   # Generate correct config filename following CMake conventions Use <PackageName>Config.cmake format (exact case + "Config.cmake")
   set(CONFIG_FILENAME "${ARG_EXPORT_NAME}Config.cmake")
 
-  # Configure and generate package config file using correct filename
-  configure_package_config_file(
-    "${CONFIG_TEMPLATE_TO_USE}" "${CURRENT_BINARY_DIR}/${CONFIG_FILENAME}"
-    INSTALL_DESTINATION ${CMAKE_CONFIG_DESTINATION}
-    PATH_VARS CMAKE_INSTALL_PREFIX)
+  # Keep the files of the previous configure when the stamp of their inputs still matches
+  file(READ "${CONFIG_TEMPLATE_TO_USE}" _tip_config_template_content)
+  _tip_package_files_stamp(_tip_package_files_stamp "${_tip_config_template_content}")
+  set(_tip_package_files_stamp_file "${CURRENT_BINARY_DIR}/CMakeFiles/${ARG_EXPORT_NAME}-package-files.sha256")
+  set(_tip_package_files_previous_stamp "")
+  if(EXISTS "${_tip_package_files_stamp_file}"
+     AND EXISTS "${CURRENT_BINARY_DIR}/${CONFIG_FILENAME}"
+     AND EXISTS "${VERSION_FILE_PATH}"
+     AND EXISTS "${LEGACY_VERSION_FILE_PATH}")
+    file(READ "${_tip_package_files_stamp_file}" _tip_package_files_previous_stamp)
+  endif()
+
+  if(_tip_package_files_stamp STREQUAL _tip_package_files_previous_stamp)
+    # configure_package_config_file() would have made the template a configure dependency
+    set_property(
+      DIRECTORY
+      APPEND
+      PROPERTY CMAKE_CONFIGURE_DEPENDS "${CONFIG_TEMPLATE_TO_USE}")
+    project_log(DEBUG "  Config and version files for export '${ARG_EXPORT_NAME}' are up to date, skipping regeneration")
+  else()
+    _tip_package_dependency_content("${CMAKE_CONFIG_DESTINATION}")
+
+    set(_tip_version_file_args "${VERSION_FILE_PATH}" VERSION ${VERSION} COMPATIBILITY ${COMPATIBILITY})
+    if(ARCH_INDEPENDENT)
+      list(APPEND _tip_version_file_args ARCH_INDEPENDENT)
+    endif()
+    write_basic_package_version_file(${_tip_version_file_args})
+
+    if(NOT VERSION_FILENAME STREQUAL LEGACY_VERSION_FILENAME)
+      configure_file("${VERSION_FILE_PATH}" "${LEGACY_VERSION_FILE_PATH}" COPYONLY)
+    endif()
+
+    # Validate template contains required placeholders for provided parameters
+    _validate_config_template_placeholders("${CONFIG_TEMPLATE_TO_USE}" "${ARG_EXPORT_NAME}" "${INCLUDE_ON_FIND_PACKAGE}" "${_tip_package_public_content_required}" "${_tip_find_package_components}")
+
+    # Configure and generate package config file using correct filename
+    configure_package_config_file(
+      "${CONFIG_TEMPLATE_TO_USE}" "${CURRENT_BINARY_DIR}/${CONFIG_FILENAME}"
+      INSTALL_DESTINATION ${CMAKE_CONFIG_DESTINATION}
+      PATH_VARS CMAKE_INSTALL_PREFIX)
+
+    file(WRITE "${_tip_package_files_stamp_file}" "${_tip_package_files_stamp}")
+  endif()
 
-  # Install config files using correct filename with config component
+  # Install config files using correct filename with config component. The find_package() profiling helpers go next
+  # to a config whose template includes them (the generic one does) when the consumer sets TIP_PROFILE_FIND_PACKAGE.
+  set(_tip_find_package_profile_file "")
+  string(FIND "${_tip_config_template_content}" "tip_find_package_profile.cmake" _tip_find_package_profile_index)
+  if(NOT _tip_find_package_profile_index EQUAL -1)
+    _tip_find_target_install_package_resource_file("tip_find_package_profile.cmake" _tip_find_package_profile_file)
+  endif()
   foreach(_tip_config_component IN LISTS CONFIG_COMPONENTS)
     install(
-      FILES "${CURRENT_BINARY_DIR}/${CONFIG_FILENAME}" "${VERSION_FILE_PATH}" "${LEGACY_VERSION_FILE_PATH}"
+      FILES "${CURRENT_BINARY_DIR}/${CONFIG_FILENAME}" "${VERSION_FILE_PATH}" "${LEGACY_VERSION_FILE_PATH}" ${_tip_find_package_profile_file}
       DESTINATION ${CMAKE_CONFIG_DESTINATION}
       COMPONENT "${_tip_config_component}")
   endforeach()
+  set_property(GLOBAL APPEND PROPERTY _TIP_PACKAGE_INDEX_EXPORTS "${ARG_EXPORT_NAME}")
+  set_property(GLOBAL PROPERTY "_TIP_PACKAGE_INDEX_${ARG_EXPORT_NAME}" "${CMAKE_CONFIG_DESTINATION}" "${VERSION}" ${CONFIG_COMPONENTS})
+
+  # The installed config is rewritten with the installed targets files inlined once they are in place
+  if(FLATTEN_CONFIG)
+    _tip_load_feature_module(tip_flatten_config)
+    _tip_find_target_install_package_resource_file("tip_flatten_config.cmake" _tip_flatten_script)
+    file(READ "${CURRENT_BINARY_DIR}/${CONFIG_FILENAME}" _tip_generated_config)
+    _tip_find_flatten_targets_include(_tip_targets_include "${_tip_generated_config}" "${ARG_EXPORT_NAME}")
+    if(NOT _tip_targets_include)
+      project_log(FATAL_ERROR "FLATTEN_CONFIG requires the config template of export '${ARG_EXPORT_NAME}' to include "
+                              "\"\${CMAKE_CURRENT_LIST_DIR}/${ARG_EXPORT_NAME}Targets.cmake\": ${CONFIG_TEMPLATE_TO_USE}")
+    endif()
+    string(
+      CONCAT
+      _tip_flatten_code
+      "if(NOT COMMAND _tip_flatten_installed_package_config)\n"
+      "  include(\"${_tip_flatten_script}\")\n"
+      "endif()\n"
+      "_tip_flatten_installed_package_config(EXPORT_NAME \"${ARG_EXPORT_NAME}\" SOURCE_CONFIG \"${CURRENT_BINARY_DIR}/${CONFIG_FILENAME}\" DESTINATION \"${CMAKE_CONFIG_DESTINATION}\")\n")
+    foreach(_tip_config_component IN LISTS CONFIG_COMPONENTS)
+      install(CODE "${_tip_flatten_code}" COMPONENT "${_tip_config_component}")
+    endforeach()
+    project_log(DEBUG "  Installed config for export '${ARG_EXPORT_NAME}' will be flattened")
+  endif()
+
+  if(INSTALL_MANIFEST)
+    install(
+      CODE "${_tip_manifest_include}_tip_write_install_manifest(EXPORT [==[${ARG_EXPORT_NAME}]==] STATE_DIR [==[${CURRENT_BINARY_DIR}/CMakeFiles/tip-install-state]==] DESTINATION [==[${CMAKE_CONFIG_DESTINATION}]==])\n"
+      ALL_COMPONENTS)
+  endif()
+
+  if(_tip_content_store)
+    _tip_add_content_store_rule()
+  endif()
+
+  if(BUILD_TREE_EXPORT)
+    _tip_load_feature_module(tip_build_tree_export)
+    _tip_export_build_tree_package()
+  endif()
+
+  if(HEADER_COST_REPORT)
+    _tip_load_feature_module(tip_header_cost)
+    _tip_add_header_cost_target()
+  endif()
 
   # Log package status with component information
   if(ALL_UNIQUE_COMPONENTS)
@@ -2480,13 +2550,180 @@ function(finalize_package)
     project_log(VERBOSE "Install specific component: cmake --install <build_dir> --component <component_name>")
   endif()
 
-  # Mark this export as finalized
+  # Mark this export as finalized. The record is kept because SBOM finalization reads its metadata afterwards.
   set_property(GLOBAL PROPERTY "_CMAKE_PACKAGE_EXPORT_${ARG_EXPORT_NAME}_FINALIZED" TRUE)
-
-  # Clean up global properties (optional, but good practice)
-  set_property(GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_TARGETS" "")
+  if(TIP_PROFILE)
+    _tip_profile_end()
+  endif()
 endfunction(finalize_package)
 
+# ~~~
+# Generate the dependency sections of the config of the export being finalized, for a config at CONFIG_DESTINATION.
+# Sets PACKAGE_PUBLIC_DEPENDENCIES_CONTENT, PACKAGE_COMPONENT_DEPENDENCIES_CONTENT, _tip_package_public_content_required
+# and _tip_find_package_components in the calling scope and reads the finalize_package() variables from it.
+# ~~~
+function(_tip_package_dependency_content CONFIG_DESTINATION)
+  # Prepare public dependencies content
+  set(PACKAGE_PUBLIC_DEPENDENCIES_CONTENT "")
+  set(_tip_package_public_content_required FALSE)
+  if(_tip_export_has_source_sets)
+    set(_tip_package_public_content_required TRUE)
+    string(APPEND PACKAGE_PUBLIC_DEPENDENCIES_CONTENT
+           "if(CMAKE_VERSION VERSION_LESS \"4.4\")\n  message(FATAL_ERROR \"Package '${ARG_EXPORT_NAME}' contains SOURCES file sets and requires CMake 4.4 or newer.\")\nendif()\n")
+  endif()
+  if(PUBLIC_DEPENDENCIES)
+    set(_tip_package_public_content_required TRUE)
+    # Each call is skipped when the consumer already found the dependency at a compatible version. With
+    # FLATTEN_DEPENDENCIES the recorded closure is loaded leaf first, so nested configs find their own dependencies
+    # already satisfied instead of walking the chain again.
+    set(_tip_public_dependency_calls ${PUBLIC_DEPENDENCIES})
+    if(FLATTEN_DEPENDENCIES)
+      set(_tip_public_dependency_calls ${TRANSITIVE_DEPENDENCIES} ${PUBLIC_DEPENDENCIES})
+      list(REMOVE_DUPLICATES _tip_public_dependency_calls)
+    endif()
+    foreach(dep ${_tip_public_dependency_calls})
+      _tip_find_dependency_guard(_tip_dependency_guard "${dep}")
+      set(_tip_dep_indent "")
+      if(_tip_dependency_guard)
+        string(APPEND PACKAGE_PUBLIC_DEPENDENCIES_CONTENT "if(${_tip_dependency_guard})\n")
+        set(_tip_dep_indent "  ")
+      endif()
+      if(BAKE_DEPENDENCY_HINTS)
+        _tip_dependency_dir_hint(_tip_dependency_hint "${dep}" "${CONFIG_DESTINATION}" "${_tip_dep_indent}")
+        string(APPEND PACKAGE_PUBLIC_DEPENDENCIES_CONTENT "${_tip_dependency_hint}")
+      endif()
+      _tip_find_package_expression_package_name(_tip_dep_package_name "${dep}")
+      _tip_find_package_profile_wrap(_tip_dependency_call "${ARG_EXPORT_NAME}" "${_tip_dep_indent}" "${_tip_dep_package_name}" "find_dependency(${dep})" "${_tip_dep_indent}find_dependency(${dep})\n")
+      string(APPEND PACKAGE_PUBLIC_DEPENDENCIES_CONTENT "${_tip_dependency_call}")
+      if(_tip_dependency_guard)
+        string(APPEND PACKAGE_PUBLIC_DEPENDENCIES_CONTENT "endif()\n")
+      endif()
+    endforeach()
+    string(APPEND PACKAGE_PUBLIC_DEPENDENCIES_CONTENT "set(${ARG_EXPORT_NAME}_TRANSITIVE_DEPENDENCIES \"${TRANSITIVE_DEPENDENCIES}\")\n")
+    project_log(VERBOSE "Public dependencies for export '${ARG_EXPORT_NAME}':\n${PACKAGE_PUBLIC_DEPENDENCIES_CONTENT}")
+  endif()
+
+  # Prepare component dependencies content for template substitution
+  set(PACKAGE_COMPONENT_DEPENDENCIES_CONTENT "")
+  set(_tip_find_package_components ${ALL_UNIQUE_COMPONENTS} ${COMPONENT_DEPENDENCY_COMPONENTS})
+  foreach(TARGET_NAME IN LISTS TARGETS)
+    if(_tip_target_${TARGET_NAME}_COMPONENT_EXPLICIT OR (SHARD_BY_COMPONENT AND _tip_target_${TARGET_NAME}_COMPONENT))
+      list(APPEND _tip_find_package_components "${_tip_target_${TARGET_NAME}_RUNTIME_COMPONENT}")
+    endif()
+  endforeach()
+  if(_tip_find_package_components)
+    list(REMOVE_DUPLICATES _tip_find_package_components)
+    set(_tip_known_find_components "")
+    foreach(component_name ${_tip_find_package_components})
+      _tip_component_dependency_property_name(_tip_component_property "${EXPORT_PROPERTY_PREFIX}" "${component_name}")
+      get_property(component_deps GLOBAL PROPERTY "${_tip_component_property}")
+      list(APPEND _tip_known_find_components "${component_name}")
+      string(APPEND PACKAGE_COMPONENT_DEPENDENCIES_CONTENT "if(\"${component_name}\" IN_LIST ${ARG_EXPORT_NAME}_FIND_COMPONENTS)\n")
+      string(APPEND PACKAGE_COMPONENT_DEPENDENCIES_CONTENT "  set(${ARG_EXPORT_NAME}_${component_name}_FOUND TRUE)\n")
+
+      set(_tip_component_dep_list ${component_deps})
+      foreach(component_dep IN LISTS _tip_component_dep_list)
+        _tip_find_package_expression_package_name(_tip_component_dep_package_name "${component_dep}")
+        _tip_find_package_expression_without_required(_tip_component_dep_optional_expression "${component_dep}")
+        _tip_find_dependency_guard(_tip_dependency_guard "${component_dep}")
+        set(_tip_dep_indent "  ")
+        if(_tip_dependency_guard)
+          string(APPEND PACKAGE_COMPONENT_DEPENDENCIES_CONTENT "  if(${_tip_dependency_guard})\n")
+          set(_tip_dep_indent "    ")
+        endif()
+        if(BAKE_DEPENDENCY_HINTS)
+          _tip_dependency_dir_hint(_tip_dependency_hint "${component_dep}" "${CONFIG_DESTINATION}" "${_tip_dep_indent}")
+          string(APPEND PACKAGE_COMPONENT_DEPENDENCIES_CONTENT "${_tip_dependency_hint}")
+        endif()
+        string(
+          CONCAT
+          _tip_component_dependency_call
+          "${_tip_dep_indent}if(${ARG_EXPORT_NAME}_FIND_REQUIRED_${component_name})\n"
+          "${_tip_dep_indent}  find_dependency(${component_dep})\n"
+          "${_tip_dep_indent}else()\n"
+          "${_tip_dep_indent}  find_package(${_tip_component_dep_optional_expression} QUIET)\n"
+          "${_tip_dep_indent}  if(NOT ${_tip_component_dep_package_name}_FOUND)\n"
+          "${_tip_dep_indent}    set(${ARG_EXPORT_NAME}_${component_name}_FOUND FALSE)\n"
+          "${_tip_dep_indent}  endif()\n"
+          "${_tip_dep_indent}endif()\n")
+        _tip_find_package_profile_wrap(_tip_component_dependency_call "${ARG_EXPORT_NAME}" "${_tip_dep_indent}" "${component_name}_${_tip_component_dep_package_name}"
+                                       "find_dependency(${component_dep}) for component ${component_name}" "${_tip_component_dependency_call}")
+        string(APPEND PACKAGE_COMPONENT_DEPENDENCIES_CONTENT "${_tip_component_dependency_call}")
+        if(_tip_dependency_guard)
+          string(APPEND PACKAGE_COMPONENT_DEPENDENCIES_CONTENT "  endif()\n")
+        endif()
+      endforeach()
+
+      string(APPEND PACKAGE_COMPONENT_DEPENDENCIES_CONTENT "endif()\n")
+    endforeach()
+
+    if(_tip_known_find_components)
+      list(REMOVE_DUPLICATES _tip_known_find_components)
+      project_log(VERBOSE "Component dependencies for export '${ARG_EXPORT_NAME}' apply to find_package components: ${_tip_known_find_components}")
+    endif()
+  endif()
+
+  foreach(_tip_content_var IN ITEMS PACKAGE_PUBLIC_DEPENDENCIES_CONTENT PACKAGE_COMPONENT_DEPENDENCIES_CONTENT _tip_package_public_content_required _tip_find_package_components)
+    set(${_tip_content_var}
+        "${${_tip_content_var}}"
+        PARENT_SCOPE)
+  endforeach()
+endfunction()
+
+# ~~~
+# Set OUT_VAR to a SHA-256 stamp of every input of the config and version files of the export being finalized, so an
+# unchanged export can keep the files of the previous configure. The stamp covers the export record, the template path
+# and content and the current value of each @VARIABLE@ it references, the component setup, the dependency expressions
+# with the dependency properties and hints they expand to, the install prefix and destination and the CMake version
+# whose generators write the files. Reads the finalize_package() variables from the calling scope.
+# ~~~
+function(_tip_package_files_stamp OUT_VAR TEMPLATE_CONTENT)
+  get_property(_tip_export_record GLOBAL PROPERTY "${EXPORT_PROPERTY_PREFIX}_RECORD")
+  string(SHA256 _tip_template_hash "${TEMPLATE_CONTENT}")
+  set(_tip_inputs
+      "${CMAKE_VERSION}"
+      "${CMAKE_SIZEOF_VOID_P}"
+      "${CMAKE_INSTALL_PREFIX}"
+      "${CMAKE_CONFIG_DESTINATION}"
+      "${_tip_export_record}"
+      "${CONFIG_TEMPLATE_TO_USE}"
+      "${_tip_template_hash}"
+      "${_tip_export_has_source_sets}"
+      "${ALL_UNIQUE_COMPONENTS}")
+
+  string(REGEX MATCHALL "@[A-Za-z0-9_]+@" _tip_template_variables "${TEMPLATE_CONTENT}")
+  list(REMOVE_DUPLICATES _tip_template_variables)
+  foreach(_tip_template_variable IN LISTS _tip_template_variables)
+    string(REPLACE "@" "" _tip_template_variable "${_tip_template_variable}")
+    list(APPEND _tip_inputs "${_tip_template_variable}=${${_tip_template_variable}}")
+  endforeach()
+
+  set(_tip_dependencies ${PUBLIC_DEPENDENCIES} ${TRANSITIVE_DEPENDENCIES})
+  set(_tip_components ${ALL_UNIQUE_COMPONENTS} ${COMPONENT_DEPENDENCY_COMPONENTS})
+  foreach(TARGET_NAME IN LISTS TARGETS)
+    list(APPEND _tip_inputs "${TARGET_NAME}=${_tip_target_${TARGET_NAME}_COMPONENT_EXPLICIT}:${_tip_target_${TARGET_NAME}_COMPONENT}")
+    list(APPEND _tip_components "${_tip_target_${TARGET_NAME}_RUNTIME_COMPONENT}")
+  endforeach()
+  list(REMOVE_DUPLICATES _tip_components)
+  foreach(component_name IN LISTS _tip_components)
+    _tip_component_dependency_property_name(_tip_component_property "${EXPORT_PROPERTY_PREFIX}" "${component_name}")
+    get_property(component_deps GLOBAL PROPERTY "${_tip_component_property}")
+    list(APPEND _tip_inputs "${component_name}=${component_deps}")
+    list(APPEND _tip_dependencies ${component_deps})
+  endforeach()
+  if(BAKE_DEPENDENCY_HINTS)
+    foreach(dep IN LISTS _tip_dependencies)
+      _tip_find_package_expression_package_name(_tip_dep_package_name "${dep}")
+      list(APPEND _tip_inputs "${_tip_dep_package_name}_DIR=${${_tip_dep_package_name}_DIR}:$CACHE{${_tip_dep_package_name}_DIR}")
+    endforeach()
+  endif()
+
+  string(SHA256 _tip_stamp "${_tip_inputs}")
+  set(${OUT_VAR}
+      "${_tip_stamp}"
+      PARENT_SCOPE)
+endfunction()
+
 # ~~~
 # Helper function to set default values for multiple arguments
 # Takes triplets of: variable_name, default_value, log_description
@@ -2554,8 +2791,46 @@ if(NOT PL_INITIALIZED)
 endif()
 
 # ~~~
-# Internal function that is automatically called at the end of configuration
-# to finalize a single package export that hasn't been explicitly finalized
+# Internal deferred driver, queued once by the first registration, that finalizes every
+# registered export that hasn't been explicitly finalized, in registration order, and then
+# generates the SBOMs, the TIP_PACKAGE_INDEX package index and the parallel install launcher.
+#
+# A registration from a later deferred call schedules the driver again.
+# ~~~
+function(_tip_finalize_registered_exports)
+  set_property(GLOBAL PROPERTY "_TIP_FINALIZATION_SCHEDULED" FALSE)
+
+  get_property(_tip_registered_exports GLOBAL PROPERTY "_CMAKE_PACKAGE_REGISTERED_EXPORTS")
+  foreach(_tip_export_name IN LISTS _tip_registered_exports)
+    get_property(_tip_export_finalized GLOBAL PROPERTY "_CMAKE_PACKAGE_EXPORT_${_tip_export_name}_FINALIZED")
+    if(NOT _tip_export_finalized)
+      project_log(DEBUG "Auto-finalizing export '${_tip_export_name}'")
+      finalize_package(EXPORT_NAME ${_tip_export_name})
+    endif()
+  endforeach()
+
+  get_property(_tip_sbom_group_hashes GLOBAL PROPERTY "_TIP_SBOM_GROUP_HASHES")
+  if(_tip_sbom_group_hashes)
+    _tip_load_feature_module(tip_sbom)
+    _tip_finalize_all_sboms()
+  endif()
+
+  # TIP_PACKAGE_INDEX is read in the top-level directory, where this driver runs
+  if(TIP_PACKAGE_INDEX)
+    _tip_load_feature_module(tip_package_index)
+    _tip_install_package_index("${TIP_PACKAGE_INDEX}")
+  endif()
+
+  get_property(_tip_detected_components GLOBAL PROPERTY "_TIP_DETECTED_COMPONENTS")
+  if(_tip_detected_components)
+    _tip_load_feature_module(tip_parallel_install)
+    _tip_write_parallel_install_launcher()
+  endif()
+endfunction()
+
+# ~~~
+# Internal function that finalizes a single package export that hasn't been explicitly
+# finalized. export_cpack() uses it for exports registered after the deferred driver ran.
 # ~~~
 function(_auto_finalize_single_export EXPORT_NAME)
   # Check if already finalized to avoid duplicate finalization
@@ -0,0 +1,155 @@
+cmake_minimum_required(VERSION 3.25)
+
+# Configure and install time of a package whose ADDITIONAL_FILES are thousands of small data files.
+#
+# Generates a producer with one interface library and N data files spread over directories of TIP_BENCH_FILES_PER_DIR
+# files, and passes them to ADDITIONAL_FILES in each form of TIP_BENCH_FORMS:
+#
+#   list      - every file path, the way a project passes the result of its own file(GLOB_RECURSE)
+#   directory - the data directory with a trailing slash
+#   glob      - the pattern data/*, which matches the subdirectories
+#
+# Each case reports the wall-clock time of configure (no languages are enabled, so it is all generation) and of one
+# install into a fresh prefix, the number of file(INSTALL) calls in the generated install script and its size.
+#
+# cmake -DTIP_REPO_ROOT=<repo> [-DTIP_BENCH_ROOT=<work dir>] [options] -P tests/benchmarks/additional_files_benchmark.cmake
+#
+# Options (all optional):
+#   TIP_BENCH_FILE_COUNTS   - Comma-separated file counts (default: 100,1000,10000,50000)
+#   TIP_BENCH_FILES_PER_DIR - Files per data directory (default: 500)
+#   TIP_BENCH_FORMS         - ADDITIONAL_FILES forms to compare (default: list,directory,glob)
+
+include("${CMAKE_CURRENT_LIST_DIR}/benchmark_helpers.cmake")
+
+if(NOT DEFINED TIP_REPO_ROOT)
+  _tip_bench_fail("TIP_REPO_ROOT is required")
+endif()
+if(NOT DEFINED TIP_BENCH_ROOT)
+  set(TIP_BENCH_ROOT "${CMAKE_CURRENT_BINARY_DIR}/tip-benchmarks")
+endif()
+if(NOT DEFINED TIP_BENCH_FILE_COUNTS)
+  set(TIP_BENCH_FILE_COUNTS "100,1000,10000,50000")
+endif()
+if(NOT DEFINED TIP_BENCH_FILES_PER_DIR)
+  set(TIP_BENCH_FILES_PER_DIR 500)
+endif()
+if(NOT DEFINED TIP_BENCH_FORMS)
+  set(TIP_BENCH_FORMS "list,directory,glob")
+endif()
+if(NOT TIP_BENCH_FILES_PER_DIR MATCHES "^[1-9][0-9]*$")
+  _tip_bench_fail("TIP_BENCH_FILES_PER_DIR must be a positive integer, got '${TIP_BENCH_FILES_PER_DIR}'")
+endif()
+string(REPLACE "," ";" _tip_file_counts "${TIP_BENCH_FILE_COUNTS}")
+string(REPLACE "," ";" _tip_forms "${TIP_BENCH_FORMS}")
+foreach(_tip_form IN LISTS _tip_forms)
+  if(NOT _tip_form MATCHES "^(list|directory|glob)$")
+    _tip_bench_fail("Unknown ADDITIONAL_FILES form '${_tip_form}' in TIP_BENCH_FORMS")
+  endif()
+endforeach()
+
+set(_tip_table "")
+_tip_bench_append_row(
+  _tip_table
+  8
+  files
+  11
+  form
+  14
+  configure_ms
+  12
+  install_ms
+  8
+  rules
+  10
+  script_kb)
+foreach(_tip_file_count IN LISTS _tip_file_counts)
+  if(NOT _tip_file_count MATCHES "^[1-9][0-9]*$")
+    _tip_bench_fail("File counts must be positive integers, got '${_tip_file_count}'")
+  endif()
+  set(_tip_case_root "${TIP_BENCH_ROOT}/additional-files/n${_tip_file_count}")
+  set(_tip_producer_dir "${_tip_case_root}/producer")
+  file(REMOVE_RECURSE "${_tip_case_root}")
+
+  # File names are unique across directories, so the list form can install them into one directory
+  foreach(_tip_index RANGE 1 ${_tip_file_count})
+    math(EXPR _tip_dir_index "${_tip_index} / ${TIP_BENCH_FILES_PER_DIR}")
+    file(WRITE "${_tip_producer_dir}/data/set${_tip_dir_index}/file${_tip_index}.txt" "${_tip_index}\n")
+  endforeach()
+
+  foreach(_tip_form IN LISTS _tip_forms)
+    if(_tip_form STREQUAL "list")
+      set(_tip_additional_files "\${_tip_data_files}")
+    elseif(_tip_form STREQUAL "directory")
+      set(_tip_additional_files "data/")
+    else()
+      set(_tip_additional_files "data/*")
+    endif()
+    file(
+      WRITE "${_tip_producer_dir}/CMakeLists.txt"
+      "cmake_minimum_required(VERSION 3.25)\n"
+      "project(tip_additional_files_producer VERSION 1.0.0 LANGUAGES NONE)\n"
+      "set(TARGET_INSTALL_PACKAGE_DISABLE_INSTALL ON)\n"
+      "include(\"${TIP_REPO_ROOT}/cmake/load_target_install_package.cmake\")\n"
+      "file(GLOB_RECURSE _tip_data_files \"\${CMAKE_CURRENT_SOURCE_DIR}/data/*.txt\")\n"
+      "add_library(tip_bench_data INTERFACE)\n"
+      "target_install_package(tip_bench_data ADDITIONAL_FILES ${_tip_additional_files} ADDITIONAL_FILES_DESTINATION share/tip_bench_data)\n")
+
+    set(_tip_build "${_tip_case_root}/build-${_tip_form}")
+    set(_tip_prefix "${_tip_case_root}/install-${_tip_form}")
+    _tip_bench_run_timed_step(
+      NAME
+      "configure ${_tip_file_count} files as ${_tip_form}"
+      ELAPSED_US_VARIABLE
+      _tip_configure_us
+      COMMAND
+      "${CMAKE_COMMAND}"
+      -S
+      "${_tip_producer_dir}"
+      -B
+      "${_tip_build}")
+    _tip_bench_run_timed_step(
+      NAME
+      "install ${_tip_file_count} files as ${_tip_form}"
+      ELAPSED_US_VARIABLE
+      _tip_install_us
+      COMMAND
+      "${CMAKE_COMMAND}"
+      --install
+      "${_tip_build}"
+      --prefix
+      "${_tip_prefix}")
+
+    file(GLOB_RECURSE _tip_installed_files "${_tip_prefix}/share/tip_bench_data/*")
+    list(LENGTH _tip_installed_files _tip_installed_count)
+    if(NOT _tip_installed_count EQUAL _tip_file_count)
+      _tip_bench_fail("Expected ${_tip_file_count} installed data files for the ${_tip_form} form, found ${_tip_installed_count}")
+    endif()
+    file(READ "${_tip_build}/cmake_install.cmake" _tip_install_script)
+    string(LENGTH "${_tip_install_script}" _tip_script_bytes)
+    math(EXPR _tip_script_kb "${_tip_script_bytes} / 1024")
+    string(REGEX MATCHALL "file\\(INSTALL " _tip_rules "${_tip_install_script}")
+    list(LENGTH _tip_rules _tip_rule_count)
+    unset(_tip_install_script)
+    file(REMOVE_RECURSE "${_tip_build}" "${_tip_prefix}")
+
+    _tip_bench_format_ms(${_tip_configure_us} _tip_configure_ms)
+    _tip_bench_format_ms(${_tip_install_us} _tip_install_ms)
+    _tip_bench_append_row(
+      _tip_table
+      8
+      ${_tip_file_count}
+      11
+      ${_tip_form}
+      14
+      ${_tip_configure_ms}
+      12
+      ${_tip_install_ms}
+      8
+      ${_tip_rule_count}
+      10
+      ${_tip_script_kb})
+  endforeach()
+  file(REMOVE_RECURSE "${_tip_case_root}")
+endforeach()
+
+message(STATUS "[benchmark] ADDITIONAL_FILES configure and install time by file count and form (CMake ${CMAKE_VERSION})\n${_tip_table}")
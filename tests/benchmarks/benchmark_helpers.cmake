@@ -0,0 +1,105 @@
+cmake_minimum_required(VERSION 3.25)
+
+include("${CMAKE_CURRENT_LIST_DIR}/../cmake/proof_helpers.cmake")
+
+function(_tip_bench_fail text)
+  message(FATAL_ERROR "[benchmark] ${text}")
+endfunction()
+
+# Microseconds since the epoch. %f requires CMake 3.23, which is below the repository minimum.
+function(_tip_bench_now_us out_var)
+  string(TIMESTAMP _tip_now "%s%f" UTC)
+  set(${out_var}
+      "${_tip_now}"
+      PARENT_SCOPE)
+endfunction()
+
+# Run a command like _tip_proof_run_step() and report its wall-clock duration in microseconds.
+function(_tip_bench_run_timed_step)
+  set(options "")
+  set(oneValueArgs NAME ELAPSED_US_VARIABLE)
+  set(multiValueArgs COMMAND)
+  cmake_parse_arguments(ARG "${options}" "${oneValueArgs}" "${multiValueArgs}" ${ARGN})
+
+  if(NOT ARG_NAME)
+    _tip_bench_fail("_tip_bench_run_timed_step requires NAME")
+  endif()
+  if(NOT ARG_ELAPSED_US_VARIABLE)
+    _tip_bench_fail("_tip_bench_run_timed_step requires ELAPSED_US_VARIABLE")
+  endif()
+
+  _tip_bench_now_us(_tip_begin)
+  _tip_proof_run_step(NAME "${ARG_NAME}" COMMAND ${ARG_COMMAND})
+  _tip_bench_now_us(_tip_end)
+
+  math(EXPR _tip_elapsed "${_tip_end} - ${_tip_begin}")
+  set(${ARG_ELAPSED_US_VARIABLE}
+      "${_tip_elapsed}"
+      PARENT_SCOPE)
+endfunction()
+
+# Read the "<name>=<microseconds>" lines written by benchmark_phase_markers.cmake into <prefix>_<name> variables.
+function(_tip_bench_read_markers path prefix)
+  _tip_proof_assert_exists("${path}")
+  file(STRINGS "${path}" _tip_marker_lines)
+  set(_tip_marker_names "")
+  foreach(_tip_marker_line IN LISTS _tip_marker_lines)
+    if(NOT _tip_marker_line MATCHES "^([A-Za-z0-9_]+)=([0-9]+)$")
+      _tip_bench_fail("Malformed phase marker '${_tip_marker_line}' in '${path}'")
+    endif()
+    list(APPEND _tip_marker_names "${CMAKE_MATCH_1}")
+    set(${prefix}_${CMAKE_MATCH_1}
+        "${CMAKE_MATCH_2}"
+        PARENT_SCOPE)
+  endforeach()
+  set(${prefix}_MARKERS
+      "${_tip_marker_names}"
+      PARENT_SCOPE)
+endfunction()
+
+# Elapsed microseconds between two markers read by _tip_bench_read_markers().
+function(_tip_bench_marker_span prefix begin_name end_name out_var)
+  if(NOT DEFINED ${prefix}_${begin_name} OR NOT DEFINED ${prefix}_${end_name})
+    _tip_bench_fail("Missing phase marker '${begin_name}' or '${end_name}'; recorded markers: ${${prefix}_MARKERS}")
+  endif()
+  math(EXPR _tip_span "${${prefix}_${end_name}} - ${${prefix}_${begin_name}}")
+  set(${out_var}
+      "${_tip_span}"
+      PARENT_SCOPE)
+endfunction()
+
+# Format microseconds as milliseconds with three decimals.
+function(_tip_bench_format_ms microseconds out_var)
+  math(EXPR _tip_whole "${microseconds} / 1000")
+  math(EXPR _tip_fraction "${microseconds} % 1000")
+  string(LENGTH "${_tip_fraction}" _tip_fraction_length)
+  math(EXPR _tip_padding "3 - ${_tip_fraction_length}")
+  string(REPEAT "0" ${_tip_padding} _tip_zeros)
+  set(${out_var}
+      "${_tip_whole}.${_tip_zeros}${_tip_fraction}"
+      PARENT_SCOPE)
+endfunction()
+
+# Append one right-aligned table row to <out_var>. ARGN alternates "<width> <cell>".
+function(_tip_bench_append_row out_var)
+  set(_tip_row "${${out_var}}")
+  set(_tip_cells ${ARGN})
+  list(LENGTH _tip_cells _tip_cell_count)
+  math(EXPR _tip_last "${_tip_cell_count} - 1")
+  foreach(_tip_index RANGE 0 ${_tip_last} 2)
+    math(EXPR _tip_value_index "${_tip_index} + 1")
+    list(GET _tip_cells ${_tip_index} _tip_width)
+    list(GET _tip_cells ${_tip_value_index} _tip_value)
+    string(LENGTH "${_tip_value}" _tip_value_length)
+    set(_tip_pad "")
+    if(_tip_value_length LESS _tip_width)
+      math(EXPR _tip_pad_length "${_tip_width} - ${_tip_value_length}")
+      string(REPEAT " " ${_tip_pad_length} _tip_pad)
+    endif()
+    string(APPEND _tip_row "${_tip_pad}${_tip_value}  ")
+  endforeach()
+  string(APPEND _tip_row "\n")
+  set(${out_var}
+      "${_tip_row}"
+      PARENT_SCOPE)
+endfunction()
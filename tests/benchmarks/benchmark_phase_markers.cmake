@@ -0,0 +1,20 @@
+# Included by generated benchmark projects. Each marker appends "<name>=<microseconds since epoch>" to
+# TIP_BENCHMARK_MARKER_FILE so the driver script can compute phase durations after configure finishes.
+
+if(NOT DEFINED TIP_BENCHMARK_MARKER_FILE)
+  set(TIP_BENCHMARK_MARKER_FILE "${CMAKE_BINARY_DIR}/tip-benchmark-markers.txt")
+endif()
+file(WRITE "${TIP_BENCHMARK_MARKER_FILE}" "")
+
+function(tip_benchmark_mark name)
+  string(TIMESTAMP _tip_now "%s%f" UTC)
+  file(APPEND "${TIP_BENCHMARK_MARKER_FILE}" "${name}=${_tip_now}\n")
+endfunction()
+
+# Record a marker from the top-level deferred call queue. Deferred calls run in registration order, so a marker
+# deferred before the first target_install_package() call runs before package finalization, and one deferred after
+# the last call runs once every pending export has been finalized. Deferred arguments are evaluated when the call
+# runs, so the marker name is baked in through EVAL.
+function(tip_benchmark_defer_mark name)
+  cmake_language(EVAL CODE "cmake_language(DEFER DIRECTORY \"${CMAKE_SOURCE_DIR}\" CALL tip_benchmark_mark \"${name}\")")
+endfunction()
@@ -0,0 +1,288 @@
+cmake_minimum_required(VERSION 3.25)
+
+# Configure-time scaling benchmark for target_install_package().
+#
+# Generates synthetic projects with N targets spread round-robin across M exports, configures each one and reports
+# the time spent registering targets (target_prepare_package()), in deferred export finalization (finalize_package()
+# and SBOM finalization) and in deferred CPack configuration (_execute_deferred_cpack_config()).
+#
+# cmake -DTIP_REPO_ROOT=<repo> [-DTIP_BENCH_ROOT=<work dir>] [options] -P tests/benchmarks/configure_scale_benchmark.cmake
+#
+# Options (all optional):
+#   TIP_BENCH_TARGET_COUNTS           - List of N values, ';' or ',' separated (default: 10,50,100,250,500,1000,2500,5000)
+#   TIP_BENCH_EXPORT_COUNTS           - List of M values; cases with M > N are skipped (default: 1,10)
+#   TIP_BENCH_TARGET_TYPE             - STATIC, SHARED or INTERFACE (default: STATIC)
+#   TIP_BENCH_COMPONENT_COUNT         - Spread targets across this many install components; 0 keeps the defaults (default: 0)
+#   TIP_BENCH_COMPONENT_PER_TARGET    - Give every target its own install component, so components grow with N (default: OFF)
+#   TIP_BENCH_COMPONENT_DEPENDENCIES  - Add a COMPONENT_DEPENDENCIES entry to every target (default: OFF)
+#   TIP_BENCH_CPS                     - Enable CPS metadata for every export, CMake 4.3+ (default: OFF)
+#   TIP_BENCH_SBOM                    - Enable SBOM generation for every export, CMake 4.3+ (default: OFF)
+#   TIP_BENCH_SBOM_EXPERIMENTAL_VALUE - Activation value for CMAKE_EXPERIMENTAL_GENERATE_SBOM, required by TIP_BENCH_SBOM
+#   TIP_BENCH_CPACK                   - Call export_cpack() after all targets are registered (default: OFF)
+#   TIP_BENCH_REPEAT                  - Configure each case this many times and keep the fastest run (default: 1)
+#   TIP_BENCH_CSV                     - Write results to this CSV file (default: <TIP_BENCH_ROOT>/configure_scale.csv)
+
+include("${CMAKE_CURRENT_LIST_DIR}/benchmark_helpers.cmake")
+
+if(NOT DEFINED TIP_REPO_ROOT)
+  _tip_bench_fail("TIP_REPO_ROOT is required")
+endif()
+if(NOT DEFINED TIP_BENCH_ROOT)
+  set(TIP_BENCH_ROOT "${CMAKE_CURRENT_BINARY_DIR}/tip-benchmarks")
+endif()
+if(NOT DEFINED TIP_BENCH_TARGET_COUNTS)
+  set(TIP_BENCH_TARGET_COUNTS
+      10
+      50
+      100
+      250
+      500
+      1000
+      2500
+      5000)
+endif()
+if(NOT DEFINED TIP_BENCH_EXPORT_COUNTS)
+  set(TIP_BENCH_EXPORT_COUNTS 1 10)
+endif()
+if(NOT DEFINED TIP_BENCH_TARGET_TYPE)
+  set(TIP_BENCH_TARGET_TYPE STATIC)
+endif()
+if(NOT DEFINED TIP_BENCH_COMPONENT_COUNT)
+  set(TIP_BENCH_COMPONENT_COUNT 0)
+endif()
+if(NOT DEFINED TIP_BENCH_REPEAT)
+  set(TIP_BENCH_REPEAT 1)
+endif()
+if(NOT DEFINED TIP_BENCH_CSV)
+  set(TIP_BENCH_CSV "${TIP_BENCH_ROOT}/configure_scale.csv")
+endif()
+
+string(REPLACE "," ";" TIP_BENCH_TARGET_COUNTS "${TIP_BENCH_TARGET_COUNTS}")
+string(REPLACE "," ";" TIP_BENCH_EXPORT_COUNTS "${TIP_BENCH_EXPORT_COUNTS}")
+
+if(NOT TIP_BENCH_TARGET_TYPE MATCHES "^(STATIC|SHARED|INTERFACE)$")
+  _tip_bench_fail("TIP_BENCH_TARGET_TYPE must be STATIC, SHARED or INTERFACE, got '${TIP_BENCH_TARGET_TYPE}'")
+endif()
+if(NOT TIP_BENCH_REPEAT MATCHES "^[1-9][0-9]*$")
+  _tip_bench_fail("TIP_BENCH_REPEAT must be a positive integer, got '${TIP_BENCH_REPEAT}'")
+endif()
+if(TIP_BENCH_CPS AND CMAKE_VERSION VERSION_LESS "4.3")
+  message(STATUS "[benchmark] TIP_BENCH_CPS ignored: CPS requires CMake 4.3 or newer (running ${CMAKE_VERSION})")
+  set(TIP_BENCH_CPS OFF)
+endif()
+if(TIP_BENCH_SBOM AND CMAKE_VERSION VERSION_LESS "4.3")
+  message(STATUS "[benchmark] TIP_BENCH_SBOM ignored: SBOM requires CMake 4.3 or newer (running ${CMAKE_VERSION})")
+  set(TIP_BENCH_SBOM OFF)
+endif()
+if(TIP_BENCH_SBOM AND (NOT DEFINED TIP_BENCH_SBOM_EXPERIMENTAL_VALUE OR TIP_BENCH_SBOM_EXPERIMENTAL_VALUE STREQUAL ""))
+  _tip_bench_fail("TIP_BENCH_SBOM requires TIP_BENCH_SBOM_EXPERIMENTAL_VALUE")
+endif()
+
+_tip_proof_append_toolchain_args(_tip_toolchain_args)
+
+set(_tip_features "")
+foreach(_tip_feature CPS SBOM COMPONENT_DEPENDENCIES CPACK)
+  if(TIP_BENCH_${_tip_feature})
+    list(APPEND _tip_features "${_tip_feature}")
+  endif()
+endforeach()
+if(TIP_BENCH_COMPONENT_PER_TARGET)
+  list(APPEND _tip_features "COMPONENTS=N")
+elseif(TIP_BENCH_COMPONENT_COUNT GREATER 0)
+  list(APPEND _tip_features "COMPONENTS=${TIP_BENCH_COMPONENT_COUNT}")
+endif()
+if(NOT _tip_features)
+  set(_tip_features "none")
+endif()
+string(REPLACE ";" "," _tip_features_label "${_tip_features}")
+
+set(_tip_project_languages CXX)
+if(TIP_BENCH_TARGET_TYPE STREQUAL "INTERFACE")
+  set(_tip_project_languages NONE)
+endif()
+
+# Emits the synthetic project. Targets are created before the first marker so only target_install_package() work
+# lands in the prepare phase.
+function(_tip_bench_write_project source_dir target_count export_count)
+  file(REMOVE_RECURSE "${source_dir}")
+  file(MAKE_DIRECTORY "${source_dir}/src" "${source_dir}/include/bench")
+  file(WRITE "${source_dir}/src/bench.cpp" "int tip_bench_value() { return 1; }\n")
+  foreach(_tip_index RANGE 1 ${target_count})
+    file(WRITE "${source_dir}/include/bench/t${_tip_index}.h" "#pragma once\n")
+  endforeach()
+
+  set(_tip_sources "src/bench.cpp")
+  set(_tip_header_scope PUBLIC)
+  if(TIP_BENCH_TARGET_TYPE STREQUAL "INTERFACE")
+    set(_tip_sources "")
+    set(_tip_header_scope INTERFACE)
+  endif()
+
+  set(_tip_project "")
+  string(
+    APPEND
+    _tip_project
+    "cmake_minimum_required(VERSION 3.25)\n"
+    "project(tip_configure_scale VERSION 1.0.0 LANGUAGES ${_tip_project_languages})\n"
+    "set(TARGET_INSTALL_PACKAGE_DISABLE_INSTALL ON)\n")
+  if(TIP_BENCH_SBOM)
+    string(APPEND _tip_project "set(CMAKE_EXPERIMENTAL_GENERATE_SBOM \"${TIP_BENCH_SBOM_EXPERIMENTAL_VALUE}\")\n")
+  endif()
+  string(
+    APPEND
+    _tip_project
+    "include(\"${TIP_REPO_ROOT}/cmake/load_target_install_package.cmake\")\n"
+    "include(\"${CMAKE_CURRENT_FUNCTION_LIST_DIR}/benchmark_phase_markers.cmake\")\n"
+    "\n"
+    "foreach(_bench_index RANGE 1 ${target_count})\n"
+    "  add_library(bench_t\${_bench_index} ${TIP_BENCH_TARGET_TYPE} ${_tip_sources})\n"
+    "  target_sources(bench_t\${_bench_index} ${_tip_header_scope} FILE_SET HEADERS BASE_DIRS include FILES include/bench/t\${_bench_index}.h)\n"
+    "endforeach()\n"
+    "\n"
+    "tip_benchmark_defer_mark(finalize_begin)\n"
+    "tip_benchmark_mark(prepare_begin)\n"
+    "foreach(_bench_index RANGE 1 ${target_count})\n"
+    "  math(EXPR _bench_export \"\${_bench_index} % ${export_count}\")\n"
+    "  set(_bench_args EXPORT_NAME bench_export_\${_bench_export} NAMESPACE Bench:: VERSION 1.0.0)\n")
+  if(TIP_BENCH_COMPONENT_PER_TARGET)
+    string(APPEND _tip_project "  set(_bench_component bench_component_\${_bench_index})\n" "  list(APPEND _bench_args COMPONENT \${_bench_component})\n")
+  elseif(TIP_BENCH_COMPONENT_COUNT GREATER 0)
+    string(
+      APPEND
+      _tip_project
+      "  math(EXPR _bench_component \"\${_bench_index} % ${TIP_BENCH_COMPONENT_COUNT}\")\n"
+      "  set(_bench_component bench_component_\${_bench_component})\n"
+      "  list(APPEND _bench_args COMPONENT \${_bench_component})\n")
+  else()
+    string(APPEND _tip_project "  set(_bench_component bench_component)\n")
+  endif()
+  if(TIP_BENCH_COMPONENT_DEPENDENCIES)
+    string(APPEND _tip_project "  list(APPEND _bench_args COMPONENT_DEPENDENCIES \${_bench_component} \"Threads\")\n")
+  endif()
+  if(TIP_BENCH_CPS)
+    string(APPEND _tip_project "  list(APPEND _bench_args CPS CPS_PACKAGE_NAME bench_export_\${_bench_export})\n")
+  endif()
+  if(TIP_BENCH_SBOM)
+    string(APPEND _tip_project "  list(APPEND _bench_args SBOM SBOM_NAME bench_export_\${_bench_export} SBOM_LICENSE MIT)\n")
+  endif()
+  string(
+    APPEND
+    _tip_project
+    "  target_install_package(bench_t\${_bench_index} \${_bench_args})\n"
+    "endforeach()\n"
+    "tip_benchmark_mark(prepare_end)\n"
+    "tip_benchmark_defer_mark(finalize_end)\n")
+  if(TIP_BENCH_CPACK)
+    string(
+      APPEND
+      _tip_project
+      "export_cpack(PACKAGE_NAME tip_configure_scale PACKAGE_VENDOR \"tip\" GENERATORS TGZ NO_DEFAULT_GENERATORS)\n"
+      "tip_benchmark_defer_mark(cpack_end)\n")
+  endif()
+
+  file(WRITE "${source_dir}/CMakeLists.txt" "${_tip_project}")
+endfunction()
+
+set(_tip_columns
+    8
+    targets
+    8
+    exports
+    12
+    prepare_ms
+    12
+    finalize_ms
+    10
+    cpack_ms
+    13
+    configure_ms
+    16
+    prepare_us/tgt
+    17
+    finalize_us/tgt)
+set(_tip_table "")
+_tip_bench_append_row(_tip_table ${_tip_columns})
+set(_tip_csv "targets,exports,target_type,features,prepare_us,finalize_us,cpack_us,configure_us\n")
+
+foreach(_tip_export_count IN LISTS TIP_BENCH_EXPORT_COUNTS)
+  foreach(_tip_target_count IN LISTS TIP_BENCH_TARGET_COUNTS)
+    if(_tip_export_count GREATER _tip_target_count)
+      continue()
+    endif()
+
+    set(_tip_case_root "${TIP_BENCH_ROOT}/configure-scale/n${_tip_target_count}-m${_tip_export_count}")
+    set(_tip_source_dir "${_tip_case_root}/source")
+    set(_tip_build_dir "${_tip_case_root}/build")
+    _tip_bench_write_project("${_tip_source_dir}" ${_tip_target_count} ${_tip_export_count})
+
+    set(_tip_best_configure "")
+    foreach(_tip_run RANGE 1 ${TIP_BENCH_REPEAT})
+      file(REMOVE_RECURSE "${_tip_build_dir}")
+      _tip_bench_run_timed_step(
+        NAME
+        "configure N=${_tip_target_count} M=${_tip_export_count}"
+        ELAPSED_US_VARIABLE
+        _tip_configure_us
+        COMMAND
+        "${CMAKE_COMMAND}"
+        -S
+        "${_tip_source_dir}"
+        -B
+        "${_tip_build_dir}"
+        "-DCMAKE_BUILD_TYPE=Release"
+        "-DCMAKE_INSTALL_LIBDIR=lib"
+        ${_tip_toolchain_args})
+
+      _tip_bench_read_markers("${_tip_build_dir}/tip-benchmark-markers.txt" _tip_markers)
+      _tip_bench_marker_span(_tip_markers prepare_begin prepare_end _tip_prepare_us)
+      _tip_bench_marker_span(_tip_markers finalize_begin finalize_end _tip_finalize_us)
+      set(_tip_cpack_us 0)
+      if(TIP_BENCH_CPACK)
+        _tip_bench_marker_span(_tip_markers finalize_end cpack_end _tip_cpack_us)
+      endif()
+
+      if(_tip_best_configure STREQUAL "" OR _tip_configure_us LESS _tip_best_configure)
+        set(_tip_best_configure ${_tip_configure_us})
+        set(_tip_best_prepare ${_tip_prepare_us})
+        set(_tip_best_finalize ${_tip_finalize_us})
+        set(_tip_best_cpack ${_tip_cpack_us})
+      endif()
+    endforeach()
+
+    math(EXPR _tip_prepare_per_target "${_tip_best_prepare} / ${_tip_target_count}")
+    math(EXPR _tip_finalize_per_target "${_tip_best_finalize} / ${_tip_target_count}")
+    _tip_bench_format_ms(${_tip_best_prepare} _tip_prepare_ms)
+    _tip_bench_format_ms(${_tip_best_finalize} _tip_finalize_ms)
+    _tip_bench_format_ms(${_tip_best_cpack} _tip_cpack_ms)
+    _tip_bench_format_ms(${_tip_best_configure} _tip_configure_ms)
+
+    _tip_bench_append_row(
+      _tip_table
+      8
+      ${_tip_target_count}
+      8
+      ${_tip_export_count}
+      12
+      ${_tip_prepare_ms}
+      12
+      ${_tip_finalize_ms}
+      10
+      ${_tip_cpack_ms}
+      13
+      ${_tip_configure_ms}
+      16
+      ${_tip_prepare_per_target}
+      17
+      ${_tip_finalize_per_target})
+    string(
+      APPEND
+      _tip_csv
+      "${_tip_target_count},${_tip_export_count},${TIP_BENCH_TARGET_TYPE},${_tip_features_label},"
+      "${_tip_best_prepare},${_tip_best_finalize},${_tip_best_cpack},${_tip_best_configure}\n")
+    message(STATUS "[benchmark] N=${_tip_target_count} M=${_tip_export_count}: prepare ${_tip_prepare_ms} ms, finalize ${_tip_finalize_ms} ms, cpack ${_tip_cpack_ms} ms")
+  endforeach()
+endforeach()
+
+file(WRITE "${TIP_BENCH_CSV}" "${_tip_csv}")
+message(STATUS "[benchmark] configure scaling (target type ${TIP_BENCH_TARGET_TYPE}, features: ${_tip_features_label}, CMake ${CMAKE_VERSION})\n${_tip_table}")
+message(STATUS "[benchmark] CSV written to ${TIP_BENCH_CSV}")
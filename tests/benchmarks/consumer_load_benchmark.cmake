@@ -0,0 +1,296 @@
+cmake_minimum_required(VERSION 3.25)
+
+# Consumer-side find_package() load time of installed packages.
+#
+# For every combination of the options below, generates a producer project with K packages, each with T targets spread
+# across C components and depending on the package before it in chains of D dependencies, and installs it. A consumer
+# without languages then calls find_package() for every package, newest first, so each chain is resolved through
+# find_dependency() the first time it is reached. The consumer is configured twice per run:
+#
+# - plain: only the find_package() loop is timed. This is the load_ms column.
+# - probed: consumer_load_probes.cmake wraps find_dependency() and include() and splits the loop into time spent in
+#   <Export>Targets.cmake files (imported-target creation), in find_dependency() outside those files (dependency
+#   resolution), and the rest (locating the package and running its config and version files). The wrappers add some
+#   overhead of their own, so the three phases add up to slightly more than load_ms.
+#
+# cmake -DTIP_REPO_ROOT=<repo> [-DTIP_BENCH_ROOT=<work dir>] [options] -P tests/benchmarks/consumer_load_benchmark.cmake
+#
+# Options (all optional, lists are ';' or ',' separated):
+#   TIP_BENCH_PACKAGE_COUNTS    - List of K values (default: 1,10,100,500)
+#   TIP_BENCH_TARGET_COUNTS     - List of targets per package (default: 1,10)
+#   TIP_BENCH_COMPONENT_COUNTS  - List of install components per package; 0 keeps the defaults (default: 0)
+#   TIP_BENCH_DEPENDENCY_DEPTHS - List of dependency chain lengths; 0 gives independent packages (default: 0,4)
+#   TIP_BENCH_TARGET_TYPE       - STATIC or INTERFACE (default: INTERFACE)
+#   TIP_BENCH_PACKAGE_ARGS      - Extra target_install_package() arguments for every package, e.g. FLATTEN_CONFIG
+#   TIP_BENCH_REPEAT            - Configure the consumer this many times per case and keep the fastest run (default: 3)
+#   TIP_BENCH_CSV               - Write results to this CSV file (default: <TIP_BENCH_ROOT>/consumer_load.csv)
+
+include("${CMAKE_CURRENT_LIST_DIR}/benchmark_helpers.cmake")
+
+if(NOT DEFINED TIP_REPO_ROOT)
+  _tip_bench_fail("TIP_REPO_ROOT is required")
+endif()
+if(NOT DEFINED TIP_BENCH_ROOT)
+  set(TIP_BENCH_ROOT "${CMAKE_CURRENT_BINARY_DIR}/tip-benchmarks")
+endif()
+if(NOT DEFINED TIP_BENCH_PACKAGE_COUNTS)
+  set(TIP_BENCH_PACKAGE_COUNTS
+      1
+      10
+      100
+      500)
+endif()
+if(NOT DEFINED TIP_BENCH_TARGET_COUNTS)
+  set(TIP_BENCH_TARGET_COUNTS 1 10)
+endif()
+if(NOT DEFINED TIP_BENCH_COMPONENT_COUNTS)
+  set(TIP_BENCH_COMPONENT_COUNTS 0)
+endif()
+if(NOT DEFINED TIP_BENCH_DEPENDENCY_DEPTHS)
+  set(TIP_BENCH_DEPENDENCY_DEPTHS 0 4)
+endif()
+if(NOT DEFINED TIP_BENCH_TARGET_TYPE)
+  set(TIP_BENCH_TARGET_TYPE INTERFACE)
+endif()
+if(NOT DEFINED TIP_BENCH_PACKAGE_ARGS)
+  set(TIP_BENCH_PACKAGE_ARGS "")
+endif()
+if(NOT DEFINED TIP_BENCH_REPEAT)
+  set(TIP_BENCH_REPEAT 3)
+endif()
+if(NOT DEFINED TIP_BENCH_CSV)
+  set(TIP_BENCH_CSV "${TIP_BENCH_ROOT}/consumer_load.csv")
+endif()
+
+foreach(_tip_list IN ITEMS PACKAGE_COUNTS TARGET_COUNTS COMPONENT_COUNTS DEPENDENCY_DEPTHS)
+  string(REPLACE "," ";" TIP_BENCH_${_tip_list} "${TIP_BENCH_${_tip_list}}")
+  foreach(_tip_value IN LISTS TIP_BENCH_${_tip_list})
+    if(NOT _tip_value MATCHES "^[0-9]+$")
+      _tip_bench_fail("TIP_BENCH_${_tip_list} must list non-negative integers, got '${_tip_value}'")
+    endif()
+  endforeach()
+endforeach()
+if(NOT TIP_BENCH_TARGET_TYPE MATCHES "^(STATIC|INTERFACE)$")
+  _tip_bench_fail("TIP_BENCH_TARGET_TYPE must be STATIC or INTERFACE, got '${TIP_BENCH_TARGET_TYPE}'")
+endif()
+if(NOT TIP_BENCH_REPEAT MATCHES "^[1-9][0-9]*$")
+  _tip_bench_fail("TIP_BENCH_REPEAT must be a positive integer, got '${TIP_BENCH_REPEAT}'")
+endif()
+
+_tip_proof_append_toolchain_args(_tip_toolchain_args)
+
+set(_tip_producer_languages NONE)
+set(_tip_sources "")
+if(TIP_BENCH_TARGET_TYPE STREQUAL "STATIC")
+  set(_tip_producer_languages C)
+  set(_tip_sources "lib.c")
+endif()
+
+# Package <i> depends on package <i-1> unless <i-1> ends a chain, so chains hold depth + 1 packages.
+function(_tip_bench_write_producer source_dir package_count target_count component_count depth)
+  file(REMOVE_RECURSE "${source_dir}")
+  file(WRITE "${source_dir}/lib.c" "int tip_bench_value(void) { return 1; }\n")
+  math(EXPR _tip_chain "${depth} + 1")
+  string(
+    CONCAT
+    _tip_project
+    "cmake_minimum_required(VERSION 3.25)\n"
+    "project(tip_consumer_load_producer VERSION 1.0.0 LANGUAGES ${_tip_producer_languages})\n"
+    "set(TARGET_INSTALL_PACKAGE_DISABLE_INSTALL ON)\n"
+    "include(\"${TIP_REPO_ROOT}/cmake/load_target_install_package.cmake\")\n"
+    "foreach(_bench_package RANGE 1 ${package_count})\n"
+    "  set(_bench_targets \"\")\n"
+    "  set(_bench_overrides \"\")\n"
+    "  foreach(_bench_target RANGE 1 ${target_count})\n"
+    "    set(_bench_name bench_p\${_bench_package}_t\${_bench_target})\n"
+    "    add_library(\${_bench_name} ${TIP_BENCH_TARGET_TYPE} ${_tip_sources})\n"
+    "    list(APPEND _bench_targets \${_bench_name})\n")
+  if(component_count GREATER 0)
+    string(APPEND _tip_project "    math(EXPR _bench_component \"\${_bench_target} % ${component_count}\")\n"
+           "    list(APPEND _bench_overrides TARGET \${_bench_name} COMPONENT c\${_bench_component})\n")
+  endif()
+  string(
+    APPEND
+    _tip_project
+    "  endforeach()\n"
+    "  set(_bench_dependencies \"\")\n"
+    "  math(EXPR _bench_position \"(\${_bench_package} - 1) % ${_tip_chain}\")\n"
+    "  if(_bench_position GREATER 0)\n"
+    "    math(EXPR _bench_previous \"\${_bench_package} - 1\")\n"
+    "    set(_bench_dependencies PUBLIC_DEPENDENCIES \"bench_pkg\${_bench_previous} 1.0 REQUIRED\")\n"
+    "  endif()\n"
+    "  target_install_packages(TARGETS \${_bench_targets} EXPORT_NAME bench_pkg\${_bench_package} NAMESPACE bench:: ${TIP_BENCH_PACKAGE_ARGS}\n"
+    "                          \${_bench_dependencies} \${_bench_overrides})\n"
+    "endforeach()\n")
+  file(WRITE "${source_dir}/CMakeLists.txt" "${_tip_project}")
+endfunction()
+
+function(_tip_bench_write_consumer source_dir package_count)
+  file(REMOVE_RECURSE "${source_dir}")
+  file(
+    WRITE "${source_dir}/CMakeLists.txt"
+    "cmake_minimum_required(VERSION 3.25)\n"
+    "project(tip_consumer_load LANGUAGES NONE)\n"
+    "include(\"${CMAKE_CURRENT_FUNCTION_LIST_DIR}/benchmark_phase_markers.cmake\")\n"
+    "if(TIP_BENCH_PROBES)\n"
+    "  include(\"${CMAKE_CURRENT_FUNCTION_LIST_DIR}/consumer_load_probes.cmake\")\n"
+    "endif()\n"
+    "tip_benchmark_mark(load_begin)\n"
+    "foreach(_bench_package RANGE ${package_count} 1 -1)\n"
+    "  find_package(bench_pkg\${_bench_package} 1.0 REQUIRED CONFIG)\n"
+    "endforeach()\n"
+    "tip_benchmark_mark(load_end)\n"
+    "if(TIP_BENCH_PROBES)\n"
+    "  tip_benchmark_write_probes()\n"
+    "endif()\n")
+endfunction()
+
+# Configure the consumer and read its markers into <prefix>_* variables.
+function(_tip_bench_configure_consumer consumer_dir prefix_path probes prefix)
+  set(_tip_build_dir "${consumer_dir}/build")
+  file(REMOVE_RECURSE "${_tip_build_dir}")
+  _tip_proof_run_step(
+    NAME
+    "configure consumer"
+    COMMAND
+    "${CMAKE_COMMAND}"
+    -S
+    "${consumer_dir}"
+    -B
+    "${_tip_build_dir}"
+    "-DCMAKE_PREFIX_PATH=${prefix_path}"
+    "-DTIP_BENCH_PROBES=${probes}"
+    ${_tip_toolchain_args})
+  _tip_bench_read_markers("${_tip_build_dir}/tip-benchmark-markers.txt" _tip_markers)
+  _tip_bench_marker_span(_tip_markers load_begin load_end _tip_load_us)
+  set(${prefix}_load_us
+      ${_tip_load_us}
+      PARENT_SCOPE)
+  foreach(_tip_probe IN ITEMS dependency targets targets_in_dependency)
+    set(${prefix}_${_tip_probe}_us
+        "${_tip_markers_${_tip_probe}_us}"
+        PARENT_SCOPE)
+  endforeach()
+endfunction()
+
+set(_tip_columns
+    9
+    packages
+    8
+    targets
+    6
+    comps
+    6
+    depth
+    10
+    load_ms
+    10
+    us/pkg
+    10
+    config_ms
+    10
+    deps_ms
+    11
+    targets_ms)
+set(_tip_table "")
+_tip_bench_append_row(_tip_table ${_tip_columns})
+set(_tip_csv "packages,targets,components,depth,target_type,package_args,load_us,config_us,dependency_us,targets_us\n")
+string(REPLACE ";" " " _tip_package_args_label "${TIP_BENCH_PACKAGE_ARGS}")
+
+foreach(_tip_package_count IN LISTS TIP_BENCH_PACKAGE_COUNTS)
+  if(_tip_package_count EQUAL 0)
+    continue()
+  endif()
+  foreach(_tip_target_count IN LISTS TIP_BENCH_TARGET_COUNTS)
+    if(_tip_target_count EQUAL 0)
+      continue()
+    endif()
+    foreach(_tip_component_count IN LISTS TIP_BENCH_COMPONENT_COUNTS)
+      foreach(_tip_depth IN LISTS TIP_BENCH_DEPENDENCY_DEPTHS)
+        set(_tip_case "k${_tip_package_count}-t${_tip_target_count}-c${_tip_component_count}-d${_tip_depth}")
+        set(_tip_case_root "${TIP_BENCH_ROOT}/consumer-load/${_tip_case}")
+        set(_tip_prefix "${_tip_case_root}/install")
+        file(REMOVE_RECURSE "${_tip_prefix}")
+        _tip_bench_write_producer("${_tip_case_root}/producer" ${_tip_package_count} ${_tip_target_count} ${_tip_component_count} ${_tip_depth})
+        _tip_bench_write_consumer("${_tip_case_root}/consumer" ${_tip_package_count})
+
+        _tip_proof_run_step(
+          NAME
+          "configure producer ${_tip_case}"
+          COMMAND
+          "${CMAKE_COMMAND}"
+          -S
+          "${_tip_case_root}/producer"
+          -B
+          "${_tip_case_root}/producer-build"
+          -DCMAKE_BUILD_TYPE=Release
+          ${_tip_toolchain_args})
+        _tip_proof_run_step(NAME "build producer ${_tip_case}" COMMAND "${CMAKE_COMMAND}" --build "${_tip_case_root}/producer-build" --config Release --parallel)
+        _tip_proof_run_step(
+          NAME
+          "install producer ${_tip_case}"
+          COMMAND
+          "${CMAKE_COMMAND}"
+          --install
+          "${_tip_case_root}/producer-build"
+          --config
+          Release
+          --prefix
+          "${_tip_prefix}")
+
+        set(_tip_best_load "")
+        set(_tip_best_probed "")
+        foreach(_tip_run RANGE 1 ${TIP_BENCH_REPEAT})
+          _tip_bench_configure_consumer("${_tip_case_root}/consumer" "${_tip_prefix}" OFF _tip_plain)
+          if(_tip_best_load STREQUAL "" OR _tip_plain_load_us LESS _tip_best_load)
+            set(_tip_best_load ${_tip_plain_load_us})
+          endif()
+          _tip_bench_configure_consumer("${_tip_case_root}/consumer" "${_tip_prefix}" ON _tip_probed)
+          if(_tip_best_probed STREQUAL "" OR _tip_probed_load_us LESS _tip_best_probed)
+            set(_tip_best_probed ${_tip_probed_load_us})
+            math(EXPR _tip_best_dependency "${_tip_probed_dependency_us} - ${_tip_probed_targets_in_dependency_us}")
+            set(_tip_best_targets ${_tip_probed_targets_us})
+            math(EXPR _tip_best_config "${_tip_probed_load_us} - ${_tip_best_dependency} - ${_tip_best_targets}")
+          endif()
+        endforeach()
+
+        math(EXPR _tip_per_package "${_tip_best_load} / ${_tip_package_count}")
+        _tip_bench_format_ms(${_tip_best_load} _tip_load_ms)
+        _tip_bench_format_ms(${_tip_best_config} _tip_config_ms)
+        _tip_bench_format_ms(${_tip_best_dependency} _tip_dependency_ms)
+        _tip_bench_format_ms(${_tip_best_targets} _tip_targets_ms)
+        _tip_bench_append_row(
+          _tip_table
+          9
+          ${_tip_package_count}
+          8
+          ${_tip_target_count}
+          6
+          ${_tip_component_count}
+          6
+          ${_tip_depth}
+          10
+          ${_tip_load_ms}
+          10
+          ${_tip_per_package}
+          10
+          ${_tip_config_ms}
+          10
+          ${_tip_dependency_ms}
+          11
+          ${_tip_targets_ms})
+        string(
+          APPEND
+          _tip_csv
+          "${_tip_package_count},${_tip_target_count},${_tip_component_count},${_tip_depth},${TIP_BENCH_TARGET_TYPE},\"${_tip_package_args_label}\","
+          "${_tip_best_load},${_tip_best_config},${_tip_best_dependency},${_tip_best_targets}\n")
+        message(STATUS "[benchmark] ${_tip_case}: load ${_tip_load_ms} ms")
+      endforeach()
+    endforeach()
+  endforeach()
+endforeach()
+
+file(WRITE "${TIP_BENCH_CSV}" "${_tip_csv}")
+message(STATUS "[benchmark] consumer find_package() load time (target type ${TIP_BENCH_TARGET_TYPE}, package args: [${_tip_package_args_label}], "
+               "CMake ${CMAKE_VERSION})\n${_tip_table}")
+message(STATUS "[benchmark] CSV written to ${TIP_BENCH_CSV}")
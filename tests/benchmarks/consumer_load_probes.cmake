@@ -0,0 +1,74 @@
+# Included by the consumer_load_benchmark.cmake consumer to split package load time into phases. Wraps
+# find_dependency() and include() so the time spent in find_dependency() calls and in <Export>Targets.cmake files is
+# summed into global properties, and tip_benchmark_write_probes() appends the totals to TIP_BENCHMARK_MARKER_FILE.
+#
+# Only the outermost call of each kind is timed, so nested dependencies and per-configuration targets files are not
+# counted twice. Targets files loaded by a find_dependency() call are also summed separately, so the driver can report
+# dependency resolution without the targets it created. The probes run inside package configs, including the function
+# scope of FLATTEN_CONFIG configs, so all state lives in global properties.
+
+if(NOT COMMAND find_dependency)
+  include(CMakeFindDependencyMacro)
+endif()
+
+foreach(_tip_probe IN ITEMS dependency targets targets_in_dependency)
+  set_property(GLOBAL PROPERTY TIP_BENCH_PROBE_${_tip_probe}_US 0)
+endforeach()
+set_property(GLOBAL PROPERTY TIP_BENCH_PROBE_dependency_DEPTH 0)
+set_property(GLOBAL PROPERTY TIP_BENCH_PROBE_targets_DEPTH 0)
+
+function(tip_benchmark_probe_begin kind)
+  get_property(_tip_depth GLOBAL PROPERTY TIP_BENCH_PROBE_${kind}_DEPTH)
+  if(_tip_depth EQUAL 0)
+    string(TIMESTAMP _tip_now "%s%f" UTC)
+    set_property(GLOBAL PROPERTY TIP_BENCH_PROBE_${kind}_BEGIN ${_tip_now})
+  endif()
+  math(EXPR _tip_depth "${_tip_depth} + 1")
+  set_property(GLOBAL PROPERTY TIP_BENCH_PROBE_${kind}_DEPTH ${_tip_depth})
+endfunction()
+
+function(tip_benchmark_probe_end kind)
+  get_property(_tip_depth GLOBAL PROPERTY TIP_BENCH_PROBE_${kind}_DEPTH)
+  math(EXPR _tip_depth "${_tip_depth} - 1")
+  set_property(GLOBAL PROPERTY TIP_BENCH_PROBE_${kind}_DEPTH ${_tip_depth})
+  if(NOT _tip_depth EQUAL 0)
+    return()
+  endif()
+  string(TIMESTAMP _tip_now "%s%f" UTC)
+  get_property(_tip_begin GLOBAL PROPERTY TIP_BENCH_PROBE_${kind}_BEGIN)
+  math(EXPR _tip_elapsed "${_tip_now} - ${_tip_begin}")
+  set(_tip_totals ${kind})
+  get_property(_tip_dependency_depth GLOBAL PROPERTY TIP_BENCH_PROBE_dependency_DEPTH)
+  if(kind STREQUAL "targets" AND _tip_dependency_depth GREATER 0)
+    list(APPEND _tip_totals targets_in_dependency)
+  endif()
+  foreach(_tip_total IN LISTS _tip_totals)
+    get_property(_tip_sum GLOBAL PROPERTY TIP_BENCH_PROBE_${_tip_total}_US)
+    math(EXPR _tip_sum "${_tip_sum} + ${_tip_elapsed}")
+    set_property(GLOBAL PROPERTY TIP_BENCH_PROBE_${_tip_total}_US ${_tip_sum})
+  endforeach()
+endfunction()
+
+# The wrappers are macros so the wrapped commands still run in the scope of the package config.
+macro(find_dependency)
+  tip_benchmark_probe_begin(dependency)
+  _find_dependency(${ARGV})
+  tip_benchmark_probe_end(dependency)
+endmacro()
+
+macro(include)
+  if("${ARGV0}" MATCHES "Targets\\.cmake$")
+    tip_benchmark_probe_begin(targets)
+    _include(${ARGV})
+    tip_benchmark_probe_end(targets)
+  else()
+    _include(${ARGV})
+  endif()
+endmacro()
+
+function(tip_benchmark_write_probes)
+  foreach(_tip_probe IN ITEMS dependency targets targets_in_dependency)
+    get_property(_tip_sum GLOBAL PROPERTY TIP_BENCH_PROBE_${_tip_probe}_US)
+    file(APPEND "${TIP_BENCHMARK_MARKER_FILE}" "${_tip_probe}_us=${_tip_sum}\n")
+  endforeach()
+endfunction()
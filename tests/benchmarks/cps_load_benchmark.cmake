@@ -0,0 +1,210 @@
+cmake_minimum_required(VERSION 3.25)
+
+# find_package() load time of the same CPS_PRIMARY exports through their .cps files and through their generated configs.
+#
+# Generates a producer project with N static libraries, each exported as its own package with CPS CPS_PRIMARY, and
+# installs it once. The install prefix is then copied into one prefix per entry point:
+#
+# - config: the .cps files are removed, so find_package() loads the fallback <Export>Config.cmake, the version file and
+#   the targets files. Set TIP_BENCH_CONFIG_CMAKE to a CMake older than 4.3 to time this as such a consumer would.
+# - cps: share/cmake is removed, so find_package() reads the .cps file of each package.
+# - both: the full install, to see which entry point CMake picks when both are present. The cps column counts the
+#   packages that were loaded from a .cps file.
+# - redirect: the full install without the targets files, with every <Export>_DIR pointing at the config, so each
+#   package goes through the fallback config and on to its .cps file.
+#
+# A consumer without languages calls find_package() for every package and times the loop. The benchmark reports the
+# fastest loop for each prefix, in total and per package. install(PACKAGE_INFO) needs CMake 4.3.
+#
+# cmake -DTIP_REPO_ROOT=<repo> [-DTIP_BENCH_ROOT=<work dir>] [options] -P tests/benchmarks/cps_load_benchmark.cmake
+#
+# Options (all optional):
+#   TIP_BENCH_PACKAGES - Number of packages (default: 150)
+#   TIP_BENCH_REPEAT   - Configure the consumer this many times per prefix and keep the fastest run (default: 3)
+#   TIP_BENCH_CONFIG_CMAKE - CMake that configures the consumer of the config prefix (default: this CMake)
+
+include("${CMAKE_CURRENT_LIST_DIR}/benchmark_helpers.cmake")
+
+if(CMAKE_VERSION VERSION_LESS "4.3")
+  _tip_bench_fail("cps_load_benchmark requires CMake 4.3 or newer for install(PACKAGE_INFO), got ${CMAKE_VERSION}")
+endif()
+if(NOT DEFINED TIP_REPO_ROOT)
+  _tip_bench_fail("TIP_REPO_ROOT is required")
+endif()
+if(NOT DEFINED TIP_BENCH_ROOT)
+  set(TIP_BENCH_ROOT "${CMAKE_CURRENT_BINARY_DIR}/tip-benchmarks")
+endif()
+if(NOT DEFINED TIP_BENCH_PACKAGES)
+  set(TIP_BENCH_PACKAGES 150)
+endif()
+if(NOT DEFINED TIP_BENCH_REPEAT)
+  set(TIP_BENCH_REPEAT 3)
+endif()
+if(NOT TIP_BENCH_PACKAGES MATCHES "^[1-9][0-9]*$")
+  _tip_bench_fail("TIP_BENCH_PACKAGES must be a positive integer, got '${TIP_BENCH_PACKAGES}'")
+endif()
+if(NOT TIP_BENCH_REPEAT MATCHES "^[1-9][0-9]*$")
+  _tip_bench_fail("TIP_BENCH_REPEAT must be a positive integer, got '${TIP_BENCH_REPEAT}'")
+endif()
+if(NOT DEFINED TIP_BENCH_CONFIG_CMAKE OR TIP_BENCH_CONFIG_CMAKE STREQUAL "")
+  set(TIP_BENCH_CONFIG_CMAKE "${CMAKE_COMMAND}")
+endif()
+
+set(_tip_case_root "${TIP_BENCH_ROOT}/cps-load/n${TIP_BENCH_PACKAGES}")
+set(_tip_producer_dir "${_tip_case_root}/producer")
+set(_tip_producer_build "${_tip_case_root}/producer-build")
+set(_tip_consumer_dir "${_tip_case_root}/consumer")
+set(_tip_install_prefix "${_tip_case_root}/install")
+file(REMOVE_RECURSE "${_tip_case_root}")
+
+file(
+  WRITE "${_tip_producer_dir}/CMakeLists.txt"
+  "cmake_minimum_required(VERSION 3.25)\n"
+  "project(tip_cps_load_producer VERSION 1.0.0 LANGUAGES C)\n"
+  "set(TARGET_INSTALL_PACKAGE_DISABLE_INSTALL ON)\n"
+  "include(\"${TIP_REPO_ROOT}/cmake/load_target_install_package.cmake\")\n"
+  "foreach(_tip_index RANGE 1 ${TIP_BENCH_PACKAGES})\n"
+  "  add_library(tip_bench_pkg\${_tip_index} STATIC lib.c)\n"
+  "  target_install_package(tip_bench_pkg\${_tip_index} CPS CPS_PRIMARY)\n"
+  "endforeach()\n")
+file(WRITE "${_tip_producer_dir}/lib.c" "int tip_bench_value(void) { return 1; }\n")
+
+# The consumer uses no languages, so the timed loop only loads package files.
+file(
+  WRITE "${_tip_consumer_dir}/CMakeLists.txt"
+  "cmake_minimum_required(VERSION 3.25)\n"
+  "project(tip_cps_load_consumer LANGUAGES NONE)\n"
+  "string(TIMESTAMP _tip_begin \"%s%f\" UTC)\n"
+  "foreach(_tip_index RANGE 1 ${TIP_BENCH_PACKAGES})\n"
+  "  if(TIP_BENCH_VIA_CONFIG)\n"
+  "    set(tip_bench_pkg\${_tip_index}_DIR \"\${CMAKE_PREFIX_PATH}/share/cmake/tip_bench_pkg\${_tip_index}\")\n"
+  "  endif()\n"
+  "  find_package(tip_bench_pkg\${_tip_index} 1.0.0 REQUIRED CONFIG)\n"
+  "endforeach()\n"
+  "string(TIMESTAMP _tip_end \"%s%f\" UTC)\n"
+  "math(EXPR _tip_elapsed \"\${_tip_end} - \${_tip_begin}\")\n"
+  "set(_tip_cps_loaded 0)\n"
+  "foreach(_tip_index RANGE 1 ${TIP_BENCH_PACKAGES})\n"
+  "  if(NOT TARGET tip_bench_pkg\${_tip_index}::tip_bench_pkg\${_tip_index})\n"
+  "    message(FATAL_ERROR \"tip_bench_pkg\${_tip_index} did not create its imported target\")\n"
+  "  endif()\n"
+  "  if(tip_bench_pkg\${_tip_index}_CONFIG MATCHES \"\\\\.cps$\")\n"
+  "    math(EXPR _tip_cps_loaded \"\${_tip_cps_loaded} + 1\")\n"
+  "  endif()\n"
+  "endforeach()\n"
+  "file(WRITE \"\${CMAKE_BINARY_DIR}/tip-benchmark-markers.txt\" \"find=\${_tip_elapsed}\\ncps_loaded=\${_tip_cps_loaded}\\n\")\n")
+
+_tip_proof_append_toolchain_args(_tip_toolchain_args)
+
+_tip_proof_run_step(
+  NAME
+  "configure producer"
+  COMMAND
+  "${CMAKE_COMMAND}"
+  -S
+  "${_tip_producer_dir}"
+  -B
+  "${_tip_producer_build}"
+  -DCMAKE_BUILD_TYPE=Release
+  ${_tip_toolchain_args})
+_tip_proof_run_step(NAME "build producer" COMMAND "${CMAKE_COMMAND}" --build "${_tip_producer_build}" --config Release --parallel)
+_tip_proof_run_step(
+  NAME
+  "install producer"
+  COMMAND
+  "${CMAKE_COMMAND}"
+  --install
+  "${_tip_producer_build}"
+  --config
+  Release
+  --prefix
+  "${_tip_install_prefix}")
+
+# Every package has a root <package>.cps and one <package>@<config>.cps per installed configuration
+file(GLOB_RECURSE _tip_cps_files RELATIVE "${_tip_install_prefix}" "${_tip_install_prefix}/*.cps")
+set(_tip_cps_root_files ${_tip_cps_files})
+list(FILTER _tip_cps_root_files EXCLUDE REGEX "@[^/]*\\.cps$")
+list(LENGTH _tip_cps_root_files _tip_cps_file_count)
+if(NOT _tip_cps_file_count EQUAL TIP_BENCH_PACKAGES)
+  _tip_bench_fail("Expected ${TIP_BENCH_PACKAGES} installed root .cps files, found ${_tip_cps_file_count}")
+endif()
+
+set(_tip_table "")
+_tip_bench_append_row(
+  _tip_table
+  8
+  entry
+  10
+  packages
+  6
+  cps
+  14
+  find_ms
+  14
+  us/package)
+foreach(_tip_entry IN ITEMS config cps both redirect)
+  set(_tip_prefix "${_tip_case_root}/prefix-${_tip_entry}")
+  file(COPY "${_tip_install_prefix}/" DESTINATION "${_tip_prefix}")
+  if(_tip_entry STREQUAL "config")
+    foreach(_tip_cps_file IN LISTS _tip_cps_files)
+      file(REMOVE "${_tip_prefix}/${_tip_cps_file}")
+    endforeach()
+  elseif(_tip_entry STREQUAL "cps")
+    file(REMOVE_RECURSE "${_tip_prefix}/share/cmake")
+  elseif(_tip_entry STREQUAL "redirect")
+    file(GLOB_RECURSE _tip_targets_files "${_tip_prefix}/share/cmake/*Targets*.cmake")
+    file(REMOVE ${_tip_targets_files})
+  endif()
+  set(_tip_consumer_cmake "${CMAKE_COMMAND}")
+  set(_tip_consumer_args "")
+  if(_tip_entry STREQUAL "config")
+    set(_tip_consumer_cmake "${TIP_BENCH_CONFIG_CMAKE}")
+  elseif(_tip_entry STREQUAL "redirect")
+    set(_tip_consumer_args -DTIP_BENCH_VIA_CONFIG=ON)
+  endif()
+
+  set(_tip_best_find "")
+  foreach(_tip_run RANGE 1 ${TIP_BENCH_REPEAT})
+    set(_tip_consumer_build "${_tip_case_root}/consumer-${_tip_entry}-build")
+    file(REMOVE_RECURSE "${_tip_consumer_build}")
+    _tip_proof_run_step(
+      NAME
+      "configure ${_tip_entry} consumer"
+      COMMAND
+      "${_tip_consumer_cmake}"
+      -S
+      "${_tip_consumer_dir}"
+      -B
+      "${_tip_consumer_build}"
+      "-DCMAKE_PREFIX_PATH=${_tip_prefix}"
+      ${_tip_consumer_args}
+      ${_tip_toolchain_args})
+    _tip_bench_read_markers("${_tip_consumer_build}/tip-benchmark-markers.txt" _tip_markers)
+    if(_tip_best_find STREQUAL "" OR _tip_markers_find LESS _tip_best_find)
+      set(_tip_best_find ${_tip_markers_find})
+    endif()
+  endforeach()
+
+  if(_tip_entry STREQUAL "config" AND NOT _tip_markers_cps_loaded EQUAL 0)
+    _tip_bench_fail("The config prefix loaded ${_tip_markers_cps_loaded} packages from .cps files")
+  elseif(_tip_entry STREQUAL "cps" AND NOT _tip_markers_cps_loaded EQUAL TIP_BENCH_PACKAGES)
+    _tip_bench_fail("The cps prefix loaded only ${_tip_markers_cps_loaded} of ${TIP_BENCH_PACKAGES} packages from .cps files")
+  endif()
+
+  math(EXPR _tip_per_package "${_tip_best_find} / ${TIP_BENCH_PACKAGES}")
+  _tip_bench_format_ms(${_tip_best_find} _tip_find_ms)
+  _tip_bench_append_row(
+    _tip_table
+    8
+    ${_tip_entry}
+    10
+    ${TIP_BENCH_PACKAGES}
+    6
+    ${_tip_markers_cps_loaded}
+    14
+    ${_tip_find_ms}
+    14
+    ${_tip_per_package})
+endforeach()
+
+message(STATUS "[benchmark] find_package() load time of CPS_PRIMARY packages through .cps files and fallback configs (CMake ${CMAKE_VERSION})\n${_tip_table}")
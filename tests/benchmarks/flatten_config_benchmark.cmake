@@ -0,0 +1,153 @@
+cmake_minimum_required(VERSION 3.25)
+
+# find_package() load time of installed packages with and without FLATTEN_CONFIG.
+#
+# Generates a producer project with N static libraries, each exported as its own package, and installs it twice: once
+# with the default layout (<Export>Config.cmake including <Export>Targets.cmake, which globs and includes
+# <Export>Targets-<config>.cmake) and once with FLATTEN_CONFIG, which inlines both into the installed config. A consumer
+# then calls find_package() for every package and times the loop. The benchmark reports the fastest loop for each
+# layout, in total and per package.
+#
+# cmake -DTIP_REPO_ROOT=<repo> [-DTIP_BENCH_ROOT=<work dir>] [options] -P tests/benchmarks/flatten_config_benchmark.cmake
+#
+# Options (all optional):
+#   TIP_BENCH_PACKAGES - Number of packages (default: 150)
+#   TIP_BENCH_REPEAT   - Configure the consumer this many times per layout and keep the fastest run (default: 3)
+
+include("${CMAKE_CURRENT_LIST_DIR}/benchmark_helpers.cmake")
+
+if(NOT DEFINED TIP_REPO_ROOT)
+  _tip_bench_fail("TIP_REPO_ROOT is required")
+endif()
+if(NOT DEFINED TIP_BENCH_ROOT)
+  set(TIP_BENCH_ROOT "${CMAKE_CURRENT_BINARY_DIR}/tip-benchmarks")
+endif()
+if(NOT DEFINED TIP_BENCH_PACKAGES)
+  set(TIP_BENCH_PACKAGES 150)
+endif()
+if(NOT DEFINED TIP_BENCH_REPEAT)
+  set(TIP_BENCH_REPEAT 3)
+endif()
+if(NOT TIP_BENCH_PACKAGES MATCHES "^[1-9][0-9]*$")
+  _tip_bench_fail("TIP_BENCH_PACKAGES must be a positive integer, got '${TIP_BENCH_PACKAGES}'")
+endif()
+if(NOT TIP_BENCH_REPEAT MATCHES "^[1-9][0-9]*$")
+  _tip_bench_fail("TIP_BENCH_REPEAT must be a positive integer, got '${TIP_BENCH_REPEAT}'")
+endif()
+
+set(_tip_case_root "${TIP_BENCH_ROOT}/flatten-config/n${TIP_BENCH_PACKAGES}")
+set(_tip_producer_dir "${_tip_case_root}/producer")
+set(_tip_consumer_dir "${_tip_case_root}/consumer")
+file(REMOVE_RECURSE "${_tip_case_root}")
+
+file(
+  WRITE "${_tip_producer_dir}/CMakeLists.txt"
+  "cmake_minimum_required(VERSION 3.25)\n"
+  "project(tip_flatten_producer VERSION 1.0.0 LANGUAGES C)\n"
+  "set(TARGET_INSTALL_PACKAGE_DISABLE_INSTALL ON)\n"
+  "include(\"${TIP_REPO_ROOT}/cmake/load_target_install_package.cmake\")\n"
+  "set(_tip_flatten_args \"\")\n"
+  "if(TIP_BENCH_FLATTEN)\n"
+  "  set(_tip_flatten_args FLATTEN_CONFIG)\n"
+  "endif()\n"
+  "foreach(_tip_index RANGE 1 ${TIP_BENCH_PACKAGES})\n"
+  "  add_library(tip_bench_pkg\${_tip_index} STATIC lib.c)\n"
+  "  target_install_package(tip_bench_pkg\${_tip_index} \${_tip_flatten_args})\n"
+  "endforeach()\n")
+file(WRITE "${_tip_producer_dir}/lib.c" "int tip_bench_value(void) { return 1; }\n")
+
+# The consumer uses no languages, so the timed loop only loads package files.
+file(
+  WRITE "${_tip_consumer_dir}/CMakeLists.txt"
+  "cmake_minimum_required(VERSION 3.25)\n"
+  "project(tip_flatten_consumer LANGUAGES NONE)\n"
+  "string(TIMESTAMP _tip_begin \"%s%f\" UTC)\n"
+  "foreach(_tip_index RANGE 1 ${TIP_BENCH_PACKAGES})\n"
+  "  find_package(tip_bench_pkg\${_tip_index} 1.0.0 REQUIRED CONFIG)\n"
+  "endforeach()\n"
+  "string(TIMESTAMP _tip_end \"%s%f\" UTC)\n"
+  "math(EXPR _tip_elapsed \"\${_tip_end} - \${_tip_begin}\")\n"
+  "file(WRITE \"\${CMAKE_BINARY_DIR}/tip-benchmark-markers.txt\" \"find=\${_tip_elapsed}\\n\")\n")
+
+_tip_proof_append_toolchain_args(_tip_toolchain_args)
+
+set(_tip_table "")
+_tip_bench_append_row(
+  _tip_table
+  10
+  layout
+  10
+  packages
+  14
+  find_ms
+  14
+  us/package)
+foreach(_tip_layout IN ITEMS default flattened)
+  if(_tip_layout STREQUAL "flattened")
+    set(_tip_flatten ON)
+  else()
+    set(_tip_flatten OFF)
+  endif()
+  set(_tip_producer_build "${_tip_case_root}/producer-${_tip_layout}-build")
+  set(_tip_prefix "${_tip_case_root}/install-${_tip_layout}")
+  _tip_proof_run_step(
+    NAME
+    "configure ${_tip_layout} producer"
+    COMMAND
+    "${CMAKE_COMMAND}"
+    -S
+    "${_tip_producer_dir}"
+    -B
+    "${_tip_producer_build}"
+    -DCMAKE_BUILD_TYPE=Release
+    "-DTIP_BENCH_FLATTEN=${_tip_flatten}"
+    ${_tip_toolchain_args})
+  _tip_proof_run_step(NAME "build ${_tip_layout} producer" COMMAND "${CMAKE_COMMAND}" --build "${_tip_producer_build}" --config Release --parallel)
+  _tip_proof_run_step(
+    NAME
+    "install ${_tip_layout} producer"
+    COMMAND
+    "${CMAKE_COMMAND}"
+    --install
+    "${_tip_producer_build}"
+    --config
+    Release
+    --prefix
+    "${_tip_prefix}")
+
+  set(_tip_best_find "")
+  foreach(_tip_run RANGE 1 ${TIP_BENCH_REPEAT})
+    set(_tip_consumer_build "${_tip_case_root}/consumer-${_tip_layout}-build")
+    file(REMOVE_RECURSE "${_tip_consumer_build}")
+    _tip_proof_run_step(
+      NAME
+      "configure ${_tip_layout} consumer"
+      COMMAND
+      "${CMAKE_COMMAND}"
+      -S
+      "${_tip_consumer_dir}"
+      -B
+      "${_tip_consumer_build}"
+      "-DCMAKE_PREFIX_PATH=${_tip_prefix}"
+      ${_tip_toolchain_args})
+    _tip_bench_read_markers("${_tip_consumer_build}/tip-benchmark-markers.txt" _tip_markers)
+    if(_tip_best_find STREQUAL "" OR _tip_markers_find LESS _tip_best_find)
+      set(_tip_best_find ${_tip_markers_find})
+    endif()
+  endforeach()
+
+  math(EXPR _tip_per_package "${_tip_best_find} / ${TIP_BENCH_PACKAGES}")
+  _tip_bench_format_ms(${_tip_best_find} _tip_find_ms)
+  _tip_bench_append_row(
+    _tip_table
+    10
+    ${_tip_layout}
+    10
+    ${TIP_BENCH_PACKAGES}
+    14
+    ${_tip_find_ms}
+    14
+    ${_tip_per_package})
+endforeach()
+
+message(STATUS "[benchmark] find_package() load time with and without FLATTEN_CONFIG (CMake ${CMAKE_VERSION})\n${_tip_table}")
@@ -0,0 +1,119 @@
+cmake_minimum_required(VERSION 3.25)
+
+# include() cost of the target_install_package helpers in a superbuild.
+#
+# Generates a superbuild with N subprojects added with add_subdirectory(). Every subproject calls project() and includes
+# cmake/load_target_install_package.cmake the way a standalone project would, without registering any targets. The
+# generated project times each include() and the benchmark reports the total, the first include and the mean of the
+# repeated includes. CMake parses a list file completely before it runs the include guard, so every repeated include
+# pays for parsing the whole file.
+#
+# cmake -DTIP_REPO_ROOT=<repo> [-DTIP_BENCH_ROOT=<work dir>] [options] -P tests/benchmarks/include_superbuild_benchmark.cmake
+#
+# Options (all optional):
+#   TIP_BENCH_SUBPROJECTS - Number of subprojects (default: 200)
+#   TIP_BENCH_REPEAT      - Configure this many times and keep the fastest run (default: 3)
+
+include("${CMAKE_CURRENT_LIST_DIR}/benchmark_helpers.cmake")
+
+if(NOT DEFINED TIP_REPO_ROOT)
+  _tip_bench_fail("TIP_REPO_ROOT is required")
+endif()
+if(NOT DEFINED TIP_BENCH_ROOT)
+  set(TIP_BENCH_ROOT "${CMAKE_CURRENT_BINARY_DIR}/tip-benchmarks")
+endif()
+if(NOT DEFINED TIP_BENCH_SUBPROJECTS)
+  set(TIP_BENCH_SUBPROJECTS 200)
+endif()
+if(NOT DEFINED TIP_BENCH_REPEAT)
+  set(TIP_BENCH_REPEAT 3)
+endif()
+if(NOT TIP_BENCH_SUBPROJECTS MATCHES "^[1-9][0-9]*$")
+  _tip_bench_fail("TIP_BENCH_SUBPROJECTS must be a positive integer, got '${TIP_BENCH_SUBPROJECTS}'")
+endif()
+if(NOT TIP_BENCH_REPEAT MATCHES "^[1-9][0-9]*$")
+  _tip_bench_fail("TIP_BENCH_REPEAT must be a positive integer, got '${TIP_BENCH_REPEAT}'")
+endif()
+
+set(_tip_case_root "${TIP_BENCH_ROOT}/include-superbuild/n${TIP_BENCH_SUBPROJECTS}")
+set(_tip_source_dir "${_tip_case_root}/source")
+set(_tip_build_dir "${_tip_case_root}/build")
+file(REMOVE_RECURSE "${_tip_source_dir}")
+
+# The subprojects use no languages, so the measured configure is dominated by the includes.
+set(_tip_top_level
+    "cmake_minimum_required(VERSION 3.25)\n" "project(tip_include_superbuild LANGUAGES NONE)\n" "set_property(GLOBAL PROPERTY TIP_BENCH_INCLUDE_US \"\")\n"
+    "foreach(_tip_index RANGE 1 ${TIP_BENCH_SUBPROJECTS})\n" "  add_subdirectory(sub\${_tip_index})\n" "endforeach()\n"
+    "get_property(_tip_include_us GLOBAL PROPERTY TIP_BENCH_INCLUDE_US)\n" "list(GET _tip_include_us 0 _tip_first_us)\n" "set(_tip_total_us 0)\n"
+    "foreach(_tip_us IN LISTS _tip_include_us)\n" "  math(EXPR _tip_total_us \"\${_tip_total_us} + \${_tip_us}\")\n" "endforeach()\n"
+    "file(WRITE \"\${CMAKE_BINARY_DIR}/tip-benchmark-markers.txt\" \"total=\${_tip_total_us}\\nfirst=\${_tip_first_us}\\n\")\n")
+file(WRITE "${_tip_source_dir}/CMakeLists.txt" ${_tip_top_level})
+foreach(_tip_index RANGE 1 ${TIP_BENCH_SUBPROJECTS})
+  file(
+    WRITE "${_tip_source_dir}/sub${_tip_index}/CMakeLists.txt"
+    "project(tip_include_sub${_tip_index} VERSION 1.0.0 LANGUAGES NONE)\n"
+    "string(TIMESTAMP _tip_begin \"%s%f\" UTC)\n"
+    "include(\"${TIP_REPO_ROOT}/cmake/load_target_install_package.cmake\")\n"
+    "string(TIMESTAMP _tip_end \"%s%f\" UTC)\n"
+    "math(EXPR _tip_elapsed \"\${_tip_end} - \${_tip_begin}\")\n"
+    "set_property(GLOBAL APPEND PROPERTY TIP_BENCH_INCLUDE_US \${_tip_elapsed})\n")
+endforeach()
+
+set(_tip_best_configure "")
+foreach(_tip_run RANGE 1 ${TIP_BENCH_REPEAT})
+  file(REMOVE_RECURSE "${_tip_build_dir}")
+  _tip_bench_run_timed_step(
+    NAME
+    "configure superbuild with ${TIP_BENCH_SUBPROJECTS} subprojects"
+    ELAPSED_US_VARIABLE
+    _tip_configure_us
+    COMMAND
+    "${CMAKE_COMMAND}"
+    -S
+    "${_tip_source_dir}"
+    -B
+    "${_tip_build_dir}")
+  _tip_bench_read_markers("${_tip_build_dir}/tip-benchmark-markers.txt" _tip_markers)
+  if(_tip_best_configure STREQUAL "" OR _tip_markers_total LESS _tip_best_total)
+    set(_tip_best_configure ${_tip_configure_us})
+    set(_tip_best_total ${_tip_markers_total})
+    set(_tip_best_first ${_tip_markers_first})
+  endif()
+endforeach()
+
+set(_tip_repeated_mean 0)
+if(TIP_BENCH_SUBPROJECTS GREATER 1)
+  math(EXPR _tip_repeated_mean "(${_tip_best_total} - ${_tip_best_first}) / (${TIP_BENCH_SUBPROJECTS} - 1)")
+endif()
+_tip_bench_format_ms(${_tip_best_total} _tip_total_ms)
+_tip_bench_format_ms(${_tip_best_first} _tip_first_ms)
+_tip_bench_format_ms(${_tip_repeated_mean} _tip_repeated_ms)
+_tip_bench_format_ms(${_tip_best_configure} _tip_configure_ms)
+
+set(_tip_table "")
+_tip_bench_append_row(
+  _tip_table
+  12
+  subprojects
+  14
+  include_ms
+  14
+  first_ms
+  14
+  repeat_ms
+  14
+  configure_ms)
+_tip_bench_append_row(
+  _tip_table
+  12
+  ${TIP_BENCH_SUBPROJECTS}
+  14
+  ${_tip_total_ms}
+  14
+  ${_tip_first_ms}
+  14
+  ${_tip_repeated_ms}
+  14
+  ${_tip_configure_ms})
+
+message(STATUS "[benchmark] include() cost of load_target_install_package.cmake in a superbuild (CMake ${CMAKE_VERSION})\n${_tip_table}")
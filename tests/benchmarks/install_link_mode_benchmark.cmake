@@ -0,0 +1,147 @@
+cmake_minimum_required(VERSION 3.25)
+
+# Install time of a large staged tree with TIP_INSTALL_LINK_MODE copy, reflink and hardlink.
+#
+# Generates a producer with one static library whose ADDITIONAL_FILES are TIP_BENCH_FILES data files of
+# TIP_BENCH_FILE_KB KiB each in its build tree, standing in for generated artifacts, since hardlink mode never links
+# source files. It builds the producer once per mode and installs it into TIP_BENCH_PREFIXES fresh prefixes, the way a
+# CI job stages the same build for CPack, a container rootfs and a test prefix. The benchmark reports the install time
+# per prefix and how many files were hardlinked or cloned instead of copied. Reflinks need a filesystem that supports
+# them (btrfs, XFS, APFS); elsewhere the reflink mode copies, and its row shows what the fallback costs.
+#
+# cmake -DTIP_REPO_ROOT=<repo> [-DTIP_BENCH_ROOT=<work dir>] [options] -P tests/benchmarks/install_link_mode_benchmark.cmake
+#
+# Options (all optional):
+#   TIP_BENCH_FILES    - Number of data files (default: 64)
+#   TIP_BENCH_FILE_KB  - Size of each data file in KiB (default: 8192, 512 MiB in total)
+#   TIP_BENCH_PREFIXES - Prefixes installed per mode (default: 3)
+#   TIP_BENCH_MODES    - Modes to compare (default: copy,reflink,hardlink)
+
+include("${CMAKE_CURRENT_LIST_DIR}/benchmark_helpers.cmake")
+
+if(NOT DEFINED TIP_REPO_ROOT)
+  _tip_bench_fail("TIP_REPO_ROOT is required")
+endif()
+if(NOT DEFINED TIP_BENCH_ROOT)
+  set(TIP_BENCH_ROOT "${CMAKE_CURRENT_BINARY_DIR}/tip-benchmarks")
+endif()
+if(NOT DEFINED TIP_BENCH_FILES)
+  set(TIP_BENCH_FILES 64)
+endif()
+if(NOT DEFINED TIP_BENCH_FILE_KB)
+  set(TIP_BENCH_FILE_KB 8192)
+endif()
+if(NOT DEFINED TIP_BENCH_PREFIXES)
+  set(TIP_BENCH_PREFIXES 3)
+endif()
+if(NOT DEFINED TIP_BENCH_MODES)
+  set(TIP_BENCH_MODES "copy,reflink,hardlink")
+endif()
+foreach(_tip_option IN ITEMS TIP_BENCH_FILES TIP_BENCH_FILE_KB TIP_BENCH_PREFIXES)
+  if(NOT ${_tip_option} MATCHES "^[1-9][0-9]*$")
+    _tip_bench_fail("${_tip_option} must be a positive integer, got '${${_tip_option}}'")
+  endif()
+endforeach()
+string(REPLACE "," ";" _tip_modes "${TIP_BENCH_MODES}")
+
+set(_tip_case_root "${TIP_BENCH_ROOT}/install-link-mode/n${TIP_BENCH_FILES}-${TIP_BENCH_FILE_KB}k")
+set(_tip_producer_dir "${_tip_case_root}/producer")
+file(REMOVE_RECURSE "${_tip_case_root}")
+
+file(
+  WRITE "${_tip_producer_dir}/CMakeLists.txt"
+  "cmake_minimum_required(VERSION 3.25)\n"
+  "project(tip_link_mode_producer VERSION 1.0.0 LANGUAGES C)\n"
+  "set(TARGET_INSTALL_PACKAGE_DISABLE_INSTALL ON)\n"
+  "include(\"${TIP_REPO_ROOT}/cmake/load_target_install_package.cmake\")\n"
+  "file(COPY \"\${CMAKE_CURRENT_SOURCE_DIR}/data\" DESTINATION \"\${CMAKE_CURRENT_BINARY_DIR}\")\n"
+  "file(GLOB _tip_data_files \"\${CMAKE_CURRENT_BINARY_DIR}/data/*.bin\")\n"
+  "add_library(tip_bench_data STATIC lib.c)\n"
+  "target_install_package(tip_bench_data ADDITIONAL_FILES \${_tip_data_files} ADDITIONAL_FILES_DESTINATION share/tip_bench_data)\n")
+file(WRITE "${_tip_producer_dir}/lib.c" "int tip_bench_value(void) { return 1; }\n")
+
+# One KiB block repeated, with the file index in front so no two files are identical
+string(REPEAT "0123456789abcdef" 64 _tip_block)
+string(REPEAT "${_tip_block}" ${TIP_BENCH_FILE_KB} _tip_payload)
+foreach(_tip_index RANGE 1 ${TIP_BENCH_FILES})
+  file(WRITE "${_tip_producer_dir}/data/model${_tip_index}.bin" "${_tip_index}\n${_tip_payload}")
+endforeach()
+unset(_tip_payload)
+
+_tip_proof_append_toolchain_args(_tip_toolchain_args)
+
+set(_tip_table "")
+_tip_bench_append_row(
+  _tip_table
+  10
+  mode
+  8
+  files
+  10
+  prefixes
+  14
+  install_ms
+  14
+  ms/prefix
+  8
+  linked)
+foreach(_tip_mode IN LISTS _tip_modes)
+  set(_tip_build "${_tip_case_root}/build-${_tip_mode}")
+  _tip_proof_run_step(
+    NAME
+    "configure ${_tip_mode} producer"
+    COMMAND
+    "${CMAKE_COMMAND}"
+    -S
+    "${_tip_producer_dir}"
+    -B
+    "${_tip_build}"
+    -DCMAKE_BUILD_TYPE=Release
+    "-DTIP_INSTALL_LINK_MODE=${_tip_mode}"
+    ${_tip_toolchain_args})
+  _tip_proof_run_step(NAME "build ${_tip_mode} producer" COMMAND "${CMAKE_COMMAND}" --build "${_tip_build}" --config Release)
+
+  set(_tip_total 0)
+  set(_tip_linked 0)
+  foreach(_tip_prefix_index RANGE 1 ${TIP_BENCH_PREFIXES})
+    set(_tip_prefix "${_tip_case_root}/install-${_tip_mode}-${_tip_prefix_index}")
+    _tip_bench_now_us(_tip_begin)
+    execute_process(
+      COMMAND "${CMAKE_COMMAND}" --install "${_tip_build}" --config Release --prefix "${_tip_prefix}"
+      RESULT_VARIABLE _tip_result
+      OUTPUT_VARIABLE _tip_stdout
+      ERROR_VARIABLE _tip_stderr)
+    _tip_bench_now_us(_tip_end)
+    if(NOT _tip_result EQUAL 0)
+      _tip_bench_fail("Install of the ${_tip_mode} producer failed:\n${_tip_stdout}\n${_tip_stderr}")
+    endif()
+    math(EXPR _tip_total "${_tip_total} + ${_tip_end} - ${_tip_begin}")
+    string(REGEX MATCHALL "-- (Hardlinked|Reflinked): " _tip_link_lines "${_tip_stdout}")
+    list(LENGTH _tip_link_lines _tip_link_count)
+    math(EXPR _tip_linked "${_tip_linked} + ${_tip_link_count}")
+  endforeach()
+  # Leave the disk as it was before the next mode
+  file(GLOB _tip_prefixes "${_tip_case_root}/install-${_tip_mode}-*")
+  file(REMOVE_RECURSE ${_tip_prefixes})
+
+  math(EXPR _tip_per_prefix "${_tip_total} / ${TIP_BENCH_PREFIXES}")
+  _tip_bench_format_ms(${_tip_total} _tip_total_ms)
+  _tip_bench_format_ms(${_tip_per_prefix} _tip_per_prefix_ms)
+  _tip_bench_append_row(
+    _tip_table
+    10
+    ${_tip_mode}
+    8
+    ${TIP_BENCH_FILES}
+    10
+    ${TIP_BENCH_PREFIXES}
+    14
+    ${_tip_total_ms}
+    14
+    ${_tip_per_prefix_ms}
+    8
+    ${_tip_linked})
+endforeach()
+
+math(EXPR _tip_total_mib "${TIP_BENCH_FILES} * ${TIP_BENCH_FILE_KB} / 1024")
+message(STATUS "[benchmark] Install time of ${_tip_total_mib} MiB of data files per prefix by TIP_INSTALL_LINK_MODE (CMake ${CMAKE_VERSION})\n${_tip_table}")
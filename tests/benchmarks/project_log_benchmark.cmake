@@ -0,0 +1,114 @@
+cmake_minimum_required(VERSION 3.25)
+
+# Per-call cost of project_log() at the default STATUS log level.
+#
+# Generates a script that calls project_log() and, for reference, message() in tight loops, runs it in a child CMake
+# with its output captured, and reports nanoseconds per call after subtracting the cost of the empty loop. DEBUG and
+# VERBOSE calls are below the active level and dropped; STATUS calls are formatted and printed.
+#
+# cmake -DTIP_REPO_ROOT=<repo> [-DTIP_BENCH_ROOT=<work dir>] [options] -P tests/benchmarks/project_log_benchmark.cmake
+#
+# Options (all optional):
+#   TIP_BENCH_LOG_CALLS  - Calls per case (default: 20000)
+#   TIP_BENCH_LOG_COLORS - Run with PROJECT_LOG_COLORS=ON (default: OFF)
+
+include("${CMAKE_CURRENT_LIST_DIR}/benchmark_helpers.cmake")
+
+if(NOT DEFINED TIP_REPO_ROOT)
+  _tip_bench_fail("TIP_REPO_ROOT is required")
+endif()
+if(NOT DEFINED TIP_BENCH_ROOT)
+  set(TIP_BENCH_ROOT "${CMAKE_CURRENT_BINARY_DIR}/tip-benchmarks")
+endif()
+if(NOT DEFINED TIP_BENCH_LOG_CALLS)
+  set(TIP_BENCH_LOG_CALLS 20000)
+endif()
+if(NOT TIP_BENCH_LOG_CALLS MATCHES "^[1-9][0-9]*$")
+  _tip_bench_fail("TIP_BENCH_LOG_CALLS must be a positive integer, got '${TIP_BENCH_LOG_CALLS}'")
+endif()
+if(TIP_BENCH_LOG_COLORS)
+  set(_tip_colors ON)
+else()
+  set(_tip_colors OFF)
+endif()
+
+set(_tip_case_root "${TIP_BENCH_ROOT}/project-log")
+set(_tip_script "${_tip_case_root}/project_log_calls.cmake")
+set(_tip_result_file "${_tip_case_root}/project_log_calls.txt")
+file(MAKE_DIRECTORY "${_tip_case_root}")
+
+# <name>|<loop body>. "empty" measures the loop itself and is subtracted from the other cases.
+set(_tip_cases
+    "empty|"
+    "project_log_DEBUG|project_log(DEBUG \"  Resolved destination for target\" \${_tip_i})"
+    "project_log_VERBOSE|project_log(VERBOSE \"Target configured for export\" \${_tip_i})"
+    "project_log_STATUS|project_log(STATUS \"Export package is ready\" \${_tip_i})"
+    "message_DEBUG|message(DEBUG \"[bench][DEBUG]  Resolved destination for target \${_tip_i}\")"
+    "message_STATUS|message(STATUS \"[bench][STATUS] Export package is ready \${_tip_i}\")")
+
+set(_tip_body
+    "cmake_minimum_required(VERSION 3.25)\n" "set(PROJECT_NAME bench)\n" "set(PROJECT_LOG_COLORS ${_tip_colors})\n"
+    "include(\"${TIP_REPO_ROOT}/cmake/list_file_include_guard.cmake\")\n" "include(\"${TIP_REPO_ROOT}/cmake/project_log.cmake\")\n"
+    "file(WRITE \"${_tip_result_file}\" \"\")\n")
+foreach(_tip_case IN LISTS _tip_cases)
+  string(FIND "${_tip_case}" "|" _tip_split)
+  string(SUBSTRING "${_tip_case}" 0 ${_tip_split} _tip_case_name)
+  math(EXPR _tip_split "${_tip_split} + 1")
+  string(SUBSTRING "${_tip_case}" ${_tip_split} -1 _tip_case_call)
+  string(
+    APPEND
+    _tip_body
+    "string(TIMESTAMP _tip_begin \"%s%f\" UTC)\n"
+    "foreach(_tip_i RANGE 1 ${TIP_BENCH_LOG_CALLS})\n"
+    "  ${_tip_case_call}\n"
+    "endforeach()\n"
+    "string(TIMESTAMP _tip_end \"%s%f\" UTC)\n"
+    "math(EXPR _tip_elapsed \"\${_tip_end} - \${_tip_begin}\")\n"
+    "file(APPEND \"${_tip_result_file}\" \"${_tip_case_name}=\${_tip_elapsed}\\n\")\n")
+endforeach()
+file(WRITE "${_tip_script}" ${_tip_body})
+
+execute_process(
+  COMMAND "${CMAKE_COMMAND}" -P "${_tip_script}"
+  RESULT_VARIABLE _tip_result
+  OUTPUT_QUIET ERROR_QUIET)
+if(NOT _tip_result EQUAL 0)
+  _tip_bench_fail("project_log benchmark script failed with code ${_tip_result}: ${_tip_script}")
+endif()
+
+_tip_bench_read_markers("${_tip_result_file}" _tip_timing)
+set(_tip_table "")
+_tip_bench_append_row(
+  _tip_table
+  20
+  case
+  10
+  calls
+  12
+  total_ms
+  12
+  ns/call)
+foreach(_tip_case IN LISTS _tip_cases)
+  string(REGEX REPLACE "\\|.*$" "" _tip_case_name "${_tip_case}")
+  if(_tip_case_name STREQUAL "empty")
+    continue()
+  endif()
+  math(EXPR _tip_case_us "${_tip_timing_${_tip_case_name}} - ${_tip_timing_empty}")
+  if(_tip_case_us LESS 0)
+    set(_tip_case_us 0)
+  endif()
+  math(EXPR _tip_ns_per_call "${_tip_case_us} * 1000 / ${TIP_BENCH_LOG_CALLS}")
+  _tip_bench_format_ms(${_tip_case_us} _tip_case_ms)
+  _tip_bench_append_row(
+    _tip_table
+    20
+    ${_tip_case_name}
+    10
+    ${TIP_BENCH_LOG_CALLS}
+    12
+    ${_tip_case_ms}
+    12
+    ${_tip_ns_per_call})
+endforeach()
+
+message(STATUS "[benchmark] project_log() per-call cost at log level STATUS (PROJECT_LOG_COLORS=${_tip_colors}, CMake ${CMAKE_VERSION})\n${_tip_table}")
@@ -0,0 +1,103 @@
+cmake_minimum_required(VERSION 3.25)
+
+include("${CMAKE_CURRENT_LIST_DIR}/proof_helpers.cmake")
+
+if(NOT DEFINED TIP_REPO_ROOT)
+  _tip_proof_fail("TIP_REPO_ROOT is required")
+endif()
+if(NOT DEFINED TIP_PROOF_TEST_ROOT)
+  _tip_proof_fail("TIP_PROOF_TEST_ROOT is required")
+endif()
+
+set(_tip_case_root "${TIP_PROOF_TEST_ROOT}/additional-files-batched")
+set(_tip_source_dir "${_tip_case_root}/source")
+set(_tip_build_dir "${_tip_case_root}/build")
+set(_tip_prefix "${_tip_case_root}/install")
+file(REMOVE_RECURSE "${_tip_case_root}")
+
+# A plain file, a directory, the contents of a directory and a glob pattern, in one ADDITIONAL_FILES list. An existing
+# file with glob characters in its name is that file, not a pattern that would match notes2.txt, and a file named like
+# a field of the target record is an entry like any other.
+file(
+  WRITE "${_tip_source_dir}/CMakeLists.txt"
+  "cmake_minimum_required(VERSION 3.25)\n"
+  "project(proof_additional_files_batched VERSION 1.0.0 LANGUAGES NONE)\n"
+  "set(TARGET_INSTALL_PACKAGE_DISABLE_INSTALL ON)\n"
+  "include(\"${TIP_REPO_ROOT}/cmake/load_target_install_package.cmake\")\n"
+  "add_library(proof_afb INTERFACE)\n"
+  "target_install_package(proof_afb ADDITIONAL_FILES NOTICE.txt ADDITIONAL_FILES_SOURCE_DIR notes[v2].txt models config/ docs/*.md \${PROOF_AFB_EXTRA}\n"
+  "                       ADDITIONAL_FILES_DESTINATION share/proof_afb ADDITIONAL_FILES_COMPONENTS Data)\n")
+file(WRITE "${_tip_source_dir}/NOTICE.txt" "notice\n")
+file(WRITE "${_tip_source_dir}/notes[v2].txt" "notes\n")
+file(WRITE "${_tip_source_dir}/notes2.txt" "other notes\n")
+file(WRITE "${_tip_source_dir}/ADDITIONAL_FILES_SOURCE_DIR" "source dir\n")
+file(WRITE "${_tip_source_dir}/models/base.bin" "base\n")
+file(WRITE "${_tip_source_dir}/models/large/tuned.bin" "tuned\n")
+file(WRITE "${_tip_source_dir}/models/v[2]/next.bin" "next\n")
+file(WRITE "${_tip_source_dir}/config/app.ini" "app\n")
+file(WRITE "${_tip_source_dir}/config/nested/extra.ini" "extra\n")
+file(WRITE "${_tip_source_dir}/docs/readme.md" "readme\n")
+file(WRITE "${_tip_source_dir}/docs/skip.txt" "skip\n")
+
+_tip_proof_expect_failure(
+  NAME
+  "pattern without matches"
+  COMMAND
+  "${CMAKE_COMMAND}"
+  -S
+  "${_tip_source_dir}"
+  -B
+  "${_tip_case_root}/invalid-build"
+  "-DPROOF_AFB_EXTRA=missing/*.bin"
+  EXPECT_CONTAINS
+  "matched nothing")
+
+# A relative entry with a colon in its first component is below the source directory too.
+set(_tip_extra_args "")
+if(NOT WIN32)
+  file(WRITE "${_tip_source_dir}/notes:v3.txt" "notes\n")
+  set(_tip_extra_args "-DPROOF_AFB_EXTRA=notes:v3.txt")
+endif()
+_tip_proof_run_step(NAME "configure" COMMAND "${CMAKE_COMMAND}" -S "${_tip_source_dir}" -B "${_tip_build_dir}" ${_tip_extra_args})
+_tip_proof_run_step(NAME "install" COMMAND "${CMAKE_COMMAND}" --install "${_tip_build_dir}" --prefix "${_tip_prefix}" --component Data)
+
+foreach(
+  _tip_installed IN
+  ITEMS NOTICE.txt
+        ADDITIONAL_FILES_SOURCE_DIR
+        "notes[v2].txt"
+        readme.md
+        app.ini
+        nested/extra.ini
+        models/base.bin
+        models/large/tuned.bin
+        "models/v[2]/next.bin")
+  _tip_proof_assert_exists("${_tip_prefix}/share/proof_afb/${_tip_installed}")
+endforeach()
+_tip_proof_assert_not_exists("${_tip_prefix}/share/proof_afb/skip.txt")
+_tip_proof_assert_not_exists("${_tip_prefix}/share/proof_afb/notes2.txt")
+if(NOT WIN32)
+  _tip_proof_assert_exists("${_tip_prefix}/share/proof_afb/notes:v3.txt")
+endif()
+_tip_proof_assert_not_exists("${_tip_prefix}/share/proof_afb/config")
+
+# One install rule per destination directory: the plain file, the pattern match and the top of config/ share one.
+file(READ "${_tip_build_dir}/cmake_install.cmake" _tip_install_script)
+string(REGEX MATCHALL "file\\(INSTALL DESTINATION \"\\\${CMAKE_INSTALL_PREFIX}/share/proof_afb\" " _tip_top_rules "${_tip_install_script}")
+list(LENGTH _tip_top_rules _tip_top_rule_count)
+if(NOT _tip_top_rule_count EQUAL 1)
+  _tip_proof_fail("Expected one install rule for share/proof_afb, found ${_tip_top_rule_count}:\n${_tip_install_script}")
+endif()
+string(REGEX MATCHALL "file\\(INSTALL DESTINATION \"\\\${CMAKE_INSTALL_PREFIX}/share/proof_afb[^\"]*\"" _tip_rules "${_tip_install_script}")
+list(LENGTH _tip_rules _tip_rule_count)
+if(NOT _tip_rule_count EQUAL 5)
+  _tip_proof_fail("Expected five additional file install rules, found ${_tip_rule_count}: ${_tip_rules}")
+endif()
+
+# Files added to a directory are picked up by the next build.
+file(WRITE "${_tip_source_dir}/models/large/added.bin" "added\n")
+_tip_proof_run_step(NAME "build" COMMAND "${CMAKE_COMMAND}" --build "${_tip_build_dir}")
+_tip_proof_run_step(NAME "reinstall" COMMAND "${CMAKE_COMMAND}" --install "${_tip_build_dir}" --prefix "${_tip_prefix}" --component Data)
+_tip_proof_assert_exists("${_tip_prefix}/share/proof_afb/models/large/added.bin")
+
+message(STATUS "[proof] Batched additional files proof passed.")
@@ -0,0 +1,133 @@
+cmake_minimum_required(VERSION 3.25)
+
+include("${CMAKE_CURRENT_LIST_DIR}/proof_helpers.cmake")
+
+if(NOT DEFINED TIP_REPO_ROOT)
+  _tip_proof_fail("TIP_REPO_ROOT is required")
+endif()
+if(NOT DEFINED TIP_PROOF_TEST_ROOT)
+  _tip_proof_fail("TIP_PROOF_TEST_ROOT is required")
+endif()
+
+set(_tip_case_root "${TIP_PROOF_TEST_ROOT}/build-tree-export")
+set(_tip_dep_prefix "${_tip_case_root}/dep-install")
+set(_tip_pkg_source "${_tip_case_root}/proof_bt_pkg")
+set(_tip_pkg_build "${_tip_case_root}/proof_bt_pkg-build")
+set(_tip_consumer_source "${_tip_case_root}/consumer")
+set(_tip_consumer_build "${_tip_case_root}/consumer-build")
+file(REMOVE_RECURSE "${_tip_case_root}")
+
+_tip_proof_append_toolchain_args(_tip_toolchain_args)
+
+# proof_bt_dep is installed as usual; proof_bt_pkg is only built, never installed.
+file(
+  WRITE "${_tip_case_root}/proof_bt_dep/CMakeLists.txt"
+  "cmake_minimum_required(VERSION 3.25)\n"
+  "project(proof_bt_dep VERSION 1.0.0 LANGUAGES NONE)\n"
+  "set(TARGET_INSTALL_PACKAGE_DISABLE_INSTALL ON)\n"
+  "include(\"${TIP_REPO_ROOT}/cmake/load_target_install_package.cmake\")\n"
+  "add_library(proof_bt_dep INTERFACE)\n"
+  "target_compile_definitions(proof_bt_dep INTERFACE PROOF_BT_DEP_LINKED=1)\n"
+  "target_install_package(proof_bt_dep)\n")
+_tip_proof_run_step(
+  NAME
+  "dep-configure"
+  COMMAND
+  "${CMAKE_COMMAND}"
+  -S
+  "${_tip_case_root}/proof_bt_dep"
+  -B
+  "${_tip_case_root}/proof_bt_dep/build"
+  ${_tip_toolchain_args})
+_tip_proof_run_step(NAME "dep-install" COMMAND "${CMAKE_COMMAND}" --install "${_tip_case_root}/proof_bt_dep/build" --prefix "${_tip_dep_prefix}")
+
+file(
+  WRITE "${_tip_pkg_source}/CMakeLists.txt"
+  "cmake_minimum_required(VERSION 3.25)\n"
+  "project(proof_bt_pkg VERSION 1.0.0 LANGUAGES C)\n"
+  "set(TARGET_INSTALL_PACKAGE_DISABLE_INSTALL ON)\n"
+  "include(\"${TIP_REPO_ROOT}/cmake/load_target_install_package.cmake\")\n"
+  "find_package(proof_bt_dep 1.0 REQUIRED)\n"
+  "add_library(proof_bt_pkg STATIC value.c)\n"
+  "target_sources(proof_bt_pkg PUBLIC FILE_SET HEADERS BASE_DIRS include FILES include/proof_bt_pkg.h)\n"
+  "target_link_libraries(proof_bt_pkg PUBLIC proof_bt_dep::proof_bt_dep)\n"
+  "target_install_package(proof_bt_pkg BUILD_TREE_EXPORT BAKE_DEPENDENCY_HINTS PUBLIC_DEPENDENCIES \"proof_bt_dep 1.0 REQUIRED\"\n"
+  "                       INCLUDE_ON_FIND_PACKAGE proof_bt_pkg-extra.cmake)\n")
+file(WRITE "${_tip_pkg_source}/include/proof_bt_pkg.h" "int proof_bt_value(void);\n")
+file(WRITE "${_tip_pkg_source}/value.c" "int proof_bt_value(void) { return 1; }\n")
+file(WRITE "${_tip_pkg_source}/proof_bt_pkg-extra.cmake" "set(proof_bt_pkg_EXTRA_LOADED TRUE)\n")
+_tip_proof_run_step(
+  NAME
+  "pkg-configure"
+  COMMAND
+  "${CMAKE_COMMAND}"
+  -S
+  "${_tip_pkg_source}"
+  -B
+  "${_tip_pkg_build}"
+  "-DCMAKE_PREFIX_PATH=${_tip_dep_prefix}"
+  ${_tip_toolchain_args})
+_tip_proof_run_step(NAME "pkg-build" COMMAND "${CMAKE_COMMAND}" --build "${_tip_pkg_build}")
+
+# The build-tree package mirrors the install layout and bakes the absolute directory of proof_bt_dep.
+set(_tip_build_tree_dir "${_tip_pkg_build}/share/cmake/proof_bt_pkg")
+foreach(_tip_file IN ITEMS proof_bt_pkgConfig.cmake proof_bt_pkgConfigVersion.cmake proof_bt_pkgTargets.cmake proof_bt_pkg-extra.cmake tip_find_package_profile.cmake)
+  _tip_proof_assert_exists("${_tip_build_tree_dir}/${_tip_file}")
+endforeach()
+_tip_proof_assert_file_contains("${_tip_build_tree_dir}/proof_bt_pkgConfig.cmake" "set(proof_bt_dep_DIR \"${_tip_dep_prefix}/share/cmake/proof_bt_dep\")")
+_tip_proof_assert_file_contains("${_tip_build_tree_dir}/proof_bt_pkgTargets.cmake" "${_tip_pkg_source}/include")
+_tip_proof_assert_file_not_contains("${_tip_pkg_build}/proof_bt_pkgConfig.cmake" "${_tip_dep_prefix}")
+
+# The consumer only knows the build-tree package directory; proof_bt_dep is found through the baked directory.
+file(
+  WRITE "${_tip_consumer_source}/CMakeLists.txt"
+  "cmake_minimum_required(VERSION 3.25)\n"
+  "project(proof_bt_consumer LANGUAGES C)\n"
+  "find_package(proof_bt_pkg 1.0 REQUIRED)\n"
+  "if(NOT proof_bt_pkg_EXTRA_LOADED)\n"
+  "  message(FATAL_ERROR \"Expected proof_bt_pkg-extra.cmake to be loaded\")\n"
+  "endif()\n"
+  "add_executable(proof_bt_consumer main.c)\n"
+  "target_link_libraries(proof_bt_consumer PRIVATE proof_bt_pkg::proof_bt_pkg)\n"
+  "file(GENERATE OUTPUT \"\${CMAKE_BINARY_DIR}/consumer-path.txt\" CONTENT \"$<TARGET_FILE:proof_bt_consumer>\")\n")
+file(
+  WRITE "${_tip_consumer_source}/main.c"
+  "#include <stdio.h>\n"
+  "#include <proof_bt_pkg.h>\n"
+  "#ifndef PROOF_BT_DEP_LINKED\n"
+  "#error proof_bt_dep usage requirements are missing\n"
+  "#endif\n"
+  "int main(void) { printf(\"%d\\n\", proof_bt_value()); return 0; }\n")
+_tip_proof_run_step(
+  NAME
+  "consumer-configure"
+  COMMAND
+  "${CMAKE_COMMAND}"
+  -S
+  "${_tip_consumer_source}"
+  -B
+  "${_tip_consumer_build}"
+  "-Dproof_bt_pkg_DIR=${_tip_build_tree_dir}"
+  ${_tip_toolchain_args})
+
+function(_tip_assert_consumer_output expected)
+  _tip_proof_run_step(NAME "consumer-build" COMMAND "${CMAKE_COMMAND}" --build "${_tip_consumer_build}")
+  file(READ "${_tip_consumer_build}/consumer-path.txt" _tip_consumer_path)
+  execute_process(
+    COMMAND "${_tip_consumer_path}"
+    RESULT_VARIABLE _tip_result
+    OUTPUT_VARIABLE _tip_output
+    OUTPUT_STRIP_TRAILING_WHITESPACE)
+  if(NOT _tip_result EQUAL 0 OR NOT _tip_output STREQUAL "${expected}")
+    _tip_proof_fail("Expected the consumer to print '${expected}', got '${_tip_output}' (exit code ${_tip_result})")
+  endif()
+endfunction()
+
+_tip_assert_consumer_output(1)
+
+# A rebuild of the producer reaches the consumer without an install step.
+file(WRITE "${_tip_pkg_source}/value.c" "int proof_bt_value(void) { return 2; }\n")
+_tip_proof_run_step(NAME "pkg-rebuild" COMMAND "${CMAKE_COMMAND}" --build "${_tip_pkg_build}")
+_tip_assert_consumer_output(2)
+
+message(STATUS "[proof] Build-tree export proof passed.")
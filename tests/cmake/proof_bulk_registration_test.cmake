@@ -0,0 +1,167 @@
+cmake_minimum_required(VERSION 3.25)
+
+include("${CMAKE_CURRENT_LIST_DIR}/proof_helpers.cmake")
+
+if(NOT DEFINED TIP_REPO_ROOT)
+  _tip_proof_fail("TIP_REPO_ROOT is required")
+endif()
+if(NOT DEFINED TIP_PROOF_TEST_ROOT)
+  _tip_proof_fail("TIP_PROOF_TEST_ROOT is required")
+endif()
+
+set(_tip_case_root "${TIP_PROOF_TEST_ROOT}/bulk-registration")
+file(REMOVE_RECURSE "${_tip_case_root}")
+
+_tip_proof_append_toolchain_args(_tip_toolchain_args)
+
+set(_tip_shared_options "EXPORT_NAME proof_bulk_pkg NAMESPACE Bulk:: VERSION 2.3.4 PUBLIC_DEPENDENCIES \"Threads REQUIRED\" COMPONENT_DEPENDENCIES Tools \"Threads REQUIRED\"")
+
+# The same project registered with one target_install_package() call per target and with one target_install_packages() call.
+set(_tip_separate_registration
+    "target_install_package(proof_bulk_core ${_tip_shared_options})\n"
+    "target_install_package(proof_bulk_shared ${_tip_shared_options})\n"
+    "target_install_package(proof_bulk_headers ${_tip_shared_options} ADDITIONAL_FILES docs/notes.txt ADDITIONAL_FILES_DESTINATION share/doc/proof_bulk)\n"
+    "target_install_package(proof_bulk_tool ${_tip_shared_options} COMPONENT Tools ALIAS_NAME cli)\n")
+set(_tip_bulk_registration
+    "target_install_packages(\n" "  TARGETS proof_bulk_core proof_bulk_shared proof_bulk_headers proof_bulk_tool\n" "  ${_tip_shared_options}\n"
+    "  TARGET proof_bulk_headers ADDITIONAL_FILES docs/notes.txt ADDITIONAL_FILES_DESTINATION share/doc/proof_bulk\n" "  TARGET proof_bulk_tool COMPONENT Tools ALIAS_NAME cli)\n")
+
+function(_tip_write_bulk_fixture source_dir)
+  file(MAKE_DIRECTORY "${source_dir}/src" "${source_dir}/include/proof_bulk" "${source_dir}/docs")
+  string(CONCAT _tip_registration ${ARGN})
+  file(
+    WRITE "${source_dir}/CMakeLists.txt"
+    "cmake_minimum_required(VERSION 3.25)\n"
+    "project(proof_bulk_registration VERSION 2.3.4 LANGUAGES CXX)\n"
+    "set(TARGET_INSTALL_PACKAGE_DISABLE_INSTALL ON)\n"
+    "include(\"${TIP_REPO_ROOT}/cmake/load_target_install_package.cmake\")\n"
+    "add_library(proof_bulk_core STATIC src/core.cpp)\n"
+    "target_sources(proof_bulk_core PUBLIC FILE_SET HEADERS BASE_DIRS include FILES include/proof_bulk/core.h)\n"
+    "add_library(proof_bulk_shared SHARED src/shared.cpp)\n"
+    "add_library(proof_bulk_headers INTERFACE)\n"
+    "target_sources(proof_bulk_headers INTERFACE FILE_SET HEADERS BASE_DIRS include FILES include/proof_bulk/headers.h)\n"
+    "add_executable(proof_bulk_tool src/tool.cpp)\n"
+    "target_link_libraries(proof_bulk_tool PRIVATE proof_bulk_core)\n"
+    "${_tip_registration}")
+  file(WRITE "${source_dir}/include/proof_bulk/core.h" "int proof_bulk_core_value();\n")
+  file(WRITE "${source_dir}/include/proof_bulk/headers.h" "inline int proof_bulk_header_value() { return 5; }\n")
+  file(WRITE "${source_dir}/src/core.cpp" "int proof_bulk_core_value() { return 3; }\n")
+  file(WRITE "${source_dir}/src/shared.cpp" "int proof_bulk_shared_value() { return 4; }\n")
+  file(WRITE "${source_dir}/src/tool.cpp" "int proof_bulk_core_value(); int main() { return proof_bulk_core_value() == 3 ? 0 : 1; }\n")
+  file(WRITE "${source_dir}/docs/notes.txt" "bulk registration notes\n")
+endfunction()
+
+function(_tip_configure_and_install_bulk_fixture variant)
+  set(_tip_source_dir "${_tip_case_root}/${variant}-src")
+  set(_tip_build_dir "${_tip_case_root}/${variant}-build")
+  set(_tip_install_prefix "${_tip_case_root}/${variant}-install")
+  _tip_proof_run_step(
+    NAME
+    "${variant}-configure"
+    COMMAND
+    "${CMAKE_COMMAND}"
+    -S
+    "${_tip_source_dir}"
+    -B
+    "${_tip_build_dir}"
+    "-DCMAKE_BUILD_TYPE=Release"
+    ${_tip_toolchain_args})
+  _tip_proof_run_step(
+    NAME
+    "${variant}-build"
+    COMMAND
+    "${CMAKE_COMMAND}"
+    --build
+    "${_tip_build_dir}"
+    --config
+    Release)
+  _tip_proof_run_step(
+    NAME
+    "${variant}-install"
+    COMMAND
+    "${CMAKE_COMMAND}"
+    --install
+    "${_tip_build_dir}"
+    --config
+    Release
+    --prefix
+    "${_tip_install_prefix}")
+endfunction()
+
+# Read a generated text file with the variant's absolute case paths replaced by a fixed token.
+function(_tip_read_normalized_bulk_file variant path out_var)
+  file(READ "${path}" _tip_content)
+  string(REPLACE "${_tip_case_root}/${variant}-" "<case>/" _tip_content "${_tip_content}")
+  set(${out_var}
+      "${_tip_content}"
+      PARENT_SCOPE)
+endfunction()
+
+function(_tip_assert_bulk_trees_match relative_root glob)
+  file(
+    GLOB_RECURSE _tip_separate_files
+    RELATIVE "${_tip_case_root}/separate-${relative_root}"
+    "${_tip_case_root}/separate-${relative_root}/${glob}")
+  file(
+    GLOB_RECURSE _tip_bulk_files
+    RELATIVE "${_tip_case_root}/bulk-${relative_root}"
+    "${_tip_case_root}/bulk-${relative_root}/${glob}")
+  list(SORT _tip_separate_files)
+  list(SORT _tip_bulk_files)
+  if(NOT _tip_separate_files STREQUAL _tip_bulk_files)
+    _tip_proof_fail("File lists differ under '${relative_root}/${glob}'.\n  separate: ${_tip_separate_files}\n  bulk: ${_tip_bulk_files}")
+  endif()
+  if(NOT _tip_separate_files)
+    _tip_proof_fail("Expected files matching '${relative_root}/${glob}'")
+  endif()
+
+  foreach(_tip_file IN LISTS _tip_separate_files)
+    if(NOT _tip_file MATCHES "\\.(cmake|h|txt)$")
+      continue()
+    endif()
+    _tip_read_normalized_bulk_file(separate "${_tip_case_root}/separate-${relative_root}/${_tip_file}" _tip_separate_content)
+    _tip_read_normalized_bulk_file(bulk "${_tip_case_root}/bulk-${relative_root}/${_tip_file}" _tip_bulk_content)
+    if(NOT _tip_separate_content STREQUAL _tip_bulk_content)
+      _tip_proof_fail("'${relative_root}/${_tip_file}' differs between separate and bulk registration")
+    endif()
+  endforeach()
+endfunction()
+
+_tip_write_bulk_fixture("${_tip_case_root}/separate-src" ${_tip_separate_registration})
+_tip_write_bulk_fixture("${_tip_case_root}/bulk-src" ${_tip_bulk_registration})
+_tip_configure_and_install_bulk_fixture(separate)
+_tip_configure_and_install_bulk_fixture(bulk)
+
+_tip_assert_bulk_trees_match(build "cmake_install.cmake")
+_tip_assert_bulk_trees_match(install "*")
+_tip_proof_assert_file_contains("${_tip_case_root}/bulk-install/share/cmake/proof_bulk_pkg/proof_bulk_pkgTargets.cmake" "Bulk::cli")
+_tip_proof_assert_exists("${_tip_case_root}/bulk-install/share/doc/proof_bulk/notes.txt")
+
+# Invalid bulk calls fail at configure time.
+set(_tip_invalid_cases
+    "unknown-override-target|TARGETS proof_bulk_core EXPORT_NAME proof_bulk_pkg TARGET proof_bulk_tool COMPONENT Tools|listed"
+    "shared-alias|TARGETS proof_bulk_core proof_bulk_tool EXPORT_NAME proof_bulk_pkg ALIAS_NAME cli|single"
+    "export-level-override|TARGETS proof_bulk_core EXPORT_NAME proof_bulk_pkg TARGET proof_bulk_core VERSION 1.0.0|Per-target"
+    "missing-export-name|TARGETS proof_bulk_core|EXPORT_NAME.")
+foreach(_tip_invalid_case IN LISTS _tip_invalid_cases)
+  string(REPLACE "|" ";" _tip_invalid_case "${_tip_invalid_case}")
+  list(GET _tip_invalid_case 0 _tip_invalid_name)
+  list(GET _tip_invalid_case 1 _tip_invalid_arguments)
+  list(GET _tip_invalid_case 2 _tip_invalid_message)
+  set(_tip_invalid_source_dir "${_tip_case_root}/invalid-${_tip_invalid_name}-src")
+  _tip_write_bulk_fixture("${_tip_invalid_source_dir}" "target_install_packages(${_tip_invalid_arguments})\n")
+  _tip_proof_expect_failure(
+    NAME
+    "invalid-${_tip_invalid_name}"
+    COMMAND
+    "${CMAKE_COMMAND}"
+    -S
+    "${_tip_invalid_source_dir}"
+    -B
+    "${_tip_case_root}/invalid-${_tip_invalid_name}-build"
+    ${_tip_toolchain_args}
+    EXPECT_CONTAINS
+    "${_tip_invalid_message}")
+endforeach()
+
+message(STATUS "[proof] Bulk registration proof passed.")
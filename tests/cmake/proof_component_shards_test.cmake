@@ -0,0 +1,137 @@
+cmake_minimum_required(VERSION 3.25)
+
+include("${CMAKE_CURRENT_LIST_DIR}/proof_helpers.cmake")
+
+if(NOT DEFINED TIP_REPO_ROOT)
+  _tip_proof_fail("TIP_REPO_ROOT is required")
+endif()
+if(NOT DEFINED TIP_PROOF_TEST_ROOT)
+  _tip_proof_fail("TIP_PROOF_TEST_ROOT is required")
+endif()
+
+set(_tip_case_root "${TIP_PROOF_TEST_ROOT}/component-shards")
+set(_tip_source_dir "${_tip_case_root}/src")
+set(_tip_install_prefix "${_tip_case_root}/install")
+file(REMOVE_RECURSE "${_tip_case_root}")
+
+# One export with a component-less utility target and three components: net links core privately, io stands alone.
+file(
+  WRITE "${_tip_source_dir}/CMakeLists.txt"
+  "cmake_minimum_required(VERSION 3.25)\n"
+  "project(proof_shards VERSION 1.0.0 LANGUAGES CXX)\n"
+  "set(TARGET_INSTALL_PACKAGE_DISABLE_INSTALL ON)\n"
+  "include(\"${TIP_REPO_ROOT}/cmake/load_target_install_package.cmake\")\n"
+  "add_library(shard_util INTERFACE)\n"
+  "add_library(shard_core STATIC core.cpp)\n"
+  "add_library(shard_net STATIC net.cpp)\n"
+  "add_library(proof_shards::core ALIAS shard_core)\n"
+  "target_link_libraries(shard_net PRIVATE proof_shards::core)\n"
+  "add_library(shard_io STATIC io.cpp)\n"
+  "target_install_packages(TARGETS shard_util shard_core shard_net shard_io EXPORT_NAME proof_shards NAMESPACE proof_shards:: SHARD_BY_COMPONENT\n"
+  "  TARGET shard_core COMPONENT core TARGET shard_net COMPONENT net TARGET shard_io COMPONENT io)\n")
+file(WRITE "${_tip_source_dir}/core.cpp" "int shard_core_value() { return 1; }\n")
+file(WRITE "${_tip_source_dir}/net.cpp" "int shard_core_value();\nint shard_net_value() { return shard_core_value() + 1; }\n")
+file(WRITE "${_tip_source_dir}/io.cpp" "int shard_io_value() { return 3; }\n")
+
+_tip_proof_append_toolchain_args(_tip_toolchain_args)
+
+_tip_proof_run_step(
+  NAME
+  "configure"
+  COMMAND
+  "${CMAKE_COMMAND}"
+  -S
+  "${_tip_source_dir}"
+  -B
+  "${_tip_case_root}/build"
+  -DCMAKE_BUILD_TYPE=Release
+  ${_tip_toolchain_args})
+_tip_proof_run_step(NAME "build" COMMAND "${CMAKE_COMMAND}" --build "${_tip_case_root}/build" --config Release)
+_tip_proof_run_step(
+  NAME
+  "install"
+  COMMAND
+  "${CMAKE_COMMAND}"
+  --install
+  "${_tip_case_root}/build"
+  --config
+  Release
+  --prefix
+  "${_tip_install_prefix}")
+
+set(_tip_package_dir "${_tip_install_prefix}/share/cmake/proof_shards")
+foreach(_tip_shard_file IN ITEMS proof_shardsTargets.cmake proof_shards-Targets.cmake proof_shards-coreTargets.cmake proof_shards-netTargets.cmake proof_shards-ioTargets.cmake)
+  _tip_proof_assert_exists("${_tip_package_dir}/${_tip_shard_file}")
+endforeach()
+_tip_proof_assert_file_contains("${_tip_package_dir}/proof_shards-netTargets.cmake" "proof_shards::shard_core")
+
+# Each consumer lists the components it requests, the targets it expects and the targets it must not see.
+function(_tip_configure_shard_consumer name find_args present absent)
+  set(_tip_consumer_dir "${_tip_case_root}/consumer-${name}")
+  file(
+    WRITE "${_tip_consumer_dir}/CMakeLists.txt"
+    "cmake_minimum_required(VERSION 3.25)\n"
+    "project(proof_shards_consumer LANGUAGES CXX)\n"
+    "find_package(proof_shards 1.0 REQUIRED ${find_args})\n"
+    "foreach(_proof_target IN ITEMS ${present})\n"
+    "  if(NOT TARGET proof_shards::\${_proof_target})\n"
+    "    message(FATAL_ERROR \"Expected proof_shards::\${_proof_target}\")\n"
+    "  endif()\n"
+    "endforeach()\n"
+    "foreach(_proof_target IN ITEMS ${absent})\n"
+    "  if(TARGET proof_shards::\${_proof_target})\n"
+    "    message(FATAL_ERROR \"Did not expect proof_shards::\${_proof_target}\")\n"
+    "  endif()\n"
+    "endforeach()\n"
+    "if(DEFINED _tip_component_shards)\n"
+    "  message(FATAL_ERROR \"Shard loader leaked _tip_component_shards\")\n"
+    "endif()\n"
+    "add_executable(proof_shards_consumer main.cpp)\n"
+    "target_link_libraries(proof_shards_consumer PRIVATE proof_shards::shard_util ${ARGN})\n")
+  file(WRITE "${_tip_consumer_dir}/main.cpp" "int main() { return 0; }\n")
+  _tip_proof_run_step(
+    NAME
+    "consumer-${name}-configure"
+    COMMAND
+    "${CMAKE_COMMAND}"
+    -S
+    "${_tip_consumer_dir}"
+    -B
+    "${_tip_consumer_dir}/build"
+    "-DCMAKE_PREFIX_PATH=${_tip_install_prefix}"
+    -DCMAKE_BUILD_TYPE=Release
+    ${_tip_toolchain_args})
+  _tip_proof_run_step(NAME "consumer-${name}-build" COMMAND "${CMAKE_COMMAND}" --build "${_tip_consumer_dir}/build" --config Release)
+endfunction()
+
+# net pulls in core because it links to it; io stays unloaded.
+_tip_configure_shard_consumer(net "COMPONENTS net" "shard_util;shard_core;shard_net" "shard_io" proof_shards::shard_net)
+_tip_configure_shard_consumer(io "COMPONENTS io" "shard_util;shard_io" "shard_core;shard_net" proof_shards::shard_io)
+# Without COMPONENTS every shard is loaded.
+_tip_configure_shard_consumer(all "" "shard_util;shard_core;shard_net;shard_io" "" proof_shards::shard_net proof_shards::shard_io)
+
+# Components whose targets link to each other cannot be loaded separately.
+file(
+  WRITE "${_tip_case_root}/cycle/CMakeLists.txt"
+  "cmake_minimum_required(VERSION 3.25)\n"
+  "project(proof_shards_cycle VERSION 1.0.0 LANGUAGES NONE)\n"
+  "set(TARGET_INSTALL_PACKAGE_DISABLE_INSTALL ON)\n"
+  "include(\"${TIP_REPO_ROOT}/cmake/load_target_install_package.cmake\")\n"
+  "add_library(cycle_a INTERFACE)\n"
+  "add_library(cycle_b INTERFACE)\n"
+  "target_link_libraries(cycle_a INTERFACE cycle_b)\n"
+  "target_link_libraries(cycle_b INTERFACE cycle_a)\n"
+  "target_install_packages(TARGETS cycle_a cycle_b EXPORT_NAME proof_shards_cycle SHARD_BY_COMPONENT TARGET cycle_a COMPONENT a TARGET cycle_b COMPONENT b)\n")
+_tip_proof_expect_failure(
+  NAME
+  "cycle"
+  EXPECT_CONTAINS
+  "link to each other in a cycle"
+  COMMAND
+  "${CMAKE_COMMAND}"
+  -S
+  "${_tip_case_root}/cycle"
+  -B
+  "${_tip_case_root}/cycle-build")
+
+message(STATUS "[proof] Component shards proof passed.")
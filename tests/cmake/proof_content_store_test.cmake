@@ -0,0 +1,138 @@
+cmake_minimum_required(VERSION 3.25)
+
+include("${CMAKE_CURRENT_LIST_DIR}/proof_helpers.cmake")
+
+if(NOT DEFINED TIP_REPO_ROOT)
+  _tip_proof_fail("TIP_REPO_ROOT is required")
+endif()
+if(NOT DEFINED TIP_PROOF_TEST_ROOT)
+  _tip_proof_fail("TIP_PROOF_TEST_ROOT is required")
+endif()
+
+set(_tip_case_root "${TIP_PROOF_TEST_ROOT}/content-store")
+set(_tip_sdk_root "${_tip_case_root}/sdk")
+set(_tip_store "${_tip_sdk_root}/.tip-store")
+file(REMOVE_RECURSE "${_tip_case_root}")
+
+_tip_proof_append_toolchain_args(_tip_toolchain_args)
+
+# Two versions of one SDK: the data file and one header are the same in both, the version header is not.
+function(_tip_proof_write_version VERSION)
+  set(_tip_source_dir "${_tip_case_root}/source-${VERSION}")
+  file(
+    WRITE "${_tip_source_dir}/CMakeLists.txt"
+    "cmake_minimum_required(VERSION 3.25)\n"
+    "project(proof_content_store VERSION ${VERSION} LANGUAGES C)\n"
+    "set(TARGET_INSTALL_PACKAGE_DISABLE_INSTALL ON)\n"
+    "include(\"${TIP_REPO_ROOT}/cmake/load_target_install_package.cmake\")\n"
+    "add_library(proof_cs SHARED cs.c)\n"
+    "target_sources(proof_cs PUBLIC FILE_SET HEADERS BASE_DIRS include FILES include/proof_cs/cs.h include/proof_cs/version.h)\n"
+    "target_install_package(proof_cs LAYOUT content_store ADDITIONAL_FILES data/model.bin ADDITIONAL_FILES_DESTINATION share/proof_cs)\n"
+    "if(PROOF_CS_MIXED)\n"
+    "  add_library(proof_cs_extra INTERFACE)\n"
+    "  target_install_package(proof_cs_extra EXPORT_NAME proof_cs LAYOUT fhs)\n"
+    "endif()\n")
+  file(WRITE "${_tip_source_dir}/include/proof_cs/cs.h" "int proof_cs(void);\n")
+  file(WRITE "${_tip_source_dir}/include/proof_cs/version.h" "#define PROOF_CS_VERSION \"${VERSION}\"\n")
+  file(WRITE "${_tip_source_dir}/cs.c" "int proof_cs(void) { return 1; }\n")
+  file(WRITE "${_tip_source_dir}/data/model.bin" "weights\n")
+endfunction()
+
+function(_tip_proof_build_and_install VERSION)
+  set(_tip_build_dir "${_tip_case_root}/build-${VERSION}")
+  _tip_proof_run_step(
+    NAME
+    "configure ${VERSION}"
+    COMMAND
+    "${CMAKE_COMMAND}"
+    -S
+    "${_tip_case_root}/source-${VERSION}"
+    -B
+    "${_tip_build_dir}"
+    -DCMAKE_BUILD_TYPE=Release
+    ${_tip_toolchain_args})
+  _tip_proof_run_step(NAME "build ${VERSION}" COMMAND "${CMAKE_COMMAND}" --build "${_tip_build_dir}" --config Release)
+  _tip_proof_run_step(NAME "install ${VERSION}" COMMAND "${CMAKE_COMMAND}" --install "${_tip_build_dir}" --config Release --prefix "${_tip_sdk_root}/${VERSION}")
+endfunction()
+
+# The inode number of FILE, or "" where stat is not available
+function(_tip_proof_inode OUT_VAR FILE)
+  execute_process(
+    COMMAND stat -c %i "${FILE}"
+    RESULT_VARIABLE _tip_result
+    OUTPUT_VARIABLE _tip_inode
+    OUTPUT_STRIP_TRAILING_WHITESPACE ERROR_QUIET)
+  if(NOT _tip_result EQUAL 0)
+    execute_process(
+      COMMAND stat -f %i "${FILE}"
+      OUTPUT_VARIABLE _tip_inode
+      OUTPUT_STRIP_TRAILING_WHITESPACE ERROR_QUIET)
+  endif()
+  set(${OUT_VAR}
+      "${_tip_inode}"
+      PARENT_SCOPE)
+endfunction()
+
+_tip_proof_write_version(1.0.0)
+_tip_proof_write_version(1.1.0)
+
+_tip_proof_expect_failure(
+  NAME
+  "mixed layouts in one export"
+  COMMAND
+  "${CMAKE_COMMAND}"
+  -S
+  "${_tip_case_root}/source-1.0.0"
+  -B
+  "${_tip_case_root}/invalid-build"
+  -DPROOF_CS_MIXED=ON
+  ${_tip_toolchain_args}
+  EXPECT_CONTAINS
+  "content_store applies to all")
+
+_tip_proof_build_and_install(1.0.0)
+_tip_proof_build_and_install(1.1.0)
+
+foreach(_tip_version IN ITEMS 1.0.0 1.1.0)
+  foreach(_tip_installed IN ITEMS include/proof_cs/cs.h include/proof_cs/version.h share/proof_cs/model.bin share/cmake/proof_cs/proof_csConfig.cmake)
+    _tip_proof_assert_exists("${_tip_sdk_root}/${_tip_version}/${_tip_installed}")
+  endforeach()
+endforeach()
+_tip_proof_assert_exists("${_tip_store}")
+_tip_proof_assert_file_contains("${_tip_sdk_root}/1.1.0/include/proof_cs/version.h" "\"1.1.0\"")
+
+# Files with the same bytes are one file in the store; files that differ are not.
+if(NOT WIN32)
+  function(_tip_proof_assert_shared FILE)
+    _tip_proof_inode(_tip_old "${_tip_sdk_root}/1.0.0/${FILE}")
+    _tip_proof_inode(_tip_new "${_tip_sdk_root}/1.1.0/${FILE}")
+    if(_tip_old STREQUAL "" OR NOT _tip_old STREQUAL _tip_new)
+      _tip_proof_fail("Expected ${FILE} of both versions to be one file in the store, inodes '${_tip_old}' and '${_tip_new}'")
+    endif()
+  endfunction()
+  _tip_proof_assert_shared(include/proof_cs/cs.h)
+  _tip_proof_assert_shared(share/proof_cs/model.bin)
+  _tip_proof_inode(_tip_old "${_tip_sdk_root}/1.0.0/include/proof_cs/version.h")
+  _tip_proof_inode(_tip_new "${_tip_sdk_root}/1.1.0/include/proof_cs/version.h")
+  if(_tip_old STREQUAL _tip_new)
+    _tip_proof_fail("The version headers differ and must not share a store object")
+  endif()
+
+  file(SHA256 "${_tip_sdk_root}/1.0.0/share/proof_cs/model.bin" _tip_model_hash)
+  string(SUBSTRING "${_tip_model_hash}" 0 2 _tip_bucket)
+  file(GLOB _tip_model_objects "${_tip_store}/${_tip_bucket}/${_tip_model_hash}-*")
+  list(LENGTH _tip_model_objects _tip_model_object_count)
+  if(NOT _tip_model_object_count EQUAL 1)
+    _tip_proof_fail("Expected one store object for model.bin, found: ${_tip_model_objects}")
+  endif()
+
+  # A changed file of one version is installed as a new file and leaves the other version's file alone.
+  file(WRITE "${_tip_case_root}/source-1.1.0/data/model.bin" "retrained\n")
+  _tip_proof_run_step(NAME "reinstall 1.1.0" COMMAND "${CMAKE_COMMAND}" --install "${_tip_case_root}/build-1.1.0" --config Release --prefix "${_tip_sdk_root}/1.1.0")
+  _tip_proof_assert_file_contains("${_tip_sdk_root}/1.1.0/share/proof_cs/model.bin" "retrained")
+  _tip_proof_assert_file_contains("${_tip_sdk_root}/1.0.0/share/proof_cs/model.bin" "weights")
+  _tip_proof_assert_file_contains("${_tip_model_objects}" "weights")
+  _tip_proof_assert_shared(include/proof_cs/cs.h)
+endif()
+
+message(STATUS "[proof] Content store proof passed.")
@@ -206,7 +206,8 @@ execute_process(
   OUTPUT_VARIABLE _tip_cmake_capabilities
   ERROR_QUIET)
 string(FIND "${_tip_cmake_capabilities}" "\"name\":\"Ninja Multi-Config\"" _tip_ninja_multi_config_index)
-if(_tip_ninja_multi_config_index EQUAL -1)
+find_program(_tip_ninja_program NAMES ninja ninja-build)
+if(_tip_ninja_multi_config_index EQUAL -1 OR (NOT _tip_ninja_program AND NOT TIP_CMAKE_GENERATOR MATCHES "^Ninja"))
   set(_tip_has_ninja_multi_config FALSE)
 else()
   set(_tip_has_ninja_multi_config TRUE)
@@ -924,4 +925,132 @@ _tip_proof_expect_failure(
   "CPS_APPENDIX cannot be"
   "CPS_DESCRIPTION")
 
+# CPS_PRIMARY: the .cps file is the entry point and the config a thin fallback, and both give find_package(PrimaryPkg)
+# the same targets. Each consumer gets a copy of the install prefix: one without the config, one without the .cps file,
+# and one without the targets files that a consumer pointed at the config through PrimaryPkg_DIR, so it can only
+# succeed by being handed on to the .cps file.
+set(_tip_primary_source_dir "${_tip_case_root}/primary-src")
+set(_tip_primary_build_dir "${_tip_case_root}/primary-build")
+set(_tip_primary_install_prefix "${_tip_case_root}/primary-install")
+file(
+  WRITE "${_tip_primary_source_dir}/CMakeLists.txt"
+  "cmake_minimum_required(VERSION 3.25)\n"
+  "project(proof_cps_primary VERSION 2.1.0 LANGUAGES CXX)\n"
+  "set(TARGET_INSTALL_PACKAGE_DISABLE_INSTALL ON)\n"
+  "include(\"${TIP_REPO_ROOT}/cmake/load_target_install_package.cmake\")\n"
+  "add_library(primary_core STATIC src/core.cpp)\n"
+  "target_install_package(primary_core EXPORT_NAME PrimaryPkg VERSION \${PROJECT_VERSION} PUBLIC_DEPENDENCIES \"Threads REQUIRED\" CPS CPS_PRIMARY\n"
+  "                       CPS_DESTINATION \"share/cps/PrimaryPkg\")\n")
+file(WRITE "${_tip_primary_source_dir}/src/core.cpp" "int primary_core() { return 1; }\n")
+_tip_proof_run_step(
+  NAME
+  "primary-configure"
+  COMMAND
+  "${CMAKE_COMMAND}"
+  -S
+  "${_tip_primary_source_dir}"
+  -B
+  "${_tip_primary_build_dir}"
+  "-DCMAKE_BUILD_TYPE=Release"
+  ${_tip_toolchain_args})
+_tip_proof_run_step(
+  NAME
+  "primary-build"
+  COMMAND
+  "${CMAKE_COMMAND}"
+  --build
+  "${_tip_primary_build_dir}"
+  --config
+  Release)
+_tip_proof_run_step(
+  NAME
+  "primary-install"
+  COMMAND
+  "${CMAKE_COMMAND}"
+  --install
+  "${_tip_primary_build_dir}"
+  --config
+  Release
+  --prefix
+  "${_tip_primary_install_prefix}")
+_tip_proof_assert_json_string("${_tip_primary_install_prefix}/share/cps/PrimaryPkg/PrimaryPkg.cps" "version" "2.1.0")
+set(_tip_primary_config "${_tip_primary_install_prefix}/share/cmake/PrimaryPkg/PrimaryPkgConfig.cmake")
+_tip_proof_assert_file_contains("${_tip_primary_config}" "find_package(PrimaryPkg CONFIG QUIET NO_DEFAULT_PATH PATHS \"\${PACKAGE_PREFIX_DIR}\")")
+_tip_proof_assert_file_contains("${_tip_primary_config}" "find_dependency(Threads REQUIRED)")
+_tip_proof_assert_file_not_contains("${_tip_primary_config}" "tip_find_package_profile.cmake")
+_tip_proof_assert_not_exists("${_tip_primary_install_prefix}/share/cmake/PrimaryPkg/tip_find_package_profile.cmake")
+
+foreach(_tip_primary_entry IN ITEMS cps config redirect)
+  set(_tip_primary_prefix "${_tip_case_root}/primary-${_tip_primary_entry}-only")
+  file(COPY "${_tip_primary_install_prefix}/" DESTINATION "${_tip_primary_prefix}")
+  set(_tip_primary_consumer_args "")
+  if(_tip_primary_entry STREQUAL "cps")
+    file(REMOVE_RECURSE "${_tip_primary_prefix}/share/cmake")
+    set(_tip_primary_expected_config "PrimaryPkg.cps")
+  elseif(_tip_primary_entry STREQUAL "config")
+    file(REMOVE_RECURSE "${_tip_primary_prefix}/share/cps")
+    set(_tip_primary_expected_config "PrimaryPkgConfig.cmake")
+  else()
+    file(GLOB _tip_primary_targets_files "${_tip_primary_prefix}/share/cmake/PrimaryPkg/PrimaryPkgTargets*.cmake")
+    file(REMOVE ${_tip_primary_targets_files})
+    set(_tip_primary_expected_config "PrimaryPkgConfig.cmake")
+    set(_tip_primary_consumer_args "-DPrimaryPkg_DIR=${_tip_primary_prefix}/share/cmake/PrimaryPkg")
+  endif()
+  set(_tip_primary_consumer_dir "${_tip_case_root}/primary-${_tip_primary_entry}-consumer")
+  file(
+    WRITE "${_tip_primary_consumer_dir}/CMakeLists.txt"
+    "cmake_minimum_required(VERSION 3.25)\n"
+    "project(proof_cps_primary_consumer LANGUAGES CXX)\n"
+    "find_package(PrimaryPkg 2.0 REQUIRED CONFIG PATHS \"${_tip_primary_prefix}\" NO_DEFAULT_PATH)\n"
+    "get_filename_component(_proof_config_name \"\${PrimaryPkg_CONFIG}\" NAME)\n"
+    "if(NOT _proof_config_name STREQUAL \"${_tip_primary_expected_config}\")\n"
+    "  message(FATAL_ERROR \"Expected PrimaryPkg from ${_tip_primary_expected_config}, got \${PrimaryPkg_CONFIG}\")\n"
+    "endif()\n"
+    "if(NOT TARGET PrimaryPkg::primary_core)\n"
+    "  message(FATAL_ERROR \"Expected PrimaryPkg::primary_core\")\n"
+    "endif()\n")
+  _tip_proof_run_step(
+    NAME
+    "primary-${_tip_primary_entry}-consumer-configure"
+    COMMAND
+    "${CMAKE_COMMAND}"
+    -S
+    "${_tip_primary_consumer_dir}"
+    -B
+    "${_tip_primary_consumer_dir}/build"
+    ${_tip_primary_consumer_args}
+    ${_tip_toolchain_args})
+endforeach()
+
+# Config-only behavior and target names that differ between the two entry points are rejected.
+foreach(_tip_primary_conflict IN ITEMS "NAMESPACE Other::" "INCLUDE_ON_FIND_PACKAGE extra.cmake" "CPS_PACKAGE_NAME OtherPkg")
+  string(MAKE_C_IDENTIFIER "${_tip_primary_conflict}" _tip_primary_case)
+  set(_tip_primary_conflict_dir "${_tip_case_root}/primary-conflict-${_tip_primary_case}")
+  file(WRITE "${_tip_primary_conflict_dir}/extra.cmake" "")
+  file(
+    WRITE "${_tip_primary_conflict_dir}/CMakeLists.txt"
+    "cmake_minimum_required(VERSION 3.25)\n"
+    "project(proof_cps_primary_conflict VERSION 1.0.0 LANGUAGES NONE)\n"
+    "set(TARGET_INSTALL_PACKAGE_DISABLE_INSTALL ON)\n"
+    "include(\"${TIP_REPO_ROOT}/cmake/load_target_install_package.cmake\")\n"
+    "add_library(primary_conflict INTERFACE)\n"
+    "target_install_package(primary_conflict EXPORT_NAME PrimaryConflict CPS CPS_PRIMARY ${_tip_primary_conflict})\n")
+  # CMake wraps long messages, so the expected words are matched one by one
+  string(REGEX REPLACE " .*" "" _tip_primary_option "${_tip_primary_conflict}")
+  _tip_proof_expect_failure(
+    NAME
+    "primary-conflict-${_tip_primary_case}"
+    COMMAND
+    "${CMAKE_COMMAND}"
+    -S
+    "${_tip_primary_conflict_dir}"
+    -B
+    "${_tip_primary_conflict_dir}/build"
+    EXPECT_CONTAINS
+    "CPS_PRIMARY"
+    "'PrimaryConflict'"
+    "differently"
+    "${_tip_primary_option}")
+endforeach()
+
 message(STATUS "[proof] CPS package info proof passed.")
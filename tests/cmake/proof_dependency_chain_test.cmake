@@ -0,0 +1,107 @@
+cmake_minimum_required(VERSION 3.25)
+
+include("${CMAKE_CURRENT_LIST_DIR}/proof_helpers.cmake")
+
+if(NOT DEFINED TIP_REPO_ROOT)
+  _tip_proof_fail("TIP_REPO_ROOT is required")
+endif()
+if(NOT DEFINED TIP_PROOF_TEST_ROOT)
+  _tip_proof_fail("TIP_PROOF_TEST_ROOT is required")
+endif()
+
+set(_tip_case_root "${TIP_PROOF_TEST_ROOT}/dependency-chain")
+set(_tip_install_prefix "${_tip_case_root}/install")
+file(REMOVE_RECURSE "${_tip_case_root}")
+
+_tip_proof_append_toolchain_args(_tip_toolchain_args)
+
+# A chain proof_chain_a -> proof_chain_b -> proof_chain_c -> Threads, each package built against the ones installed
+# before it. proof_chain_b and proof_chain_c record every load of their config, and proof_chain_c only accepts requests
+# for its own minor version.
+function(_tip_install_chain_package name find_calls package_args)
+  set(_tip_source_dir "${_tip_case_root}/${name}")
+  file(
+    WRITE "${_tip_source_dir}/CMakeLists.txt"
+    "cmake_minimum_required(VERSION 3.25)\n"
+    "project(${name} VERSION 1.2.0 LANGUAGES C)\n"
+    "set(TARGET_INSTALL_PACKAGE_DISABLE_INSTALL ON)\n"
+    "include(\"${TIP_REPO_ROOT}/cmake/load_target_install_package.cmake\")\n"
+    "${find_calls}"
+    "add_library(${name} INTERFACE)\n"
+    "target_install_package(${name} ${package_args})\n")
+  file(WRITE "${_tip_source_dir}/count-loads.cmake" "set_property(GLOBAL APPEND PROPERTY PROOF_CHAIN_LOADS ${name})\n")
+  _tip_proof_run_step(
+    NAME
+    "${name}-configure"
+    COMMAND
+    "${CMAKE_COMMAND}"
+    -S
+    "${_tip_source_dir}"
+    -B
+    "${_tip_source_dir}/build"
+    "-DCMAKE_PREFIX_PATH=${_tip_install_prefix}"
+    ${_tip_toolchain_args})
+  _tip_proof_run_step(NAME "${name}-install" COMMAND "${CMAKE_COMMAND}" --install "${_tip_source_dir}/build" --prefix "${_tip_install_prefix}")
+endfunction()
+
+_tip_install_chain_package(proof_chain_c "" "COMPATIBILITY SameMinorVersion INCLUDE_ON_FIND_PACKAGE count-loads.cmake PUBLIC_DEPENDENCIES \"Threads REQUIRED\"")
+_tip_install_chain_package(proof_chain_b "find_package(proof_chain_c 1.2 REQUIRED)\n" "INCLUDE_ON_FIND_PACKAGE count-loads.cmake PUBLIC_DEPENDENCIES \"proof_chain_c 1.2 REQUIRED\"")
+_tip_install_chain_package(proof_chain_a "find_package(proof_chain_b 1.2 REQUIRED)\n" "FLATTEN_DEPENDENCIES PUBLIC_DEPENDENCIES \"proof_chain_b 1.2 REQUIRED\"")
+
+set(_tip_package_root "${_tip_install_prefix}/share/cmake")
+_tip_proof_assert_file_contains("${_tip_package_root}/proof_chain_b/proof_chain_bConfig.cmake" "set(proof_chain_b_TRANSITIVE_DEPENDENCIES \"Threads REQUIRED;proof_chain_c 1.2 REQUIRED\")")
+_tip_proof_assert_file_contains("${_tip_package_root}/proof_chain_b/proof_chain_bConfig.cmake"
+                                "if(NOT proof_chain_c_FOUND OR NOT \"\${proof_chain_c_VERSION}\" VERSION_EQUAL \"1.2\")")
+# The flattened config loads the whole chain itself, leaf first.
+file(READ "${_tip_package_root}/proof_chain_a/proof_chain_aConfig.cmake" _tip_flattened_config)
+set(_tip_previous_position -1)
+foreach(_tip_dependency IN ITEMS "Threads REQUIRED" "proof_chain_c 1.2 REQUIRED" "proof_chain_b 1.2 REQUIRED")
+  string(FIND "${_tip_flattened_config}" "  find_dependency(${_tip_dependency})\n" _tip_position)
+  if(_tip_position LESS_EQUAL _tip_previous_position)
+    _tip_proof_fail("Expected proof_chain_aConfig.cmake to load ${_tip_dependency} after the dependencies before it in the chain")
+  endif()
+  set(_tip_previous_position ${_tip_position})
+endforeach()
+_tip_proof_assert_file_contains("${_tip_package_root}/proof_chain_a/proof_chain_aConfig.cmake" "if(NOT Threads_FOUND)\n")
+
+# Each consumer lists its find_package() calls and the package configs it expects to have been loaded, in order.
+function(_tip_configure_chain_consumer name find_calls expected_loads)
+  set(_tip_consumer_dir "${_tip_case_root}/consumer-${name}")
+  file(
+    WRITE "${_tip_consumer_dir}/CMakeLists.txt"
+    "cmake_minimum_required(VERSION 3.25)\n"
+    "project(proof_chain_consumer LANGUAGES C)\n"
+    "${find_calls}"
+    "foreach(_proof_target IN ITEMS proof_chain_a proof_chain_b proof_chain_c)\n"
+    "  if(NOT TARGET \${_proof_target}::\${_proof_target})\n"
+    "    message(FATAL_ERROR \"Expected \${_proof_target}::\${_proof_target}\")\n"
+    "  endif()\n"
+    "endforeach()\n"
+    "get_property(_proof_loads GLOBAL PROPERTY PROOF_CHAIN_LOADS)\n"
+    "if(NOT \"\${_proof_loads}\" STREQUAL \"${expected_loads}\")\n"
+    "  message(FATAL_ERROR \"Expected package configs [${expected_loads}] to be loaded, got [\${_proof_loads}]\")\n"
+    "endif()\n")
+  _tip_proof_run_step(
+    NAME
+    "consumer-${name}-configure"
+    COMMAND
+    "${CMAKE_COMMAND}"
+    -S
+    "${_tip_consumer_dir}"
+    -B
+    "${_tip_consumer_dir}/build"
+    "-DCMAKE_PREFIX_PATH=${_tip_install_prefix}"
+    ${_tip_toolchain_args})
+endfunction()
+
+# proof_chain_b's own find_dependency(proof_chain_c) is skipped because the flattened config already loaded it.
+_tip_configure_chain_consumer(flattened "find_package(proof_chain_a REQUIRED)\n" "proof_chain_c;proof_chain_b")
+# Packages the consumer found first are not loaded again; a found version other than the requested one is, whether the
+# dependency rejects it (0.9) or only its own version file could tell (1.5 against SameMinorVersion 1.2).
+_tip_configure_chain_consumer(found-first "find_package(proof_chain_c REQUIRED)\nfind_package(proof_chain_a REQUIRED)\n" "proof_chain_c;proof_chain_b")
+_tip_configure_chain_consumer(incompatible "set(proof_chain_c_FOUND TRUE)\nset(proof_chain_c_VERSION 0.9)\nset(proof_chain_c_VERSION_MAJOR 0)\nfind_package(proof_chain_b REQUIRED)\nfind_package(proof_chain_a REQUIRED)\n"
+                              "proof_chain_c;proof_chain_b")
+_tip_configure_chain_consumer(same-minor "set(proof_chain_c_FOUND TRUE)\nset(proof_chain_c_VERSION 1.5)\nset(proof_chain_c_VERSION_MAJOR 1)\nfind_package(proof_chain_b REQUIRED)\nfind_package(proof_chain_a REQUIRED)\n"
+                              "proof_chain_c;proof_chain_b")
+
+message(STATUS "[proof] Dependency chain proof passed.")
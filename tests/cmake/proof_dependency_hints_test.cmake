@@ -0,0 +1,118 @@
+cmake_minimum_required(VERSION 3.25)
+
+include("${CMAKE_CURRENT_LIST_DIR}/proof_helpers.cmake")
+
+if(NOT DEFINED TIP_REPO_ROOT)
+  _tip_proof_fail("TIP_REPO_ROOT is required")
+endif()
+if(NOT DEFINED TIP_PROOF_TEST_ROOT)
+  _tip_proof_fail("TIP_PROOF_TEST_ROOT is required")
+endif()
+
+set(_tip_case_root "${TIP_PROOF_TEST_ROOT}/dependency-hints")
+set(_tip_bundle_prefix "${_tip_case_root}/bundle")
+set(_tip_moved_prefix "${_tip_case_root}/moved")
+set(_tip_system_prefix "${_tip_case_root}/system")
+file(REMOVE_RECURSE "${_tip_case_root}")
+
+_tip_proof_append_toolchain_args(_tip_toolchain_args)
+
+function(_tip_install_hint_package name install_prefix find_calls package_args)
+  set(_tip_source_dir "${_tip_case_root}/${name}")
+  file(
+    WRITE "${_tip_source_dir}/CMakeLists.txt"
+    "cmake_minimum_required(VERSION 3.25)\n"
+    "project(${name} VERSION 1.0.0 LANGUAGES NONE)\n"
+    "set(TARGET_INSTALL_PACKAGE_DISABLE_INSTALL ON)\n"
+    "include(\"${TIP_REPO_ROOT}/cmake/load_target_install_package.cmake\")\n"
+    "${find_calls}"
+    "add_library(${name} INTERFACE)\n"
+    "target_install_package(${name} ${package_args})\n")
+  _tip_proof_run_step(
+    NAME
+    "${name}-configure"
+    COMMAND
+    "${CMAKE_COMMAND}"
+    -S
+    "${_tip_source_dir}"
+    -B
+    "${_tip_source_dir}/build"
+    "-DCMAKE_PREFIX_PATH=${_tip_bundle_prefix}"
+    "-Dproof_hint_system_DIR=${_tip_system_prefix}/share/cmake/proof_hint_system"
+    "-DCMAKE_INSTALL_PREFIX=${install_prefix}"
+    ${_tip_toolchain_args})
+  _tip_proof_run_step(NAME "${name}-install" COMMAND "${CMAKE_COMMAND}" --install "${_tip_source_dir}/build")
+endfunction()
+
+# proof_hint_dep is installed into the bundle, proof_hint_system outside it, and proof_hint_pkg into the bundle with
+# its config one directory deeper than the default, so the baked path is not just a sibling directory.
+_tip_install_hint_package(proof_hint_dep "${_tip_bundle_prefix}" "" "")
+_tip_install_hint_package(proof_hint_system "${_tip_system_prefix}" "" "")
+_tip_install_hint_package(
+  proof_hint_pkg "${_tip_bundle_prefix}" "find_package(proof_hint_dep 1.0 REQUIRED)\nfind_package(proof_hint_system REQUIRED)\n"
+  "BAKE_DEPENDENCY_HINTS CMAKE_CONFIG_DESTINATION lib/cmake/hints/proof_hint_pkg PUBLIC_DEPENDENCIES \"proof_hint_dep 1.0 REQUIRED\" \"proof_hint_system REQUIRED\"")
+
+set(_tip_config_file "${_tip_bundle_prefix}/lib/cmake/hints/proof_hint_pkg/proof_hint_pkgConfig.cmake")
+# The hint is preset ahead of the profiling span, so the span times only the find_dependency() call.
+string(
+  CONCAT
+  _tip_hinted_dependency
+  "  if(NOT proof_hint_dep_DIR)\n    get_filename_component(proof_hint_dep_DIR \"\${CMAKE_CURRENT_LIST_DIR}/../../../../share/cmake/proof_hint_dep\" ABSOLUTE)\n  endif()\n"
+  "  if(TIP_PROFILE_FIND_PACKAGE AND COMMAND _tip_find_package_profile_begin)\n"
+  "    _tip_find_package_profile_begin(_tip_find_package_profile_proof_hint_pkg_proof_hint_dep)\n"
+  "  endif()\n"
+  "  find_dependency(proof_hint_dep 1.0 REQUIRED)\n")
+_tip_proof_assert_file_contains("${_tip_config_file}" "${_tip_hinted_dependency}")
+_tip_proof_assert_file_not_contains("${_tip_config_file}" "proof_hint_system_DIR")
+_tip_proof_assert_file_not_contains("${_tip_config_file}" "${_tip_bundle_prefix}")
+
+# The moved bundle is found without any search path for proof_hint_dep, so it can only come from the baked hint.
+# proof_hint_system has no hint and is still found through the consumer's CMAKE_PREFIX_PATH.
+file(COPY "${_tip_bundle_prefix}/" DESTINATION "${_tip_moved_prefix}")
+file(
+  WRITE "${_tip_case_root}/consumer/CMakeLists.txt"
+  "cmake_minimum_required(VERSION 3.25)\n"
+  "project(proof_hint_consumer LANGUAGES NONE)\n"
+  "find_package(proof_hint_pkg REQUIRED CONFIG PATHS \"${_tip_moved_prefix}/lib/cmake/hints\" NO_DEFAULT_PATH)\n"
+  "if(NOT proof_hint_dep_DIR STREQUAL \"${_tip_moved_prefix}/share/cmake/proof_hint_dep\")\n"
+  "  message(FATAL_ERROR \"Unexpected proof_hint_dep_DIR: \${proof_hint_dep_DIR}\")\n"
+  "endif()\n"
+  "foreach(_proof_package IN ITEMS proof_hint_pkg proof_hint_dep proof_hint_system)\n"
+  "  if(NOT TARGET \${_proof_package}::\${_proof_package})\n"
+  "    message(FATAL_ERROR \"Expected \${_proof_package}::\${_proof_package}\")\n"
+  "  endif()\n"
+  "endforeach()\n")
+_tip_proof_run_step(
+  NAME
+  "consumer-configure"
+  COMMAND
+  "${CMAKE_COMMAND}"
+  -S
+  "${_tip_case_root}/consumer"
+  -B
+  "${_tip_case_root}/consumer/build"
+  "-DCMAKE_PREFIX_PATH=${_tip_system_prefix}")
+
+# A consumer's own proof_hint_dep_DIR wins over the baked one.
+file(COPY "${_tip_bundle_prefix}/share/cmake/proof_hint_dep/" DESTINATION "${_tip_case_root}/override/proof_hint_dep")
+file(
+  WRITE "${_tip_case_root}/override-consumer/CMakeLists.txt"
+  "cmake_minimum_required(VERSION 3.25)\n"
+  "project(proof_hint_override LANGUAGES NONE)\n"
+  "find_package(proof_hint_pkg REQUIRED CONFIG PATHS \"${_tip_moved_prefix}/lib/cmake/hints\" NO_DEFAULT_PATH)\n"
+  "if(NOT proof_hint_dep_DIR STREQUAL \"${_tip_case_root}/override/proof_hint_dep\")\n"
+  "  message(FATAL_ERROR \"Unexpected proof_hint_dep_DIR: \${proof_hint_dep_DIR}\")\n"
+  "endif()\n")
+_tip_proof_run_step(
+  NAME
+  "override-consumer-configure"
+  COMMAND
+  "${CMAKE_COMMAND}"
+  -S
+  "${_tip_case_root}/override-consumer"
+  -B
+  "${_tip_case_root}/override-consumer/build"
+  "-DCMAKE_PREFIX_PATH=${_tip_system_prefix}"
+  "-Dproof_hint_dep_DIR=${_tip_case_root}/override/proof_hint_dep")
+
+message(STATUS "[proof] Dependency hints proof passed.")
@@ -0,0 +1,127 @@
+cmake_minimum_required(VERSION 3.25)
+
+include("${CMAKE_CURRENT_LIST_DIR}/proof_helpers.cmake")
+
+if(NOT DEFINED TIP_REPO_ROOT)
+  _tip_proof_fail("TIP_REPO_ROOT is required")
+endif()
+if(NOT DEFINED TIP_PROOF_TEST_ROOT)
+  _tip_proof_fail("TIP_PROOF_TEST_ROOT is required")
+endif()
+
+set(_tip_case_root "${TIP_PROOF_TEST_ROOT}/find-package-profile")
+set(_tip_install_prefix "${_tip_case_root}/install")
+file(REMOVE_RECURSE "${_tip_case_root}")
+
+_tip_proof_append_toolchain_args(_tip_toolchain_args)
+
+function(_tip_install_profiled_package name find_calls package_args)
+  set(_tip_source_dir "${_tip_case_root}/${name}")
+  file(
+    WRITE "${_tip_source_dir}/CMakeLists.txt"
+    "cmake_minimum_required(VERSION 3.25)\n"
+    "project(${name} VERSION 1.0.0 LANGUAGES NONE)\n"
+    "set(TARGET_INSTALL_PACKAGE_DISABLE_INSTALL ON)\n"
+    "include(\"${TIP_REPO_ROOT}/cmake/load_target_install_package.cmake\")\n"
+    "${find_calls}"
+    "add_library(${name} INTERFACE)\n"
+    "target_install_package(${name} ${package_args})\n")
+  file(WRITE "${_tip_source_dir}/${name}-extra.cmake" "set(${name}_EXTRA_LOADED TRUE)\n")
+  _tip_proof_run_step(
+    NAME
+    "${name}-configure"
+    COMMAND
+    "${CMAKE_COMMAND}"
+    -S
+    "${_tip_source_dir}"
+    -B
+    "${_tip_source_dir}/build"
+    "-DCMAKE_PREFIX_PATH=${_tip_install_prefix}"
+    ${_tip_toolchain_args})
+  _tip_proof_run_step(NAME "${name}-install" COMMAND "${CMAKE_COMMAND}" --install "${_tip_source_dir}/build" --prefix "${_tip_install_prefix}")
+endfunction()
+
+_tip_install_profiled_package(proof_profile_dep "" "INCLUDE_ON_FIND_PACKAGE proof_profile_dep-extra.cmake")
+_tip_install_profiled_package(proof_profile_pkg "find_package(proof_profile_dep 1.0 REQUIRED)\n"
+                              "FLATTEN_CONFIG PUBLIC_DEPENDENCIES \"proof_profile_dep 1.0 REQUIRED\" COMPONENT_DEPENDENCIES tools \"Threads REQUIRED\"")
+
+# The profiling helpers are installed only next to configs whose template includes them.
+file(WRITE "${_tip_case_root}/proof_profile_custom/custom-config.cmake.in" "@PACKAGE_INIT@\n@PACKAGE_COMPONENT_DEPENDENCIES_CONTENT@\ninclude(\"\${CMAKE_CURRENT_LIST_DIR}/@ARG_EXPORT_NAME@Targets.cmake\")\n")
+_tip_install_profiled_package(proof_profile_custom "" "CONFIG_TEMPLATE \"\${CMAKE_CURRENT_SOURCE_DIR}/custom-config.cmake.in\"")
+_tip_proof_assert_exists("${_tip_install_prefix}/share/cmake/proof_profile_pkg/tip_find_package_profile.cmake")
+_tip_proof_assert_not_exists("${_tip_install_prefix}/share/cmake/proof_profile_custom/tip_find_package_profile.cmake")
+
+function(_tip_configure_profile_consumer name consumer_args)
+  set(_tip_consumer_dir "${_tip_case_root}/consumer-${name}")
+  file(
+    WRITE "${_tip_consumer_dir}/CMakeLists.txt"
+    "cmake_minimum_required(VERSION 3.25)\n"
+    "project(proof_profile_consumer LANGUAGES C)\n"
+    "find_package(proof_profile_pkg REQUIRED COMPONENTS tools)\n"
+    "if(NOT TARGET proof_profile_pkg::proof_profile_pkg OR NOT proof_profile_dep_EXTRA_LOADED)\n"
+    "  message(FATAL_ERROR \"Expected proof_profile_pkg and its dependency to be loaded\")\n"
+    "endif()\n")
+  _tip_proof_run_step(
+    NAME
+    "consumer-${name}-configure"
+    COMMAND
+    "${CMAKE_COMMAND}"
+    -S
+    "${_tip_consumer_dir}"
+    -B
+    "${_tip_consumer_dir}/build"
+    "-DCMAKE_PREFIX_PATH=${_tip_install_prefix}"
+    ${consumer_args}
+    ${_tip_toolchain_args})
+endfunction()
+
+# Without TIP_PROFILE_FIND_PACKAGE nothing is written.
+_tip_configure_profile_consumer(plain "")
+_tip_proof_assert_not_exists("${_tip_case_root}/consumer-plain/build/tip-find-package-profile.json")
+
+_tip_configure_profile_consumer(profiled "-DTIP_PROFILE_FIND_PACKAGE=ON")
+set(_tip_trace "${_tip_case_root}/consumer-profiled/build/tip-find-package-profile.json")
+_tip_proof_assert_exists("${_tip_trace}")
+file(READ "${_tip_trace}" _tip_trace_content)
+string(JSON _tip_event_count ERROR_VARIABLE _tip_json_error LENGTH "${_tip_trace_content}")
+if(_tip_json_error)
+  _tip_proof_fail("Expected '${_tip_trace}' to be a JSON array: ${_tip_json_error}")
+endif()
+
+# Every span of both packages is recorded, and each dependency span encloses the load of the dependency.
+set(_tip_spans "")
+math(EXPR _tip_last_event "${_tip_event_count} - 1")
+foreach(_tip_event RANGE 0 ${_tip_last_event})
+  string(JSON _tip_name GET "${_tip_trace_content}" ${_tip_event} name)
+  string(JSON _tip_package GET "${_tip_trace_content}" ${_tip_event} args package)
+  string(JSON _tip_ts GET "${_tip_trace_content}" ${_tip_event} ts)
+  string(JSON _tip_dur GET "${_tip_trace_content}" ${_tip_event} dur)
+  list(APPEND _tip_spans "${_tip_package}: ${_tip_name}")
+  set(_tip_span_${_tip_name}_begin ${_tip_ts})
+  math(EXPR "_tip_span_${_tip_name}_end" "${_tip_ts} + ${_tip_dur}")
+endforeach()
+foreach(
+  _tip_expected_span IN
+  ITEMS "proof_profile_pkg: find_package(proof_profile_pkg)"
+        "proof_profile_pkg: find_dependency(proof_profile_dep 1.0 REQUIRED)"
+        "proof_profile_pkg: find_dependency(Threads REQUIRED) for component tools"
+        "proof_profile_pkg: include(proof_profile_pkgTargets.cmake)"
+        "proof_profile_dep: find_package(proof_profile_dep)"
+        "proof_profile_dep: include(proof_profile_dep-extra.cmake)"
+        "proof_profile_dep: include(proof_profile_depTargets.cmake)")
+  if(NOT _tip_expected_span IN_LIST _tip_spans)
+    _tip_proof_fail("Expected span '${_tip_expected_span}' in '${_tip_trace}', got: ${_tip_spans}")
+  endif()
+endforeach()
+set(_tip_outer "find_dependency(proof_profile_dep 1.0 REQUIRED)")
+set(_tip_inner "find_package(proof_profile_dep)")
+if(_tip_span_${_tip_inner}_begin LESS _tip_span_${_tip_outer}_begin OR _tip_span_${_tip_inner}_end GREATER _tip_span_${_tip_outer}_end)
+  _tip_proof_fail("Expected '${_tip_inner}' to be nested in '${_tip_outer}' in '${_tip_trace}'")
+endif()
+
+# TIP_PROFILE_FIND_PACKAGE_OUTPUT moves the trace.
+_tip_configure_profile_consumer(output "-DTIP_PROFILE_FIND_PACKAGE=ON;-DTIP_PROFILE_FIND_PACKAGE_OUTPUT=${_tip_case_root}/custom-trace.json")
+_tip_proof_assert_exists("${_tip_case_root}/custom-trace.json")
+_tip_proof_assert_not_exists("${_tip_case_root}/consumer-output/build/tip-find-package-profile.json")
+
+message(STATUS "[proof] find_package() profile proof passed.")
@@ -0,0 +1,161 @@
+cmake_minimum_required(VERSION 3.25)
+
+include("${CMAKE_CURRENT_LIST_DIR}/proof_helpers.cmake")
+
+if(NOT DEFINED TIP_REPO_ROOT)
+  _tip_proof_fail("TIP_REPO_ROOT is required")
+endif()
+if(NOT DEFINED TIP_PROOF_TEST_ROOT)
+  _tip_proof_fail("TIP_PROOF_TEST_ROOT is required")
+endif()
+
+set(_tip_case_root "${TIP_PROOF_TEST_ROOT}/flatten-config")
+set(_tip_source_dir "${_tip_case_root}/src")
+set(_tip_consumer_dir "${_tip_case_root}/consumer")
+set(_tip_install_prefix "${_tip_case_root}/install")
+file(REMOVE_RECURSE "${_tip_case_root}")
+file(MAKE_DIRECTORY "${_tip_source_dir}/include/proof_flatten" "${_tip_consumer_dir}")
+
+# A static library with a public dependency and a DEBUG_POSTFIX, installed in Release and Debug into one prefix.
+file(
+  WRITE "${_tip_source_dir}/CMakeLists.txt"
+  "cmake_minimum_required(VERSION 3.25)\n"
+  "project(proof_flatten_config VERSION 1.0.0 LANGUAGES CXX)\n"
+  "set(TARGET_INSTALL_PACKAGE_DISABLE_INSTALL ON)\n"
+  "include(\"${TIP_REPO_ROOT}/cmake/load_target_install_package.cmake\")\n"
+  "add_library(proof_flatten STATIC flatten.cpp)\n"
+  "target_sources(proof_flatten PUBLIC FILE_SET HEADERS BASE_DIRS include FILES include/proof_flatten/flatten.h)\n"
+  "target_install_package(proof_flatten FLATTEN_CONFIG DEBUG_POSTFIX d PUBLIC_DEPENDENCIES \"Threads REQUIRED\")\n")
+file(WRITE "${_tip_source_dir}/include/proof_flatten/flatten.h" "int proof_flatten_value();\n")
+file(WRITE "${_tip_source_dir}/flatten.cpp" "#include <proof_flatten/flatten.h>\nint proof_flatten_value() { return 42; }\n")
+
+file(
+  WRITE "${_tip_consumer_dir}/CMakeLists.txt"
+  "cmake_minimum_required(VERSION 3.25)\n"
+  "project(proof_flatten_consumer LANGUAGES CXX)\n"
+  "find_package(proof_flatten 1.0 REQUIRED)\n"
+  "find_package(proof_flatten 1.0 REQUIRED)\n"
+  "if(NOT TARGET proof_flatten::proof_flatten OR NOT TARGET Threads::Threads)\n"
+  "  message(FATAL_ERROR \"Flattened config did not define its targets\")\n"
+  "endif()\n"
+  "get_target_property(_proof_configs proof_flatten::proof_flatten IMPORTED_CONFIGURATIONS)\n"
+  "if(NOT \"RELEASE\" IN_LIST _proof_configs OR NOT \"DEBUG\" IN_LIST _proof_configs)\n"
+  "  message(FATAL_ERROR \"Expected Release and Debug imported configurations, got: \${_proof_configs}\")\n"
+  "endif()\n"
+  "if(DEFINED CMAKE_MAP_IMPORTED_CONFIG_MINSIZEREL OR DEFINED _IMPORT_PREFIX)\n"
+  "  message(FATAL_ERROR \"Flattened config leaked variables into the caller\")\n"
+  "endif()\n"
+  "add_executable(proof_flatten_consumer main.cpp)\n"
+  "target_link_libraries(proof_flatten_consumer PRIVATE proof_flatten::proof_flatten)\n")
+file(WRITE "${_tip_consumer_dir}/main.cpp" "#include <proof_flatten/flatten.h>\nint main() { return proof_flatten_value() == 42 ? 0 : 1; }\n")
+
+_tip_proof_append_toolchain_args(_tip_toolchain_args)
+
+foreach(_tip_config IN ITEMS Release Debug)
+  set(_tip_build_dir "${_tip_case_root}/build-${_tip_config}")
+  _tip_proof_run_step(
+    NAME
+    "configure-${_tip_config}"
+    COMMAND
+    "${CMAKE_COMMAND}"
+    -S
+    "${_tip_source_dir}"
+    -B
+    "${_tip_build_dir}"
+    "-DCMAKE_BUILD_TYPE=${_tip_config}"
+    ${_tip_toolchain_args})
+  _tip_proof_run_step(NAME "build-${_tip_config}" COMMAND "${CMAKE_COMMAND}" --build "${_tip_build_dir}" --config "${_tip_config}")
+  _tip_proof_run_step(
+    NAME
+    "install-${_tip_config}"
+    COMMAND
+    "${CMAKE_COMMAND}"
+    --install
+    "${_tip_build_dir}"
+    --config
+    "${_tip_config}"
+    --prefix
+    "${_tip_install_prefix}")
+endforeach()
+
+# The installed config carries the targets and both configurations inline; the build-tree config is untouched.
+set(_tip_installed_config "${_tip_install_prefix}/share/cmake/proof_flatten/proof_flattenConfig.cmake")
+_tip_proof_assert_file_not_contains("${_tip_installed_config}" "proof_flattenTargets.cmake\")")
+_tip_proof_assert_file_not_contains("${_tip_installed_config}" "file(GLOB")
+_tip_proof_assert_file_contains("${_tip_installed_config}" "add_library(proof_flatten::proof_flatten STATIC IMPORTED)")
+_tip_proof_assert_file_contains("${_tip_installed_config}" "IMPORTED_LOCATION_RELEASE")
+_tip_proof_assert_file_contains("${_tip_installed_config}" "IMPORTED_LOCATION_DEBUG")
+_tip_proof_assert_file_contains("${_tip_installed_config}" "find_dependency(Threads REQUIRED)")
+_tip_proof_assert_file_contains("${_tip_case_root}/build-Debug/proof_flattenConfig.cmake" "proof_flattenTargets.cmake\")")
+_tip_proof_assert_exists("${_tip_install_prefix}/share/cmake/proof_flatten/proof_flattenTargets.cmake")
+
+_tip_proof_run_step(
+  NAME
+  "consumer-configure"
+  COMMAND
+  "${CMAKE_COMMAND}"
+  -S
+  "${_tip_consumer_dir}"
+  -B
+  "${_tip_case_root}/consumer-build"
+  "-DCMAKE_PREFIX_PATH=${_tip_install_prefix}"
+  -DCMAKE_BUILD_TYPE=Debug
+  ${_tip_toolchain_args})
+_tip_proof_run_step(NAME "consumer-build" COMMAND "${CMAKE_COMMAND}" --build "${_tip_case_root}/consumer-build" --config Debug)
+
+# A flattened config whose targets reference a target of another, missing export set is not found.
+file(
+  WRITE "${_tip_case_root}/split/CMakeLists.txt"
+  "cmake_minimum_required(VERSION 3.25)\n"
+  "project(proof_flatten_split VERSION 1.0.0 LANGUAGES NONE)\n"
+  "set(TARGET_INSTALL_PACKAGE_DISABLE_INSTALL ON)\n"
+  "include(\"${TIP_REPO_ROOT}/cmake/load_target_install_package.cmake\")\n"
+  "add_library(proof_flatten_base INTERFACE)\n"
+  "target_install_package(proof_flatten_base)\n"
+  "add_library(proof_flatten_top INTERFACE)\n"
+  "target_link_libraries(proof_flatten_top INTERFACE proof_flatten_base)\n"
+  "target_install_package(proof_flatten_top FLATTEN_CONFIG)\n")
+_tip_proof_run_step(NAME "split-configure" COMMAND "${CMAKE_COMMAND}" -S "${_tip_case_root}/split" -B "${_tip_case_root}/split-build" -Wno-dev)
+_tip_proof_run_step(NAME "split-install" COMMAND "${CMAKE_COMMAND}" --install "${_tip_case_root}/split-build" --prefix "${_tip_case_root}/split-install")
+_tip_proof_assert_file_not_contains("${_tip_case_root}/split-install/share/cmake/proof_flatten_top/proof_flatten_topConfig.cmake" "proof_flatten_topTargets.cmake\")")
+file(
+  WRITE "${_tip_case_root}/split-consumer/CMakeLists.txt"
+  "cmake_minimum_required(VERSION 3.25)\n"
+  "project(proof_flatten_split_consumer LANGUAGES NONE)\n"
+  "find_package(proof_flatten_top 1.0 REQUIRED)\n")
+_tip_proof_expect_failure(
+  NAME
+  "split-consumer-missing-export"
+  EXPECT_CONTAINS
+  "referenced, but are missing"
+  COMMAND
+  "${CMAKE_COMMAND}"
+  -S
+  "${_tip_case_root}/split-consumer"
+  -B
+  "${_tip_case_root}/split-consumer-build"
+  "-DCMAKE_PREFIX_PATH=${_tip_case_root}/split-install")
+
+# A custom template that does not include the targets file cannot be flattened.
+file(WRITE "${_tip_case_root}/bad/custom-config.cmake.in" "@PACKAGE_INIT@\n@PACKAGE_COMPONENT_DEPENDENCIES_CONTENT@\ninclude(\"\${CMAKE_CURRENT_LIST_DIR}/@ARG_EXPORT_NAME@-targets.cmake\")\n")
+file(
+  WRITE "${_tip_case_root}/bad/CMakeLists.txt"
+  "cmake_minimum_required(VERSION 3.25)\n"
+  "project(proof_flatten_bad VERSION 1.0.0 LANGUAGES NONE)\n"
+  "set(TARGET_INSTALL_PACKAGE_DISABLE_INSTALL ON)\n"
+  "include(\"${TIP_REPO_ROOT}/cmake/load_target_install_package.cmake\")\n"
+  "add_library(proof_flatten_bad INTERFACE)\n"
+  "target_install_package(proof_flatten_bad FLATTEN_CONFIG CONFIG_TEMPLATE \"\${CMAKE_CURRENT_SOURCE_DIR}/custom-config.cmake.in\")\n")
+_tip_proof_expect_failure(
+  NAME
+  "bad-template"
+  EXPECT_CONTAINS
+  "FLATTEN_CONFIG requires"
+  COMMAND
+  "${CMAKE_COMMAND}"
+  -S
+  "${_tip_case_root}/bad"
+  -B
+  "${_tip_case_root}/bad-build")
+
+message(STATUS "[proof] Flatten config proof passed.")
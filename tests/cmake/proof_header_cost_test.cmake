@@ -0,0 +1,102 @@
+cmake_minimum_required(VERSION 3.25)
+
+include("${CMAKE_CURRENT_LIST_DIR}/proof_helpers.cmake")
+
+if(NOT DEFINED TIP_REPO_ROOT)
+  _tip_proof_fail("TIP_REPO_ROOT is required")
+endif()
+if(NOT DEFINED TIP_PROOF_TEST_ROOT)
+  _tip_proof_fail("TIP_PROOF_TEST_ROOT is required")
+endif()
+
+set(_tip_case_root "${TIP_PROOF_TEST_ROOT}/header-cost")
+set(_tip_source_dir "${_tip_case_root}/source")
+set(_tip_build_dir "${_tip_case_root}/build")
+file(REMOVE_RECURSE "${_tip_case_root}")
+
+_tip_proof_append_toolchain_args(_tip_toolchain_args)
+
+# light.h is trivial, heavy.h pulls in standard headers and a header of the dependency, and both need the compile
+# definition and C++ standard the target requires of its consumers. broken.h uses std::string without including it.
+file(
+  WRITE "${_tip_source_dir}/CMakeLists.txt"
+  "cmake_minimum_required(VERSION 3.25)\n"
+  "project(proof_header_cost VERSION 1.0.0 LANGUAGES CXX)\n"
+  "set(TARGET_INSTALL_PACKAGE_DISABLE_INSTALL ON)\n"
+  "include(\"${TIP_REPO_ROOT}/cmake/load_target_install_package.cmake\")\n"
+  "add_library(proof_hc_dep INTERFACE)\n"
+  "target_include_directories(proof_hc_dep INTERFACE \"\$<BUILD_INTERFACE:\${CMAKE_CURRENT_SOURCE_DIR}/dep>\")\n"
+  "add_library(proof_hc STATIC hc.cpp)\n"
+  "target_sources(proof_hc PUBLIC FILE_SET HEADERS BASE_DIRS include FILES include/hc/light.h include/hc/heavy.h)\n"
+  "target_compile_definitions(proof_hc PUBLIC PROOF_HC_ENABLED=1)\n"
+  "target_compile_features(proof_hc PUBLIC cxx_std_20)\n"
+  "target_link_libraries(proof_hc PUBLIC proof_hc_dep)\n"
+  "target_install_package(proof_hc HEADER_COST_REPORT)\n"
+  "target_install_package(proof_hc_dep)\n"
+  "add_library(proof_hc_broken INTERFACE)\n"
+  "set_target_properties(proof_hc_broken PROPERTIES PUBLIC_HEADER broken/broken.h)\n"
+  "target_install_package(proof_hc_broken HEADER_COST_REPORT)\n")
+file(WRITE "${_tip_source_dir}/hc.cpp" "#include <hc/heavy.h>\n")
+file(WRITE "${_tip_source_dir}/dep/hc_dep.h" "#pragma once\n#include <string>\n")
+set(_tip_requirements "#ifndef PROOF_HC_ENABLED\n#error missing usage requirement\n#endif\n#if __cplusplus < 202002L\n#error missing C++20\n#endif\n")
+file(WRITE "${_tip_source_dir}/include/hc/light.h" "#pragma once\n${_tip_requirements}inline int proof_hc_light() { return 1; }\n")
+file(
+  WRITE "${_tip_source_dir}/include/hc/heavy.h"
+  "#pragma once\n${_tip_requirements}#include <hc_dep.h>\n#include <map>\n#include <regex>\n#include <iostream>\n#include <vector>\n"
+  "inline std::map<std::string, std::vector<std::regex>> proof_hc_heavy() { return {}; }\n")
+file(WRITE "${_tip_source_dir}/broken/broken.h" "#pragma once\ninline std::string proof_hc_broken() { return {}; }\n")
+
+_tip_proof_run_step(
+  NAME
+  "configure"
+  COMMAND
+  "${CMAKE_COMMAND}"
+  -S
+  "${_tip_source_dir}"
+  -B
+  "${_tip_build_dir}"
+  ${_tip_toolchain_args})
+_tip_proof_run_step(NAME "proof_hc header cost" COMMAND "${CMAKE_COMMAND}" --build "${_tip_build_dir}" --target proof_hc_header_cost)
+
+# Both headers compile on their own, heavy.h is the slowest, has more code and includes, and light.h includes nothing.
+set(_tip_report "${_tip_build_dir}/tip-header-cost/proof_hc.txt")
+_tip_proof_assert_exists("${_tip_report}")
+file(STRINGS "${_tip_report}" _tip_rows REGEX "^ *[0-9]")
+list(LENGTH _tip_rows _tip_row_count)
+if(NOT _tip_row_count EQUAL 2)
+  _tip_proof_fail("Expected two headers in '${_tip_report}', got: ${_tip_rows}")
+endif()
+foreach(_tip_row_index RANGE 1)
+  list(GET _tip_rows ${_tip_row_index} _tip_row)
+  string(REGEX REPLACE " +" ";" _tip_fields "${_tip_row}")
+  list(FILTER _tip_fields EXCLUDE REGEX "^$")
+  list(GET _tip_fields 1 _tip_lines_${_tip_row_index})
+  list(GET _tip_fields 2 _tip_includes_${_tip_row_index})
+  list(GET _tip_fields 3 _tip_self_contained_${_tip_row_index})
+  list(GET _tip_fields 5 _tip_header_${_tip_row_index})
+endforeach()
+if(NOT _tip_header_0 STREQUAL "hc/heavy.h" OR NOT _tip_header_1 STREQUAL "hc/light.h")
+  _tip_proof_fail("Expected hc/heavy.h before hc/light.h in '${_tip_report}'")
+endif()
+if(NOT _tip_self_contained_0 STREQUAL "yes" OR NOT _tip_self_contained_1 STREQUAL "yes")
+  _tip_proof_fail("Expected both headers to be self-contained in '${_tip_report}'")
+endif()
+if(NOT _tip_lines_0 GREATER _tip_lines_1 OR NOT _tip_includes_0 GREATER 10 OR NOT _tip_includes_1 EQUAL 0)
+  _tip_proof_fail("Unexpected line or include counts in '${_tip_report}'")
+endif()
+
+# A header that does not compile on its own fails the check and is flagged in the report.
+_tip_proof_expect_failure(
+  NAME
+  "proof_hc_broken header cost"
+  COMMAND
+  "${CMAKE_COMMAND}"
+  --build
+  "${_tip_build_dir}"
+  --target
+  tip_header_cost
+  EXPECT_CONTAINS
+  "broken.h")
+_tip_proof_assert_file_contains("${_tip_build_dir}/tip-header-cost/proof_hc_broken.txt" "no              proof_hc_broken")
+
+message(STATUS "[proof] Header cost proof passed.")
@@ -0,0 +1,122 @@
+cmake_minimum_required(VERSION 3.25)
+
+include("${CMAKE_CURRENT_LIST_DIR}/proof_helpers.cmake")
+
+if(NOT DEFINED TIP_REPO_ROOT)
+  _tip_proof_fail("TIP_REPO_ROOT is required")
+endif()
+if(NOT DEFINED TIP_PROOF_TEST_ROOT)
+  _tip_proof_fail("TIP_PROOF_TEST_ROOT is required")
+endif()
+
+set(_tip_case_root "${TIP_PROOF_TEST_ROOT}/incremental-finalization")
+set(_tip_source_dir "${_tip_case_root}/src")
+set(_tip_build_dir "${_tip_case_root}/build")
+file(REMOVE_RECURSE "${_tip_case_root}")
+file(MAKE_DIRECTORY "${_tip_source_dir}/include/proof_incremental")
+
+# The export version, its dependencies, a variable the config template references and the template itself come from
+# files, so the proof can change them between configures.
+file(
+  WRITE "${_tip_source_dir}/CMakeLists.txt"
+  "cmake_minimum_required(VERSION 3.25)\n"
+  "project(proof_incremental_finalization LANGUAGES CXX)\n"
+  "set(TARGET_INSTALL_PACKAGE_DISABLE_INSTALL ON)\n"
+  "include(\"${TIP_REPO_ROOT}/cmake/load_target_install_package.cmake\")\n"
+  "file(READ \"\${CMAKE_CURRENT_SOURCE_DIR}/version.txt\" proof_incremental_version)\n"
+  "string(STRIP \"\${proof_incremental_version}\" proof_incremental_version)\n"
+  "file(STRINGS \"\${CMAKE_CURRENT_SOURCE_DIR}/dependencies.txt\" proof_incremental_dependencies)\n"
+  "file(STRINGS \"\${CMAKE_CURRENT_SOURCE_DIR}/marker.txt\" proof_incremental_marker)\n"
+  "add_library(proof_incremental INTERFACE)\n"
+  "target_sources(proof_incremental INTERFACE FILE_SET HEADERS BASE_DIRS include FILES include/proof_incremental/value.h)\n"
+  "target_install_package(proof_incremental VERSION \${proof_incremental_version} CONFIG_TEMPLATE \"\${CMAKE_CURRENT_SOURCE_DIR}/proof_incremental-config.cmake.in\"\n"
+  "  PUBLIC_DEPENDENCIES \${proof_incremental_dependencies})\n")
+file(WRITE "${_tip_source_dir}/include/proof_incremental/value.h" "inline int proof_incremental_value() { return 1; }\n")
+file(WRITE "${_tip_source_dir}/version.txt" "1.0.0\n")
+file(WRITE "${_tip_source_dir}/dependencies.txt" "Threads REQUIRED\n")
+file(WRITE "${_tip_source_dir}/marker.txt" "first\n")
+file(READ "${TIP_REPO_ROOT}/cmake/generic-config.cmake.in" _tip_generic_template)
+file(WRITE "${_tip_source_dir}/proof_incremental-config.cmake.in" "${_tip_generic_template}set(proof_incremental_MARKER \"@proof_incremental_marker@\")\n")
+
+_tip_proof_append_toolchain_args(_tip_toolchain_args)
+
+set(_tip_config_file "${_tip_build_dir}/proof_incrementalConfig.cmake")
+set(_tip_version_file "${_tip_build_dir}/proof_incrementalConfigVersion.cmake")
+set(_tip_stamp_file "${_tip_build_dir}/CMakeFiles/proof_incremental-package-files.sha256")
+set(_tip_skip_message "are up to date, skipping regeneration")
+
+# Configure the fixture and record whether finalize_package() reused the generated config and version files.
+function(_tip_configure_incremental step out_var)
+  execute_process(
+    COMMAND "${CMAKE_COMMAND}" -S "${_tip_source_dir}" -B "${_tip_build_dir}" --log-level=DEBUG ${_tip_toolchain_args}
+    RESULT_VARIABLE _tip_result
+    OUTPUT_VARIABLE _tip_output
+    ERROR_VARIABLE _tip_error)
+  if(NOT _tip_result EQUAL 0)
+    _tip_proof_fail("Step '${step}' exited with code ${_tip_result}\n${_tip_output}\n${_tip_error}")
+  endif()
+  string(FIND "${_tip_output}${_tip_error}" "${_tip_skip_message}" _tip_skip_index)
+  if(_tip_skip_index EQUAL -1)
+    set(${out_var}
+        FALSE
+        PARENT_SCOPE)
+  else()
+    set(${out_var}
+        TRUE
+        PARENT_SCOPE)
+  endif()
+endfunction()
+
+function(_tip_expect_reused step expected)
+  _tip_configure_incremental("${step}" _tip_reused)
+  if(NOT _tip_reused STREQUAL expected)
+    _tip_proof_fail("Step '${step}': expected reuse of generated package files to be ${expected}, got ${_tip_reused}")
+  endif()
+endfunction()
+
+_tip_expect_reused("initial-configure" FALSE)
+_tip_proof_assert_exists("${_tip_stamp_file}")
+file(TIMESTAMP "${_tip_config_file}" _tip_config_time "%s%f")
+file(TIMESTAMP "${_tip_version_file}" _tip_version_time "%s%f")
+
+# An unchanged reconfigure reuses the files and leaves their timestamps alone.
+_tip_expect_reused("unchanged-reconfigure" TRUE)
+file(TIMESTAMP "${_tip_config_file}" _tip_config_time_after "%s%f")
+file(TIMESTAMP "${_tip_version_file}" _tip_version_time_after "%s%f")
+if(NOT _tip_config_time STREQUAL _tip_config_time_after OR NOT _tip_version_time STREQUAL _tip_version_time_after)
+  _tip_proof_fail("Unchanged reconfigure rewrote the generated package files")
+endif()
+
+# The skipped configure_file() still leaves the template as a configure dependency.
+if(EXISTS "${_tip_build_dir}/CMakeFiles/Makefile.cmake")
+  _tip_proof_assert_file_contains("${_tip_build_dir}/CMakeFiles/Makefile.cmake" "proof_incremental-config.cmake.in")
+elseif(EXISTS "${_tip_build_dir}/build.ninja")
+  _tip_proof_assert_file_contains("${_tip_build_dir}/build.ninja" "proof_incremental-config.cmake.in")
+endif()
+
+# Changing an input regenerates the files.
+file(WRITE "${_tip_source_dir}/version.txt" "1.1.0\n")
+_tip_expect_reused("version-change" FALSE)
+_tip_proof_assert_file_contains("${_tip_version_file}" "1.1.0")
+_tip_expect_reused("version-change-reconfigure" TRUE)
+
+file(WRITE "${_tip_source_dir}/dependencies.txt" "Threads REQUIRED\nproof_incremental_dependency 2.0\n")
+_tip_expect_reused("dependency-change" FALSE)
+_tip_proof_assert_file_contains("${_tip_config_file}" "find_dependency(proof_incremental_dependency 2.0)")
+_tip_expect_reused("dependency-change-reconfigure" TRUE)
+
+file(WRITE "${_tip_source_dir}/marker.txt" "second\n")
+_tip_expect_reused("template-variable-change" FALSE)
+_tip_proof_assert_file_contains("${_tip_config_file}" "set(proof_incremental_MARKER \"second\")")
+
+file(APPEND "${_tip_source_dir}/proof_incremental-config.cmake.in" "set(proof_incremental_TEMPLATE_MARKER ON)\n")
+_tip_expect_reused("template-change" FALSE)
+_tip_proof_assert_file_contains("${_tip_config_file}" "proof_incremental_TEMPLATE_MARKER")
+
+# A missing output is regenerated even when the inputs are unchanged.
+file(REMOVE "${_tip_config_file}")
+_tip_expect_reused("missing-config" FALSE)
+_tip_proof_assert_exists("${_tip_config_file}")
+_tip_proof_assert_file_contains("${_tip_config_file}" "find_dependency(Threads REQUIRED)")
+
+message(STATUS "[proof] Incremental finalization proof passed.")
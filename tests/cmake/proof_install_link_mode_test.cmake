@@ -0,0 +1,167 @@
+cmake_minimum_required(VERSION 3.25)
+
+include("${CMAKE_CURRENT_LIST_DIR}/proof_helpers.cmake")
+
+if(NOT DEFINED TIP_REPO_ROOT)
+  _tip_proof_fail("TIP_REPO_ROOT is required")
+endif()
+if(NOT DEFINED TIP_PROOF_TEST_ROOT)
+  _tip_proof_fail("TIP_PROOF_TEST_ROOT is required")
+endif()
+
+set(_tip_case_root "${TIP_PROOF_TEST_ROOT}/install-link-mode")
+set(_tip_source_dir "${_tip_case_root}/source")
+set(_tip_build_dir "${_tip_case_root}/build")
+set(_tip_linked_prefix "${_tip_case_root}/linked-install")
+set(_tip_copied_prefix "${_tip_case_root}/copied-install")
+file(REMOVE_RECURSE "${_tip_case_root}")
+
+_tip_proof_append_toolchain_args(_tip_toolchain_args)
+
+# A static library with a nested header file set, a shared library and an executable, whose installed copies get their
+# RPATH rewritten, and two additional files in the source tree, one of them an executable script.
+file(
+  WRITE "${_tip_source_dir}/CMakeLists.txt"
+  "cmake_minimum_required(VERSION 3.25)\n"
+  "project(proof_install_link_mode VERSION 1.0.0 LANGUAGES C)\n"
+  "set(TARGET_INSTALL_PACKAGE_DISABLE_INSTALL ON)\n"
+  "include(\"${TIP_REPO_ROOT}/cmake/load_target_install_package.cmake\")\n"
+  "add_library(proof_il_static STATIC static.c)\n"
+  "target_sources(proof_il_static PUBLIC FILE_SET HEADERS BASE_DIRS include FILES include/proof_il/detail/static.h)\n"
+  "add_library(proof_il_shared SHARED shared.c)\n"
+  "add_executable(proof_il_tool tool.c)\n"
+  "target_link_libraries(proof_il_tool PRIVATE proof_il_shared)\n"
+  "target_install_packages(TARGETS proof_il_static proof_il_shared proof_il_tool EXPORT_NAME proof_il\n"
+  "                        TARGET proof_il_static ADDITIONAL_FILES data/model.bin data/run.sh ADDITIONAL_FILES_DESTINATION share/proof_il)\n")
+file(WRITE "${_tip_source_dir}/include/proof_il/detail/static.h" "int proof_il_static(void);\n")
+file(WRITE "${_tip_source_dir}/static.c" "int proof_il_static(void) { return 1; }\n")
+file(WRITE "${_tip_source_dir}/shared.c" "int proof_il_shared(void) { return 2; }\n")
+file(WRITE "${_tip_source_dir}/tool.c" "int proof_il_shared(void);\nint main(void) { return proof_il_shared() - 2; }\n")
+file(WRITE "${_tip_source_dir}/data/model.bin" "weights\n")
+file(WRITE "${_tip_source_dir}/data/run.sh" "#!/bin/sh\n")
+file(
+  CHMOD
+  "${_tip_source_dir}/data/run.sh"
+  PERMISSIONS
+  OWNER_READ
+  OWNER_WRITE
+  OWNER_EXECUTE
+  GROUP_READ
+  GROUP_EXECUTE)
+
+# The octal mode of FILE, or "" where stat is not available
+function(_tip_proof_mode OUT_VAR FILE)
+  execute_process(
+    COMMAND stat -c %a "${FILE}"
+    RESULT_VARIABLE _tip_result
+    OUTPUT_VARIABLE _tip_mode
+    OUTPUT_STRIP_TRAILING_WHITESPACE ERROR_QUIET)
+  if(NOT _tip_result EQUAL 0)
+    execute_process(
+      COMMAND stat -f %Lp "${FILE}"
+      OUTPUT_VARIABLE _tip_mode
+      OUTPUT_STRIP_TRAILING_WHITESPACE ERROR_QUIET)
+  endif()
+  set(${OUT_VAR}
+      "${_tip_mode}"
+      PARENT_SCOPE)
+endfunction()
+
+_tip_proof_expect_failure(
+  NAME
+  "invalid link mode"
+  COMMAND
+  "${CMAKE_COMMAND}"
+  -S
+  "${_tip_source_dir}"
+  -B
+  "${_tip_case_root}/invalid-build"
+  -DTIP_INSTALL_LINK_MODE=symlink
+  ${_tip_toolchain_args}
+  EXPECT_CONTAINS
+  "'symlink'")
+
+_tip_proof_run_step(
+  NAME
+  "configure"
+  COMMAND
+  "${CMAKE_COMMAND}"
+  -S
+  "${_tip_source_dir}"
+  -B
+  "${_tip_build_dir}"
+  -DCMAKE_BUILD_TYPE=Release
+  -DTIP_INSTALL_LINK_MODE=HARDLINK
+  ${_tip_toolchain_args})
+_tip_proof_run_step(NAME "build" COMMAND "${CMAKE_COMMAND}" --build "${_tip_build_dir}" --config Release)
+
+file(GLOB _tip_shared_outputs "${_tip_build_dir}/*proof_il_shared*" "${_tip_build_dir}/Release/*proof_il_shared*")
+set(_tip_shared_hashes "")
+foreach(_tip_shared_output IN LISTS _tip_shared_outputs)
+  if(NOT IS_SYMLINK "${_tip_shared_output}" AND NOT IS_DIRECTORY "${_tip_shared_output}")
+    file(SHA256 "${_tip_shared_output}" _tip_hash)
+    list(APPEND _tip_shared_hashes "${_tip_hash}")
+  endif()
+endforeach()
+
+execute_process(
+  COMMAND "${CMAKE_COMMAND}" --install "${_tip_build_dir}" --config Release --prefix "${_tip_linked_prefix}"
+  RESULT_VARIABLE _tip_result
+  OUTPUT_VARIABLE _tip_stdout
+  ERROR_VARIABLE _tip_stderr)
+if(NOT _tip_result EQUAL 0)
+  _tip_proof_fail("Linked install failed:\n${_tip_stdout}\n${_tip_stderr}")
+endif()
+
+# The static library in the build tree is hardlinked. Files in the source tree are not, since the install's chmod would
+# change the source file as well; header file sets keep their subdirectory.
+if(NOT _tip_stdout MATCHES "Hardlinked: [^\n]*proof_il_static")
+  _tip_proof_fail("Expected the static library to be hardlinked:\n${_tip_stdout}")
+endif()
+if(_tip_stdout MATCHES "Hardlinked: [^\n]*(static\\.h|model\\.bin|run\\.sh)")
+  _tip_proof_fail("Files in the source tree must not be hardlinked:\n${_tip_stdout}")
+endif()
+_tip_proof_assert_exists("${_tip_linked_prefix}/include/proof_il/detail/static.h")
+if(NOT WIN32)
+  _tip_proof_mode(_tip_script_mode "${_tip_source_dir}/data/run.sh")
+  if(NOT _tip_script_mode STREQUAL "750")
+    _tip_proof_fail("The install changed the mode of the source file data/run.sh to '${_tip_script_mode}'")
+  endif()
+endif()
+
+# Binaries whose installed copy is rewritten are never hardlinked, and the build outputs stay as they were built.
+if(NOT WIN32 AND _tip_stdout MATCHES "Hardlinked: [^\n]*(proof_il_shared|proof_il_tool)")
+  _tip_proof_fail("Binaries with a rewritten install RPATH must not be hardlinked:\n${_tip_stdout}")
+endif()
+set(_tip_shared_hashes_after "")
+foreach(_tip_shared_output IN LISTS _tip_shared_outputs)
+  if(NOT IS_SYMLINK "${_tip_shared_output}" AND NOT IS_DIRECTORY "${_tip_shared_output}")
+    file(SHA256 "${_tip_shared_output}" _tip_hash)
+    list(APPEND _tip_shared_hashes_after "${_tip_hash}")
+  endif()
+endforeach()
+if(NOT _tip_shared_hashes STREQUAL _tip_shared_hashes_after)
+  _tip_proof_fail("The install changed the shared library in the build tree")
+endif()
+
+# The installed additional file is not the source file.
+file(APPEND "${_tip_linked_prefix}/share/proof_il/model.bin" "tuned\n")
+_tip_proof_assert_file_not_contains("${_tip_source_dir}/data/model.bin" "tuned")
+
+# The environment switches one install back to plain copies.
+execute_process(
+  COMMAND "${CMAKE_COMMAND}" -E env TIP_INSTALL_LINK_MODE=copy "${CMAKE_COMMAND}" --install "${_tip_build_dir}" --config Release --prefix "${_tip_copied_prefix}"
+  RESULT_VARIABLE _tip_result
+  OUTPUT_VARIABLE _tip_stdout
+  ERROR_VARIABLE _tip_stderr)
+if(NOT _tip_result EQUAL 0)
+  _tip_proof_fail("Copy install failed:\n${_tip_stdout}\n${_tip_stderr}")
+endif()
+if(_tip_stdout MATCHES "(Hardlinked|Reflinked): ")
+  _tip_proof_fail("TIP_INSTALL_LINK_MODE=copy in the environment must not link files:\n${_tip_stdout}")
+endif()
+file(APPEND "${_tip_copied_prefix}/share/proof_il/model.bin" "tuned\n")
+_tip_proof_assert_file_not_contains("${_tip_source_dir}/data/model.bin" "tuned")
+_tip_proof_assert_exists("${_tip_copied_prefix}/include/proof_il/detail/static.h")
+
+message(STATUS "[proof] Install link mode proof passed.")
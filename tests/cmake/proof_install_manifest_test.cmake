@@ -0,0 +1,126 @@
+cmake_minimum_required(VERSION 3.25)
+
+include("${CMAKE_CURRENT_LIST_DIR}/proof_helpers.cmake")
+
+if(NOT DEFINED TIP_REPO_ROOT)
+  _tip_proof_fail("TIP_REPO_ROOT is required")
+endif()
+if(NOT DEFINED TIP_PROOF_TEST_ROOT)
+  _tip_proof_fail("TIP_PROOF_TEST_ROOT is required")
+endif()
+
+set(_tip_case_root "${TIP_PROOF_TEST_ROOT}/install-manifest")
+set(_tip_source_dir "${_tip_case_root}/source")
+set(_tip_build_dir "${_tip_case_root}/build")
+set(_tip_prefix "${_tip_case_root}/install")
+set(_tip_component_prefix "${_tip_case_root}/component-install")
+file(REMOVE_RECURSE "${_tip_case_root}")
+
+_tip_proof_append_toolchain_args(_tip_toolchain_args)
+
+# A shared library, whose installed copy gets its RPATH rewritten, with a header and an additional data file.
+file(
+  WRITE "${_tip_source_dir}/CMakeLists.txt"
+  "cmake_minimum_required(VERSION 3.25)\n"
+  "project(proof_install_manifest VERSION 1.0.0 LANGUAGES C)\n"
+  "set(TARGET_INSTALL_PACKAGE_DISABLE_INSTALL ON)\n"
+  "include(\"${TIP_REPO_ROOT}/cmake/load_target_install_package.cmake\")\n"
+  "add_library(proof_im SHARED im.c)\n"
+  "set_target_properties(proof_im PROPERTIES VERSION 1.0.0 SOVERSION 1)\n"
+  "target_sources(proof_im PUBLIC FILE_SET HEADERS BASE_DIRS include FILES include/proof_im/im.h)\n"
+  "target_install_package(proof_im INSTALL_MANIFEST COMPONENT im\n"
+  "                       ADDITIONAL_FILES data/model.bin ADDITIONAL_FILES_DESTINATION share/proof_im)\n")
+file(WRITE "${_tip_source_dir}/include/proof_im/im.h" "int proof_im(void);\n")
+file(WRITE "${_tip_source_dir}/im.c" "int proof_im(void) { return 1; }\n")
+file(WRITE "${_tip_source_dir}/data/model.bin" "weights\n")
+
+_tip_proof_run_step(
+  NAME
+  "configure"
+  COMMAND
+  "${CMAKE_COMMAND}"
+  -S
+  "${_tip_source_dir}"
+  -B
+  "${_tip_build_dir}"
+  -DCMAKE_BUILD_TYPE=Release
+  ${_tip_toolchain_args})
+_tip_proof_run_step(NAME "build" COMMAND "${CMAKE_COMMAND}" --build "${_tip_build_dir}" --config Release)
+
+function(_tip_proof_install OUT_VAR)
+  execute_process(
+    COMMAND "${CMAKE_COMMAND}" --install "${_tip_build_dir}" --config Release ${ARGN}
+    RESULT_VARIABLE _tip_result
+    OUTPUT_VARIABLE _tip_stdout
+    ERROR_VARIABLE _tip_stderr)
+  if(NOT _tip_result EQUAL 0)
+    _tip_proof_fail("Install failed:\n${_tip_stdout}\n${_tip_stderr}")
+  endif()
+  set(${OUT_VAR}
+      "${_tip_stdout}"
+      PARENT_SCOPE)
+endfunction()
+
+_tip_proof_install(_tip_stdout --prefix "${_tip_prefix}")
+set(_tip_manifest "${_tip_prefix}/share/cmake/proof_im/proof_im.manifest")
+_tip_proof_assert_exists("${_tip_manifest}")
+
+# Every installed file is listed with its content hash, size and mode, and symbolic links with their target.
+file(SHA256 "${_tip_source_dir}/include/proof_im/im.h" _tip_header_hash)
+file(SIZE "${_tip_source_dir}/include/proof_im/im.h" _tip_header_size)
+if(WIN32)
+  set(_tip_header_mode "-")
+else()
+  set(_tip_header_mode "644")
+endif()
+_tip_proof_assert_file_contains("${_tip_manifest}" "${_tip_header_hash}\t${_tip_header_size}\t${_tip_header_mode}\tinclude/proof_im/im.h\n")
+_tip_proof_assert_file_contains("${_tip_manifest}" "\tshare/proof_im/model.bin\n")
+_tip_proof_assert_file_contains("${_tip_manifest}" "\tshare/cmake/proof_im/proof_imConfig.cmake\n")
+_tip_proof_assert_file_not_contains("${_tip_manifest}" "proof_im.manifest")
+if(NOT WIN32 AND NOT APPLE)
+  _tip_proof_assert_file_contains("${_tip_manifest}" "link:libproof_im.so.1\t0\t-\t")
+endif()
+file(READ "${_tip_manifest}" _tip_manifest_content)
+file(TIMESTAMP "${_tip_manifest}" _tip_manifest_time "%s%f" UTC)
+
+# A rebuild that produces the same bytes leaves the installed files and the manifest as they are.
+file(TOUCH "${_tip_source_dir}/include/proof_im/im.h" "${_tip_source_dir}/data/model.bin" "${_tip_source_dir}/im.c")
+_tip_proof_run_step(NAME "rebuild" COMMAND "${CMAKE_COMMAND}" --build "${_tip_build_dir}" --config Release)
+_tip_proof_install(_tip_stdout --prefix "${_tip_prefix}")
+if(NOT WIN32)
+  foreach(_tip_expected IN ITEMS "Unchanged: ${_tip_prefix}/include/proof_im/im.h" "Unchanged: ${_tip_prefix}/share/proof_im/model.bin")
+    string(FIND "${_tip_stdout}" "${_tip_expected}" _tip_position)
+    if(_tip_position EQUAL -1)
+      _tip_proof_fail("Expected '${_tip_expected}' in the reinstall output:\n${_tip_stdout}")
+    endif()
+  endforeach()
+  if(_tip_stdout MATCHES "Installing: [^\n]*(im\\.h|model\\.bin|proof_im\\.so\\.1\\.0\\.0)")
+    _tip_proof_fail("Unchanged files must not be copied again:\n${_tip_stdout}")
+  endif()
+endif()
+file(READ "${_tip_manifest}" _tip_manifest_after)
+file(TIMESTAMP "${_tip_manifest}" _tip_manifest_time_after "%s%f" UTC)
+if(NOT _tip_manifest_after STREQUAL _tip_manifest_content OR NOT _tip_manifest_time_after STREQUAL _tip_manifest_time)
+  _tip_proof_fail("The manifest must stay as it was when nothing changed:\n${_tip_manifest_content}\n${_tip_manifest_after}")
+endif()
+
+# A changed file is installed and its manifest line follows it.
+file(WRITE "${_tip_source_dir}/include/proof_im/im.h" "int proof_im(void);\nint proof_im_next(void);\n")
+_tip_proof_install(_tip_stdout --prefix "${_tip_prefix}")
+if(NOT _tip_stdout MATCHES "Installing: [^\n]*include/proof_im/im\\.h")
+  _tip_proof_fail("Expected the changed header to be installed:\n${_tip_stdout}")
+endif()
+file(SHA256 "${_tip_source_dir}/include/proof_im/im.h" _tip_header_hash)
+_tip_proof_assert_file_contains("${_tip_manifest}" "${_tip_header_hash}\t")
+
+# A component install writes its own manifest with only the files of that component.
+_tip_proof_install(_tip_stdout --prefix "${_tip_component_prefix}" --component Development)
+set(_tip_component_manifest "${_tip_component_prefix}/share/cmake/proof_im/proof_im-Development.manifest")
+_tip_proof_assert_exists("${_tip_component_manifest}")
+_tip_proof_assert_file_contains("${_tip_component_manifest}" "\tinclude/proof_im/im.h\n")
+_tip_proof_assert_file_not_contains("${_tip_component_manifest}" "libproof_im.so.1.0.0")
+_tip_proof_install(_tip_stdout --prefix "${_tip_component_prefix}" --component im)
+_tip_proof_assert_exists("${_tip_component_prefix}/share/cmake/proof_im/proof_im-im.manifest")
+_tip_proof_assert_file_not_contains("${_tip_component_prefix}/share/cmake/proof_im/proof_im-im.manifest" "im.h")
+
+message(STATUS "[proof] Install manifest proof passed.")
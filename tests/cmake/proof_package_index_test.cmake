@@ -0,0 +1,111 @@
+cmake_minimum_required(VERSION 3.25)
+
+include("${CMAKE_CURRENT_LIST_DIR}/proof_helpers.cmake")
+
+if(NOT DEFINED TIP_REPO_ROOT)
+  _tip_proof_fail("TIP_REPO_ROOT is required")
+endif()
+if(NOT DEFINED TIP_PROOF_TEST_ROOT)
+  _tip_proof_fail("TIP_PROOF_TEST_ROOT is required")
+endif()
+
+set(_tip_case_root "${TIP_PROOF_TEST_ROOT}/package-index")
+set(_tip_source_dir "${_tip_case_root}/src")
+set(_tip_install_prefix "${_tip_case_root}/install")
+set(_tip_moved_prefix "${_tip_case_root}/moved")
+file(REMOVE_RECURSE "${_tip_case_root}")
+
+# Three packages, one with its own config destination, indexed as proof_index.
+file(
+  WRITE "${_tip_source_dir}/CMakeLists.txt"
+  "cmake_minimum_required(VERSION 3.25)\n"
+  "project(proof_index VERSION 1.0.0 LANGUAGES NONE)\n"
+  "set(TARGET_INSTALL_PACKAGE_DISABLE_INSTALL ON)\n"
+  "include(\"${TIP_REPO_ROOT}/cmake/load_target_install_package.cmake\")\n"
+  "set(TIP_PACKAGE_INDEX proof_index)\n"
+  "add_library(proof_index_a INTERFACE)\n"
+  "add_library(proof_index_b INTERFACE)\n"
+  "add_library(proof_index_c INTERFACE)\n"
+  "target_install_package(proof_index_a VERSION 1.2.0)\n"
+  "target_install_package(proof_index_b)\n"
+  "target_install_package(proof_index_c CMAKE_CONFIG_DESTINATION lib/cmake/proof_index_c)\n")
+
+_tip_proof_run_step(
+  NAME
+  "configure"
+  COMMAND
+  "${CMAKE_COMMAND}"
+  -S
+  "${_tip_source_dir}"
+  -B
+  "${_tip_case_root}/build")
+_tip_proof_run_step(
+  NAME
+  "install"
+  COMMAND
+  "${CMAKE_COMMAND}"
+  --install
+  "${_tip_case_root}/build"
+  --prefix
+  "${_tip_install_prefix}")
+
+set(_tip_index_file "${_tip_install_prefix}/share/cmake/proof_index/proof_indexConfig.cmake")
+_tip_proof_assert_exists("${_tip_index_file}")
+_tip_proof_assert_file_contains("${_tip_index_file}" "set(proof_index_c_DIR \"\${_tip_index_prefix}/lib/cmake/proof_index_c\")")
+_tip_proof_assert_file_not_contains("${_tip_index_file}" "${_tip_install_prefix}")
+
+# The packages are found without any search path, so every hit comes from the index. The prefix is also moved to show
+# that the index is relocatable.
+file(COPY "${_tip_install_prefix}/" DESTINATION "${_tip_moved_prefix}")
+file(
+  WRITE "${_tip_case_root}/consumer/CMakeLists.txt"
+  "cmake_minimum_required(VERSION 3.25)\n"
+  "project(proof_index_consumer LANGUAGES NONE)\n"
+  "find_package(proof_index REQUIRED CONFIG PATHS \"${_tip_moved_prefix}\" NO_DEFAULT_PATH)\n"
+  "if(NOT proof_index_PACKAGES STREQUAL \"proof_index_a;proof_index_b;proof_index_c\" OR NOT proof_index_proof_index_a_VERSION STREQUAL \"1.2.0\")\n"
+  "  message(FATAL_ERROR \"Unexpected index contents: [\${proof_index_PACKAGES}] \${proof_index_proof_index_a_VERSION}\")\n"
+  "endif()\n"
+  "find_package(proof_index_a 1.1 REQUIRED NO_DEFAULT_PATH)\n"
+  "find_package(proof_index_b REQUIRED NO_DEFAULT_PATH)\n"
+  "find_package(proof_index_c REQUIRED NO_DEFAULT_PATH)\n"
+  "foreach(_proof_package IN ITEMS proof_index_a proof_index_b proof_index_c)\n"
+  "  if(NOT TARGET \${_proof_package}::\${_proof_package})\n"
+  "    message(FATAL_ERROR \"Expected \${_proof_package}::\${_proof_package}\")\n"
+  "  endif()\n"
+  "endforeach()\n"
+  "if(NOT proof_index_c_DIR STREQUAL \"${_tip_moved_prefix}/lib/cmake/proof_index_c\")\n"
+  "  message(FATAL_ERROR \"Unexpected proof_index_c_DIR: \${proof_index_c_DIR}\")\n"
+  "endif()\n")
+_tip_proof_run_step(
+  NAME
+  "consumer-configure"
+  COMMAND
+  "${CMAKE_COMMAND}"
+  -S
+  "${_tip_case_root}/consumer"
+  -B
+  "${_tip_case_root}/consumer/build")
+
+# An index cannot take the name of a package it indexes.
+file(
+  WRITE "${_tip_case_root}/collision/CMakeLists.txt"
+  "cmake_minimum_required(VERSION 3.25)\n"
+  "project(proof_index_collision VERSION 1.0.0 LANGUAGES NONE)\n"
+  "set(TARGET_INSTALL_PACKAGE_DISABLE_INSTALL ON)\n"
+  "include(\"${TIP_REPO_ROOT}/cmake/load_target_install_package.cmake\")\n"
+  "set(TIP_PACKAGE_INDEX proof_index_collision)\n"
+  "add_library(proof_index_collision INTERFACE)\n"
+  "target_install_package(proof_index_collision)\n")
+_tip_proof_expect_failure(
+  NAME
+  "collision"
+  EXPECT_CONTAINS
+  "has the name of an export"
+  COMMAND
+  "${CMAKE_COMMAND}"
+  -S
+  "${_tip_case_root}/collision"
+  -B
+  "${_tip_case_root}/collision-build")
+
+message(STATUS "[proof] Package index proof passed.")
@@ -0,0 +1,124 @@
+cmake_minimum_required(VERSION 3.25)
+
+include("${CMAKE_CURRENT_LIST_DIR}/proof_helpers.cmake")
+
+if(NOT DEFINED TIP_REPO_ROOT)
+  _tip_proof_fail("TIP_REPO_ROOT is required")
+endif()
+if(NOT DEFINED TIP_PROOF_TEST_ROOT)
+  _tip_proof_fail("TIP_PROOF_TEST_ROOT is required")
+endif()
+
+set(_tip_case_root "${TIP_PROOF_TEST_ROOT}/parallel-install")
+set(_tip_source_dir "${_tip_case_root}/source")
+set(_tip_build_dir "${_tip_case_root}/build")
+set(_tip_parallel_prefix "${_tip_case_root}/parallel-install")
+set(_tip_serial_prefix "${_tip_case_root}/serial-install")
+file(REMOVE_RECURSE "${_tip_case_root}")
+
+_tip_proof_append_toolchain_args(_tip_toolchain_args)
+
+# Two runtime components, the shared Development component, NOTICE.txt given to both runtime components, and a plain
+# install() rule without a component. PROOF_PI_CONFLICT gives README.txt to Alpha as well, which nothing records.
+file(
+  WRITE "${_tip_source_dir}/CMakeLists.txt"
+  "cmake_minimum_required(VERSION 3.25)\n"
+  "project(proof_parallel_install VERSION 1.0.0 LANGUAGES C)\n"
+  "set(TARGET_INSTALL_PACKAGE_DISABLE_INSTALL ON)\n"
+  "include(\"${TIP_REPO_ROOT}/cmake/load_target_install_package.cmake\")\n"
+  "add_library(proof_pi_alpha SHARED alpha.c)\n"
+  "add_library(proof_pi_beta SHARED beta.c)\n"
+  "target_install_package(proof_pi_alpha COMPONENT Alpha ADDITIONAL_FILES NOTICE.txt ADDITIONAL_FILES_DESTINATION share/proof_pi\n"
+  "                       ADDITIONAL_FILES_COMPONENTS Alpha Beta)\n"
+  "target_install_package(proof_pi_beta COMPONENT Beta)\n"
+  "install(FILES README.txt DESTINATION share/proof_pi)\n"
+  "if(PROOF_PI_CONFLICT)\n"
+  "  install(FILES README.txt DESTINATION share/proof_pi COMPONENT Alpha)\n"
+  "endif()\n")
+file(WRITE "${_tip_source_dir}/alpha.c" "int proof_pi_alpha(void) { return 1; }\n")
+file(WRITE "${_tip_source_dir}/beta.c" "int proof_pi_beta(void) { return 2; }\n")
+file(WRITE "${_tip_source_dir}/NOTICE.txt" "notice\n")
+file(WRITE "${_tip_source_dir}/README.txt" "readme\n")
+
+_tip_proof_run_step(
+  NAME
+  "configure"
+  COMMAND
+  "${CMAKE_COMMAND}"
+  -S
+  "${_tip_source_dir}"
+  -B
+  "${_tip_build_dir}"
+  ${_tip_toolchain_args})
+_tip_proof_run_step(NAME "build" COMMAND "${CMAKE_COMMAND}" --build "${_tip_build_dir}")
+
+set(_tip_launcher "${_tip_build_dir}/tip_parallel_install.cmake")
+_tip_proof_assert_exists("${_tip_launcher}")
+_tip_proof_assert_file_contains("${_tip_launcher}" "set(TIP_INSTALL_DETECTED_COMPONENTS [==[Alpha;Development;Beta]==])")
+
+execute_process(
+  COMMAND "${CMAKE_COMMAND}" -DTIP_INSTALL_JOBS=3 "-DTIP_INSTALL_PREFIX=${_tip_parallel_prefix}" -P "${_tip_launcher}"
+  RESULT_VARIABLE _tip_result
+  OUTPUT_VARIABLE _tip_stdout
+  ERROR_VARIABLE _tip_stderr)
+if(NOT _tip_result EQUAL 0)
+  _tip_proof_fail("Parallel install failed:\n${_tip_stdout}\n${_tip_stderr}")
+endif()
+
+# Every component gets a timing row, and the runtime components that both install NOTICE.txt run one after another.
+foreach(_tip_expected IN ITEMS "with 3 jobs" "installed one after another:\n  Alpha, Beta\n" "  Alpha\n" "  Beta\n" "  Development\n" "  Unspecified\n"
+                               "s of component installs")
+  string(FIND "${_tip_stdout}" "${_tip_expected}" _tip_position)
+  if(_tip_position EQUAL -1)
+    _tip_proof_fail("Expected '${_tip_expected}' in the parallel install output:\n${_tip_stdout}")
+  endif()
+endforeach()
+string(FIND "${_tip_stderr}" "NOTICE.txt" _tip_position)
+if(NOT _tip_position EQUAL -1)
+  _tip_proof_fail("NOTICE.txt was installed by components in sequence and is no conflict:\n${_tip_stderr}")
+endif()
+
+# The parallel install produces the same tree as a plain install of all components.
+_tip_proof_run_step(NAME "serial install" COMMAND "${CMAKE_COMMAND}" --install "${_tip_build_dir}" --prefix "${_tip_serial_prefix}")
+file(GLOB_RECURSE _tip_parallel_files LIST_DIRECTORIES false RELATIVE "${_tip_parallel_prefix}" "${_tip_parallel_prefix}/*")
+file(GLOB_RECURSE _tip_serial_files LIST_DIRECTORIES false RELATIVE "${_tip_serial_prefix}" "${_tip_serial_prefix}/*")
+list(SORT _tip_parallel_files)
+list(SORT _tip_serial_files)
+if(NOT _tip_parallel_files STREQUAL _tip_serial_files)
+  _tip_proof_fail("Parallel install differs from the serial install:\n  parallel: ${_tip_parallel_files}\n  serial: ${_tip_serial_files}")
+endif()
+_tip_proof_assert_exists("${_tip_parallel_prefix}/share/proof_pi/README.txt")
+
+# A file that components of different queue entries both install was written concurrently and fails the install.
+_tip_proof_run_step(
+  NAME
+  "configure with a conflict"
+  COMMAND
+  "${CMAKE_COMMAND}"
+  -S
+  "${_tip_source_dir}"
+  -B
+  "${_tip_build_dir}"
+  -DPROOF_PI_CONFLICT=ON
+  ${_tip_toolchain_args})
+_tip_proof_expect_failure(
+  NAME
+  "conflicts are errors"
+  COMMAND
+  "${CMAKE_COMMAND}"
+  "-DTIP_INSTALL_PREFIX=${_tip_parallel_prefix}"
+  -P
+  "${_tip_launcher}"
+  EXPECT_CONTAINS
+  "share/proof_pi/README.txt (Alpha, Unspecified)")
+_tip_proof_run_step(
+  NAME
+  "conflicts are warnings on request"
+  COMMAND
+  "${CMAKE_COMMAND}"
+  -DTIP_INSTALL_FAIL_ON_CONFLICT=OFF
+  "-DTIP_INSTALL_PREFIX=${_tip_parallel_prefix}"
+  -P
+  "${_tip_launcher}")
+
+message(STATUS "[proof] Parallel install proof passed.")
@@ -0,0 +1,131 @@
+cmake_minimum_required(VERSION 3.25)
+
+include("${CMAKE_CURRENT_LIST_DIR}/proof_helpers.cmake")
+
+if(NOT DEFINED TIP_REPO_ROOT)
+  _tip_proof_fail("TIP_REPO_ROOT is required")
+endif()
+if(NOT DEFINED TIP_PROOF_TEST_ROOT)
+  _tip_proof_fail("TIP_PROOF_TEST_ROOT is required")
+endif()
+
+set(_tip_case_root "${TIP_PROOF_TEST_ROOT}/profile-trace")
+set(_tip_source_dir "${_tip_case_root}/src")
+file(REMOVE_RECURSE "${_tip_case_root}")
+file(MAKE_DIRECTORY "${_tip_source_dir}/src" "${_tip_source_dir}/include/proof_profile")
+
+file(
+  WRITE "${_tip_source_dir}/CMakeLists.txt"
+  "cmake_minimum_required(VERSION 3.25)\n"
+  "project(proof_profile_trace VERSION 1.0.0 LANGUAGES CXX)\n"
+  "set(TARGET_INSTALL_PACKAGE_DISABLE_INSTALL ON)\n"
+  "include(\"${TIP_REPO_ROOT}/cmake/load_target_install_package.cmake\")\n"
+  "add_library(proof_profile_core STATIC src/core.cpp)\n"
+  "target_sources(proof_profile_core PUBLIC FILE_SET HEADERS BASE_DIRS include FILES include/proof_profile/core.h)\n"
+  "add_executable(proof_profile_tool src/tool.cpp)\n"
+  "target_link_libraries(proof_profile_tool PRIVATE proof_profile_core)\n"
+  "add_library(proof_profile_extra INTERFACE)\n"
+  "target_install_package(proof_profile_core EXPORT_NAME proof_profile_pkg)\n"
+  "target_install_package(proof_profile_tool EXPORT_NAME proof_profile_pkg COMPONENT Tools)\n"
+  "target_install_packages(TARGETS proof_profile_extra EXPORT_NAME proof_profile_extra_pkg)\n"
+  "export_cpack(PACKAGE_NAME ProofProfile PACKAGE_VERSION 1.0.0 GENERATORS TGZ NO_DEFAULT_GENERATORS CHECKSUMS sha256)\n")
+file(WRITE "${_tip_source_dir}/include/proof_profile/core.h" "int proof_profile_value();\n")
+file(WRITE "${_tip_source_dir}/src/core.cpp" "int proof_profile_value() { return 1; }\n")
+file(WRITE "${_tip_source_dir}/src/tool.cpp" "int proof_profile_value(); int main() { return proof_profile_value() == 1 ? 0 : 1; }\n")
+
+_tip_proof_append_toolchain_args(_tip_toolchain_args)
+
+# Profiling is off by default: no trace file is written.
+_tip_proof_run_step(
+  NAME
+  "configure-default"
+  COMMAND
+  "${CMAKE_COMMAND}"
+  -S
+  "${_tip_source_dir}"
+  -B
+  "${_tip_case_root}/default-build"
+  ${_tip_toolchain_args})
+_tip_proof_assert_not_exists("${_tip_case_root}/default-build/tip-profile.json")
+
+_tip_proof_run_step(
+  NAME
+  "configure-profiled"
+  COMMAND
+  "${CMAKE_COMMAND}"
+  -S
+  "${_tip_source_dir}"
+  -B
+  "${_tip_case_root}/profile-build"
+  -DTIP_PROFILE=ON
+  ${_tip_toolchain_args})
+set(_tip_trace "${_tip_case_root}/profile-build/tip-profile.json")
+_tip_proof_read_json("${_tip_trace}" _tip_trace_json)
+
+# Every begin event has a matching end event, timestamps never go backwards and the span names are the expected ones.
+string(JSON _tip_event_count LENGTH "${_tip_trace_json}")
+set(_tip_open_spans "")
+set(_tip_span_names "")
+set(_tip_last_ts 0)
+math(EXPR _tip_last_index "${_tip_event_count} - 1")
+foreach(_tip_index RANGE ${_tip_last_index})
+  string(JSON _tip_phase GET "${_tip_trace_json}" ${_tip_index} ph)
+  if(_tip_phase STREQUAL "M")
+    continue()
+  endif()
+  string(JSON _tip_ts GET "${_tip_trace_json}" ${_tip_index} ts)
+  if(_tip_ts LESS _tip_last_ts)
+    _tip_proof_fail("Trace event ${_tip_index} goes back in time: ${_tip_ts} < ${_tip_last_ts}")
+  endif()
+  set(_tip_last_ts ${_tip_ts})
+  if(_tip_phase STREQUAL "B")
+    string(JSON _tip_name GET "${_tip_trace_json}" ${_tip_index} name)
+    list(APPEND _tip_open_spans "${_tip_name}")
+    list(APPEND _tip_span_names "${_tip_name}")
+  elseif(_tip_phase STREQUAL "E")
+    if(NOT _tip_open_spans)
+      _tip_proof_fail("Trace event ${_tip_index} closes a span that was never opened")
+    endif()
+    list(POP_BACK _tip_open_spans)
+  else()
+    _tip_proof_fail("Unexpected trace event phase '${_tip_phase}'")
+  endif()
+endforeach()
+if(_tip_open_spans)
+  _tip_proof_fail("Trace spans left open: ${_tip_open_spans}")
+endif()
+
+foreach(
+  _tip_expected_span IN
+  ITEMS "target_prepare_package(proof_profile_core)"
+        "target_prepare_package(proof_profile_tool)"
+        "target_install_packages(proof_profile_extra_pkg)"
+        "finalize_package(proof_profile_pkg)"
+        "finalize_package(proof_profile_extra_pkg)"
+        "install(proof_profile_pkg/proof_profile_core)"
+        "install(proof_profile_pkg/proof_profile_tool)"
+        "install(proof_profile_extra_pkg/proof_profile_extra)"
+        "_execute_deferred_cpack_config()"
+        "_configure_gpg_signing(ProofProfile)")
+  if(NOT _tip_expected_span IN_LIST _tip_span_names)
+    _tip_proof_fail("Expected span '${_tip_expected_span}' in '${_tip_trace}'. Spans: ${_tip_span_names}")
+  endif()
+endforeach()
+
+# TIP_PROFILE_OUTPUT redirects the trace.
+_tip_proof_run_step(
+  NAME
+  "configure-profiled-output"
+  COMMAND
+  "${CMAKE_COMMAND}"
+  -S
+  "${_tip_source_dir}"
+  -B
+  "${_tip_case_root}/output-build"
+  -DTIP_PROFILE=ON
+  "-DTIP_PROFILE_OUTPUT=${_tip_case_root}/custom-trace.json"
+  ${_tip_toolchain_args})
+_tip_proof_assert_file_contains("${_tip_case_root}/custom-trace.json" "finalize_package(proof_profile_pkg)")
+_tip_proof_assert_not_exists("${_tip_case_root}/output-build/tip-profile.json")
+
+message(STATUS "[proof] Configure profile trace proof passed.")
@@ -0,0 +1,93 @@
+cmake_minimum_required(VERSION 3.25)
+
+include("${CMAKE_CURRENT_LIST_DIR}/proof_helpers.cmake")
+
+if(NOT DEFINED TIP_REPO_ROOT)
+  _tip_proof_fail("TIP_REPO_ROOT is required")
+endif()
+if(NOT DEFINED TIP_PROOF_TEST_ROOT)
+  _tip_proof_fail("TIP_PROOF_TEST_ROOT is required")
+endif()
+
+set(_tip_case_root "${TIP_PROOF_TEST_ROOT}/skip-install")
+set(_tip_source_dir "${_tip_case_root}/src")
+file(REMOVE_RECURSE "${_tip_case_root}")
+file(MAKE_DIRECTORY "${_tip_source_dir}/vendor/excluded/nested" "${_tip_source_dir}/vendor/helper")
+
+# A superbuild with one installable library, one vendored project added with EXCLUDE_FROM_ALL (its registration
+# lives in a nested directory and finalizes explicitly) and one helper project skipped with TIP_SKIP_INSTALL.
+file(
+  WRITE "${_tip_source_dir}/CMakeLists.txt"
+  "cmake_minimum_required(VERSION 3.25)\n"
+  "project(proof_skip_install VERSION 1.0.0 LANGUAGES CXX)\n"
+  "set(TARGET_INSTALL_PACKAGE_DISABLE_INSTALL ON)\n"
+  "include(\"${TIP_REPO_ROOT}/cmake/load_target_install_package.cmake\")\n"
+  "add_library(proof_skip_main INTERFACE)\n"
+  "target_install_package(proof_skip_main)\n"
+  "add_subdirectory(vendor/excluded EXCLUDE_FROM_ALL)\n"
+  "set(TIP_SKIP_INSTALL ON)\n"
+  "add_subdirectory(vendor/helper)\n"
+  "unset(TIP_SKIP_INSTALL)\n")
+file(WRITE "${_tip_source_dir}/vendor/excluded/CMakeLists.txt" "add_subdirectory(nested)\n")
+file(WRITE "${_tip_source_dir}/vendor/excluded/nested/CMakeLists.txt" "add_library(proof_skip_vendor INTERFACE)\n" "target_install_package(proof_skip_vendor)\n"
+                                                                        "finalize_package(EXPORT_NAME proof_skip_vendor)\n")
+file(WRITE "${_tip_source_dir}/vendor/helper/CMakeLists.txt" "add_library(proof_skip_helper INTERFACE)\n" "target_install_packages(TARGETS proof_skip_helper EXPORT_NAME proof_skip_helper)\n")
+
+_tip_proof_append_toolchain_args(_tip_toolchain_args)
+
+function(_tip_configure_and_install_skip_fixture variant)
+  set(_tip_build_dir "${_tip_case_root}/${variant}-build")
+  _tip_proof_run_step(
+    NAME
+    "${variant}-configure"
+    COMMAND
+    "${CMAKE_COMMAND}"
+    -S
+    "${_tip_source_dir}"
+    -B
+    "${_tip_build_dir}"
+    ${ARGN}
+    ${_tip_toolchain_args})
+  _tip_proof_run_step(
+    NAME
+    "${variant}-install"
+    COMMAND
+    "${CMAKE_COMMAND}"
+    --install
+    "${_tip_build_dir}"
+    --prefix
+    "${_tip_case_root}/${variant}-install")
+endfunction()
+
+# Without TIP_SKIP_EXCLUDED_FROM_ALL the EXCLUDE_FROM_ALL subtree still gets its package files, which the top-level
+# install never runs. The TIP_SKIP_INSTALL subtree gets nothing.
+_tip_configure_and_install_skip_fixture(default)
+_tip_proof_assert_exists("${_tip_case_root}/default-install/share/cmake/proof_skip_main/proof_skip_mainConfig.cmake")
+_tip_proof_assert_exists("${_tip_case_root}/default-build/vendor/excluded/nested/proof_skip_vendorConfig.cmake")
+_tip_proof_assert_not_exists("${_tip_case_root}/default-install/share/cmake/proof_skip_vendor")
+_tip_proof_assert_not_exists("${_tip_case_root}/default-install/share/cmake/proof_skip_helper")
+_tip_proof_assert_not_exists("${_tip_case_root}/default-build/vendor/helper/proof_skip_helperConfig.cmake")
+
+# With it, nothing is generated for the excluded subtree, including the nested directory's explicit finalize_package().
+_tip_configure_and_install_skip_fixture(excluded -DTIP_SKIP_EXCLUDED_FROM_ALL=ON)
+_tip_proof_assert_exists("${_tip_case_root}/excluded-install/share/cmake/proof_skip_main/proof_skip_mainConfig.cmake")
+_tip_proof_assert_not_exists("${_tip_case_root}/excluded-install/share/cmake/proof_skip_vendor")
+_tip_proof_assert_not_exists("${_tip_case_root}/excluded-build/vendor/excluded/nested/proof_skip_vendorConfig.cmake")
+_tip_proof_assert_not_exists("${_tip_case_root}/excluded-install/share/cmake/proof_skip_helper")
+
+# CMAKE_SKIP_INSTALL_RULES turns every registration into a no-op.
+_tip_proof_run_step(
+  NAME
+  "skip-rules-configure"
+  COMMAND
+  "${CMAKE_COMMAND}"
+  -S
+  "${_tip_source_dir}"
+  -B
+  "${_tip_case_root}/skip-rules-build"
+  -DCMAKE_SKIP_INSTALL_RULES=ON
+  ${_tip_toolchain_args})
+_tip_proof_assert_not_exists("${_tip_case_root}/skip-rules-build/proof_skip_mainConfig.cmake")
+_tip_proof_assert_not_exists("${_tip_case_root}/skip-rules-build/vendor/excluded/nested/proof_skip_vendorConfig.cmake")
+
+message(STATUS "[proof] Skip install proof passed.")
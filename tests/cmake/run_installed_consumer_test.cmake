@@ -36,7 +36,8 @@ list(APPEND _tip_main_install_command --prefix "${_tip_install_prefix}" --compon
 _tip_proof_run_step(NAME "install-target-install-package" COMMAND ${_tip_main_install_command})
 
 set(_tip_installed_helper_dir "${_tip_install_prefix}/share/cmake/target_install_package")
-foreach(_tip_installed_helper IN ITEMS generic-config.cmake.in sign_packages.cmake.in external_container_package.cmake collect_runtime_deps.sh build_minimal_container.sh container_to_quadlet.sh)
+foreach(_tip_installed_helper IN ITEMS generic-config.cmake.in cps-primary-config.cmake.in sign_packages.cmake.in external_container_package.cmake tip_profile.cmake tip_cps.cmake tip_sbom.cmake tip_rpath.cmake tip_signing.cmake tip_flatten_config.cmake tip_component_shards.cmake tip_package_index.cmake tip_find_package_profile.cmake tip_build_tree_export.cmake tip_header_cost.cmake tip_parallel_install.cmake tip_install_links.cmake tip_install_manifest.cmake tip_content_store.cmake
+        collect_runtime_deps.sh build_minimal_container.sh container_to_quadlet.sh)
   _tip_proof_assert_exists("${_tip_installed_helper_dir}/${_tip_installed_helper}")
 endforeach()
 _tip_proof_assert_not_exists("${_tip_installed_helper_dir}/cmake/generic-config.cmake.in")